@@ -1,7 +1,8 @@
 #!/usr/bin/env python
 #=======================================================================================
 # heliumRetention.py
-# Plots the helium retention values as a function of the fluence obtained with Xolotl
+# Plots the helium retention values as a function of the fluence obtained with Xolotl,
+# from the retentionOut.txt files or the retentionOut.h5 ones (-timeseries_format hdf5)
 #=======================================================================================
 
 import numpy as np
@@ -9,13 +10,23 @@ import math
 import matplotlib.pyplot as plt
 from   pylab import *
 
+def loadTimeSeries(fileName):
+    """Read a time series written by xolotlCore::TimeSeries, one row per time step."""
+    if not fileName.endswith('.h5'):
+        return loadtxt(fileName, ndmin=2)
+    import h5py
+    with h5py.File(fileName, 'r') as f:
+        return np.array(f['data'], dtype=float)
+
 ## Create plots
 fig1 = plt.figure()
 conPlot = plt.subplot(111)
 
 ## Load the data
-fluence1, retention1 = loadtxt('/path/to/data/retention_1.dat', usecols = (0,1) , unpack=True)
-fluence2, retention2 = loadtxt('/path/to/data/retention_2.dat', usecols = (0,1) , unpack=True)
+data1 = loadTimeSeries('/path/to/data/retentionOut_1.txt')
+data2 = loadTimeSeries('/path/to/data/retentionOut_2.h5')
+fluence1, retention1 = data1[:,0], data1[:,1]
+fluence2, retention2 = data2[:,0], data2[:,1]
 
 ## Fill the plot with data
 conPlot.scatter(fluence1, retention1, s=100, color='k', label='1')
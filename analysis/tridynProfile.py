@@ -0,0 +1,54 @@
+#!/usr/bin/env python
+#=======================================================================================
+# tridynProfile.py
+# Plots the helium profile from a TRIDYN_*.h5 file obtained with Xolotl, whatever the
+# precision it was written with (-analysis_precision double, float, or log16)
+#=======================================================================================
+
+import numpy as np
+import h5py
+import matplotlib.pyplot as plt
+from   pylab import *
+
+def readAnalysisDataset(dataset):
+    """Decode a dataset written by xolotlCore::AnalysisOutput."""
+    precision = dataset.attrs.get('precision', 'double')
+    if isinstance(precision, bytes):
+        precision = precision.decode()
+    if precision != 'log16':
+        return np.array(dataset, dtype=float)
+    # The first bit is the sign, the other ones the level of the magnitude
+    codes = np.array(dataset, dtype=np.uint16)
+    logMin, logMax = dataset.attrs['logMin'], dataset.attrs['logMax']
+    levels = (codes & 0x7fff).astype(float)
+    values = np.power(10.0, logMin + (logMax - logMin) * (levels - 1.0) / (0x7fff - 1))
+    values[levels == 0] = 0.0
+    values[(codes & 0x8000) != 0] *= -1.0
+    return values
+
+## Load the data, the columns are depth, He, D, T, V, I
+f = h5py.File('/path/to/data/TRIDYN_0.h5', 'r')
+concs = readAnalysisDataset(f['concs'])
+print('Relative error bound: %g' % f['concs'].attrs.get('relativeErrorBound', 0.0))
+
+## Create plot
+fig1 = plt.figure()
+profilePlot = plt.subplot(111)
+
+## Fill the plot with data
+profilePlot.plot(concs[:,0], concs[:,1], lw=4, color='k', label='He')
+profilePlot.plot(concs[:,0], concs[:,4], lw=4, color='b', label='V')
+
+## Plot the legend
+l = profilePlot.legend(loc='best')
+setp(l.get_texts(), fontsize=20)
+
+## Some cosmetics
+profilePlot.set_xlabel("depth (nm)",fontsize=25)
+profilePlot.set_ylabel("concentration (# nm$^{-3}$)",fontsize=25)
+profilePlot.set_yscale('log')
+profilePlot.grid()
+profilePlot.tick_params(axis='both', which='major', labelsize=25)
+
+## Show the plot
+plt.show()
@@ -0,0 +1,193 @@
+#!/usr/bin/env python
+#=======================================================================================
+# runBenchmarks.py
+# Runs the benchmark decks with Xolotl, compares the retention with the reference
+# outputs, and records the performance of each run in a history file.
+#
+# Usage: python runBenchmarks.py --xolotl /path/to/build/xolotl [--np 2]
+#
+# The exit status is 1 if the retention drifted from the reference or if a run is
+# slower than the recent runs of the same deck in the history file.
+#=======================================================================================
+
+import argparse
+import csv
+import math
+import os
+import re
+import subprocess
+import sys
+import time
+
+## The decks and their reference outputs, relative to this directory
+cases = [('PSI2', 'params_PSI2.txt', 'retention_PSI2.txt'),
+         ('PSI2_HeDT', 'params_PSI2_HeDT.txt', 'retention_PSI2_HeDT.txt'),
+         ('NE', 'params_NE.txt', 'retention_NE.txt')]
+
+## The columns of the history file
+historyFields = ['date', 'case', 'np', 'wallTime', 'timeSteps', 'snesIterations',
+                 'kspIterations', 'peakRSS', 'maxRelDiff', 'status']
+
+def loadRetention(fileName):
+    """Read a retention file as a list of rows of floats, from the text file
+    or from the HDF5 file written with -timeseries_format hdf5."""
+    if fileName.endswith('.h5'):
+        import h5py
+        with h5py.File(fileName, 'r') as f:
+            return [list(row) for row in f['data'][()]]
+    rows = []
+    with open(fileName) as f:
+        for line in f:
+            if line.strip():
+                rows.append([float(x) for x in line.split()])
+    return rows
+
+def compareRetention(rows, refRows, rtol, atol):
+    """Return the largest relative difference and the error message if the
+    retention is out of tolerance, None if it is fine."""
+    if len(rows) != len(refRows):
+        return float('inf'), '%d rows instead of %d' % (len(rows), len(refRows))
+    maxRelDiff = 0.0
+    for i, (row, refRow) in enumerate(zip(rows, refRows)):
+        if len(row) != len(refRow):
+            return float('inf'), 'row %d has %d columns instead of %d' % (i, len(row), len(refRow))
+        for j, (value, ref) in enumerate(zip(row, refRow)):
+            # Both are undefined at the start of some runs
+            if math.isnan(ref) and math.isnan(value):
+                continue
+            diff = abs(value - ref)
+            if diff <= atol:
+                continue
+            relDiff = diff / max(abs(ref), atol)
+            maxRelDiff = max(maxRelDiff, relDiff)
+            if relDiff > rtol:
+                return maxRelDiff, 'row %d column %d is %g instead of %g' % (i, j, value, ref)
+    return maxRelDiff, None
+
+def parseLog(fileName):
+    """Get the number of time steps and solver iterations from the output."""
+    steps, snes, ksp = 0, 0, 0
+    with open(fileName) as f:
+        for line in f:
+            # From -ts_monitor
+            m = re.match(r'\s*(\d+) TS dt', line)
+            if m:
+                steps = int(m.group(1))
+            # From -ts_view
+            m = re.search(r'total number of nonlinear solver iterations=(\d+)', line)
+            if m:
+                snes = int(m.group(1))
+            m = re.search(r'total number of linear solver iterations=(\d+)', line)
+            if m:
+                ksp = int(m.group(1))
+    return steps, snes, ksp
+
+def runCase(args, name, paramFile, runDir):
+    """Run one deck in its own directory and return the wall time and the
+    peak resident set size in MB."""
+    if not os.path.isdir(runDir):
+        os.makedirs(runDir)
+    # The iteration counts are printed by TSView at the end of the solve
+    env = dict(os.environ)
+    env['PETSC_OPTIONS'] = (env.get('PETSC_OPTIONS', '') + ' -ts_view').strip()
+    command = [args.mpiexec, '-n', str(args.np), args.xolotl, paramFile]
+    with open(os.path.join(runDir, 'output.txt'), 'w') as log:
+        start = time.time()
+        process = subprocess.Popen(command, cwd=runDir, env=env, stdout=log,
+                                   stderr=subprocess.STDOUT)
+        # wait4 gives the resources used by this run only
+        _, status, usage = os.wait4(process.pid, 0)
+        wallTime = time.time() - start
+    if status != 0:
+        raise RuntimeError('%s failed, see %s' % (name, os.path.join(runDir, 'output.txt')))
+    # ru_maxrss is in kB on Linux
+    return wallTime, usage.ru_maxrss / 1024.0
+
+def loadHistory(fileName):
+    """Read the previous runs."""
+    if not os.path.exists(fileName):
+        return []
+    with open(fileName) as f:
+        return list(csv.DictReader(f))
+
+def main():
+    parser = argparse.ArgumentParser(description='Xolotl end-to-end regression benchmarks')
+    parser.add_argument('--xolotl', required=True, help='the Xolotl executable')
+    parser.add_argument('--mpiexec', default='mpiexec', help='the MPI launcher')
+    parser.add_argument('--np', type=int, default=1, help='the number of MPI processes')
+    parser.add_argument('--cases', nargs='*', default=[c[0] for c in cases],
+                        help='the decks to run')
+    parser.add_argument('--rtol', type=float, default=1.0e-3,
+                        help='the relative tolerance on the retention')
+    parser.add_argument('--atol', type=float, default=1.0e-12,
+                        help='the absolute tolerance on the retention')
+    parser.add_argument('--slowdown', type=float, default=0.15,
+                        help='the relative slowdown that is flagged')
+    parser.add_argument('--window', type=int, default=5,
+                        help='the number of previous runs the wall time is compared to')
+    parser.add_argument('--history', default='benchmarkHistory.csv',
+                        help='the file where the runs are recorded')
+    parser.add_argument('--workdir', default='benchmarkRuns',
+                        help='the directory where the decks are run')
+    args = parser.parse_args()
+    args.xolotl = os.path.abspath(args.xolotl)
+
+    benchmarkDir = os.path.dirname(os.path.abspath(__file__))
+    history = loadHistory(args.history)
+    newEntries = []
+    failed = False
+
+    for name, paramFile, refFile in cases:
+        if name not in args.cases:
+            continue
+        runDir = os.path.abspath(os.path.join(args.workdir, name))
+        wallTime, peakRSS = runCase(args, name, os.path.join(benchmarkDir, paramFile), runDir)
+        steps, snes, ksp = parseLog(os.path.join(runDir, 'output.txt'))
+
+        # Numerical drift
+        # The HDF5 one if the deck asks for -timeseries_format hdf5
+        retentionFile = os.path.join(runDir, 'retentionOut.txt')
+        h5File = os.path.join(runDir, 'retentionOut.h5')
+        if os.path.exists(h5File) and (not os.path.exists(retentionFile)
+                                       or os.path.getmtime(h5File) > os.path.getmtime(retentionFile)):
+            retentionFile = h5File
+        maxRelDiff, error = compareRetention(loadRetention(retentionFile),
+                                             loadRetention(os.path.join(benchmarkDir, refFile)),
+                                             args.rtol, args.atol)
+        status = 'ok'
+        if error:
+            print('%s: DRIFT, %s' % (name, error))
+            status = 'drift'
+
+        # Slowdown with respect to the median of the last runs with the same layout
+        previous = [float(h['wallTime']) for h in history
+                    if h['case'] == name and h['np'] == str(args.np) and h['status'] == 'ok']
+        previous = sorted(previous[-args.window:])
+        if previous:
+            median = previous[len(previous) // 2]
+            if wallTime > (1.0 + args.slowdown) * median:
+                print('%s: SLOWDOWN, %.2f s instead of %.2f s' % (name, wallTime, median))
+                if status == 'ok':
+                    status = 'slowdown'
+
+        print('%s: %s, %.2f s, %d steps, %d SNES and %d KSP iterations, %.1f MB'
+              % (name, status, wallTime, steps, snes, ksp, peakRSS))
+        failed = failed or status != 'ok'
+        newEntries.append({'date': time.strftime('%Y-%m-%dT%H:%M:%S'), 'case': name,
+                           'np': args.np, 'wallTime': '%.3f' % wallTime, 'timeSteps': steps,
+                           'snesIterations': snes, 'kspIterations': ksp,
+                           'peakRSS': '%.1f' % peakRSS, 'maxRelDiff': '%.3e' % maxRelDiff,
+                           'status': status})
+
+    # Record the runs
+    writeHeader = not os.path.exists(args.history)
+    with open(args.history, 'a') as f:
+        writer = csv.DictWriter(f, fieldnames=historyFields)
+        if writeHeader:
+            writer.writeheader()
+        writer.writerows(newEntries)
+
+    return 1 if failed else 0
+
+if __name__ == '__main__':
+    sys.exit(main())
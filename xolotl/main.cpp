@@ -9,6 +9,7 @@
 #include <PetscSolver.h>
 #include <mpi.h>
 #include <MPIUtils.h>
+#include <TimeSeries.h>
 #include <Options.h>
 #include <xolotlPerf.h>
 #include <IMaterialFactory.h>
@@ -59,9 +60,9 @@ bool initTemp(const Options &options) {
 		return tempInitOK;
 }
 
-bool initViz(bool opts) {
+bool initViz(bool opts, bool async) {
 
-	bool vizInitOK = xolotlFactory::initializeVizHandler(opts);
+	bool vizInitOK = xolotlFactory::initializeVizHandler(opts, async);
 	if (!vizInitOK) {
 		std::cerr
 				<< "Unable to initialize requested visualization infrastructure. "
@@ -104,6 +105,8 @@ void launchPetscSolver(xolotlSolver::PetscSolver& solver,
 	// Launch the PetscSolver
 	auto solverTimer = handlerRegistry->getTimer("solve");
 	auto solverHwctr = handlerRegistry->getHardwareCounter("solve", hwctrSpec);
+	xperf::ScopedMemorySample solverMemory(
+			handlerRegistry->getMemoryTracker("solve:residentSetSize"));
 	solverTimer->start();
 	solverHwctr->start();
 	solver.solve();
@@ -134,7 +137,8 @@ int runXolotl(const Options& opts) {
 		throw std::runtime_error("Unable to initialize temperature.");
 	}
 	// Set up the visualization infrastructure.
-	bool vizInitOK = initViz(opts.useVizStandardHandlers());
+	bool vizInitOK = initViz(opts.useVizStandardHandlers(),
+			opts.useVizAsyncRendering());
 	if (!vizInitOK) {
 		throw std::runtime_error(
 				"Unable to initialize visualization infrastructure.");
@@ -159,6 +163,7 @@ int runXolotl(const Options& opts) {
 	networkLoadTimer->start();
 	networkFactory->initializeReactionNetwork(opts, handlerRegistry);
 	networkLoadTimer->stop();
+	handlerRegistry->getMemoryTracker("loadNetwork:residentSetSize")->sample();
 	if (rank == 0) {
 		std::time_t currentTime = std::time(NULL);
 		std::cout << std::asctime(std::localtime(&currentTime));
@@ -192,10 +197,12 @@ int runXolotl(const Options& opts) {
 	xperf::PerfObjStatsMap < xperf::ITimer::ValType > timerStats;
 	xperf::PerfObjStatsMap < xperf::IEventCounter::ValType > counterStats;
 	xperf::PerfObjStatsMap < xperf::IHardwareCounter::CounterType > hwCtrStats;
-	handlerRegistry->collectStatistics(timerStats, counterStats, hwCtrStats);
+	xperf::PerfObjStatsMap < xperf::IMemoryTracker::ValType > memStats;
+	handlerRegistry->collectStatistics(timerStats, counterStats, hwCtrStats,
+			memStats);
 	if (rank == 0) {
 		handlerRegistry->reportStatistics(std::cout, timerStats, counterStats,
-				hwCtrStats);
+				hwCtrStats, memStats);
 	}
 
 	return 0;
@@ -247,6 +254,12 @@ int main(int argc, char **argv) {
 		ret = EXIT_FAILURE;
 	}
 
+	// Write the rows of the time series still in memory, also when aborting
+	xolotlCore::TimeSeries::flushAll();
+
+	// Render the last plots while MPI is still there
+	xolotlFactory::finalizeVizHandler();
+
 	// Clean up.
 	MPI_Finalize();
 
@@ -0,0 +1,342 @@
+/**
+ * KernelBenchmark times the kernels of the reaction networks that dominate
+ * the cost of the RHS function and of the Jacobian, each one in isolation, on
+ * the networks described by the parameter files of the benchmarks directory.
+ *
+ * Usage: kernelBenchmark [-n <repeats>] [-format json|csv] [-o <file>]
+ * 		[<parameter file> ...]
+ *
+ * The networks are generated from the parameter files; the benchmark
+ * configurations (params_PSI2.txt, params_PSI2_HeDT.txt, params_NE.txt and
+ * params_Iron.txt) are used if none is given. The concentrations are
+ * synthetic and deterministic so that two runs can be compared. The results
+ * are written to kernelBenchmark.json (or .csv) by default.
+ */
+#include <mpi.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+#include <Options.h>
+#include <IReactionNetwork.h>
+#include <IReactionHandlerFactory.h>
+#include <DummyHandlerRegistry.h>
+#include <XolotlConfig.h>
+
+using namespace std;
+
+/**
+ * The timing of one kernel on one network.
+ */
+struct KernelResult {
+	//! The name of the parameter file.
+	string config;
+
+	//! The material of the network.
+	string material;
+
+	//! The number of clusters in the network.
+	int size;
+
+	//! The number of degrees of freedom.
+	int dof;
+
+	//! The name of the kernel.
+	string kernel;
+
+	//! The number of timed calls.
+	int repeats;
+
+	//! The fastest, mean, and slowest call in seconds.
+	double min, mean, max;
+};
+
+/**
+ * Time a kernel, after one call that is not timed to warm up the caches.
+ *
+ * @param kernel The kernel to time
+ * @param repeats The number of timed calls
+ * @param warmUp Whether to call the kernel once before timing it
+ * @param result The result where the timings are saved
+ */
+void timeKernel(const std::function<void()>& kernel, int repeats, bool warmUp,
+		KernelResult& result) {
+	using Clock = std::chrono::steady_clock;
+
+	if (warmUp)
+		kernel();
+
+	result.repeats = repeats;
+	result.min = std::numeric_limits<double>::max();
+	result.max = 0.0;
+	double total = 0.0;
+	for (int n = 0; n < repeats; n++) {
+		auto start = Clock::now();
+		kernel();
+		double duration = std::chrono::duration<double>(
+				Clock::now() - start).count();
+		result.min = std::min(result.min, duration);
+		result.max = std::max(result.max, duration);
+		total += duration;
+	}
+	result.mean = total / (double) repeats;
+
+	return;
+}
+
+/**
+ * Read the options from a parameter file.
+ *
+ * @param paramFileName The name of the parameter file
+ * @param opts The options to fill
+ */
+void readOptions(const string& paramFileName, xolotlCore::Options& opts) {
+	// Create a fake command line to read the options
+	char **argv = new char*[2];
+	argv[0] = new char[paramFileName.length() + 1];
+	strcpy(argv[0], paramFileName.c_str());
+	argv[1] = 0; // null-terminate the array
+
+	opts.readParams(argv);
+
+	delete[] argv[0];
+	delete[] argv;
+
+	if (!opts.shouldRun()) {
+		throw std::string(
+				"\nKernelBenchmark: cannot read the parameter file "
+						+ paramFileName);
+	}
+
+	return;
+}
+
+/**
+ * Benchmark all the kernels on the network described by one parameter file.
+ *
+ * @param paramFileName The name of the parameter file
+ * @param repeats The number of timed calls for each kernel
+ * @param results The vector where the results are added
+ */
+void benchmarkNetwork(const string& paramFileName, int repeats,
+		vector<KernelResult>& results) {
+	xolotlCore::Options opts;
+	readOptions(paramFileName, opts);
+
+	// The timers of the network are not needed here
+	auto registry = make_shared<xolotlPerf::DummyHandlerRegistry>();
+	auto networkFactory =
+			xolotlFactory::IReactionHandlerFactory::createNetworkFactory(
+					opts.getMaterial());
+
+	KernelResult result;
+	result.config = paramFileName.substr(paramFileName.find_last_of('/') + 1);
+	result.material = opts.getMaterial();
+
+	// Network generation, each call builds a new network
+	result.kernel = "generateNetwork";
+	timeKernel([&]() {
+		networkFactory->initializeReactionNetwork(opts, registry);
+	}, repeats, false, result);
+	auto& network = networkFactory->getNetworkHandler();
+	// Recompute the Ids and the connectivities as the solver does, the
+	// sparsity pattern depends on them
+	network.reinitializeConnectivities();
+	result.size = network.size();
+	result.dof = network.getDOF();
+	results.push_back(result);
+
+	// The temperature used for the rates
+	double temperature = 1000.0;
+	if (opts.useConstTemperatureHandlers())
+		temperature = opts.getConstTemperature();
+	else if (opts.useHeatEquationHandlers())
+		temperature = opts.getBulkTemperature();
+
+	// Everything happens at a single grid point
+	network.addGridPoints(1);
+
+	// Repeatable synthetic concentrations decreasing with the cluster index,
+	// the last degree of freedom is the temperature
+	const int dof = result.dof;
+	vector<double> concentrations(dof), updatedConcentrations(dof);
+	for (int i = 0; i < dof - 1; i++) {
+		concentrations[i] = 1.0e-3 * (1.5 + std::sin((double) i))
+				/ (double) (i + 1);
+	}
+	concentrations[dof - 1] = temperature;
+
+	// Rates
+	result.kernel = "setTemperature";
+	timeKernel([&]() {network.setTemperature(temperature, 0);}, repeats, true,
+			result);
+	results.push_back(result);
+	result.kernel = "computeRateConstants";
+	timeKernel([&]() {network.computeRateConstants(0);}, repeats, true, result);
+	results.push_back(result);
+
+	// Concentrations
+	result.kernel = "updateConcentrationsFromArray";
+	timeKernel([&]() {
+		network.updateConcentrationsFromArray(concentrations.data());
+	}, repeats, true, result);
+	results.push_back(result);
+
+	// Fluxes
+	result.kernel = "computeAllFluxes";
+	timeKernel(
+			[&]() {
+				std::fill(updatedConcentrations.begin(), updatedConcentrations.end(), 0.0);
+				network.computeAllFluxes(updatedConcentrations.data(), 0);
+			}, repeats, true, result);
+	results.push_back(result);
+
+	// Partial derivatives
+	vector<int> reactionSize(dof);
+	vector<size_t> reactionStartingIdx(dof);
+	auto nPartials = network.initPartialsSizes(reactionSize,
+			reactionStartingIdx);
+	vector<int> reactionIndices(nPartials);
+	network.initPartialsIndices(reactionSize, reactionStartingIdx,
+			reactionIndices);
+	vector<double> reactionVals(nPartials);
+	result.kernel = "computeAllPartials";
+	timeKernel([&]() {
+		network.computeAllPartials(reactionStartingIdx, reactionIndices,
+				reactionVals, 0);
+	}, repeats, true, result);
+	results.push_back(result);
+
+	// Sparsity pattern
+	result.kernel = "getDiagonalFill";
+	timeKernel([&]() {
+		xolotlCore::IReactionNetwork::SparseFillMap dfill;
+		network.getDiagonalFill(dfill);
+	}, repeats, true, result);
+	results.push_back(result);
+
+	return;
+}
+
+/**
+ * Write the results as JSON.
+ *
+ * @param os The stream to write to
+ * @param results The results
+ */
+void writeJSON(ostream& os, const vector<KernelResult>& results) {
+	os.precision(6);
+	os << std::scientific;
+	os << "{\"benchmarks\":[";
+	for (std::size_t i = 0; i < results.size(); i++) {
+		auto const& r = results[i];
+		os << ((i > 0) ? "," : "") << endl;
+		os << "{\"config\":\"" << r.config << "\",\"material\":\""
+				<< r.material << "\",\"size\":" << r.size << ",\"dof\":"
+				<< r.dof << ",\"kernel\":\"" << r.kernel << "\",\"repeats\":"
+				<< r.repeats << ",\"min\":" << r.min << ",\"mean\":" << r.mean
+				<< ",\"max\":" << r.max << "}";
+	}
+	os << endl << "]}" << endl;
+
+	return;
+}
+
+/**
+ * Write the results as CSV.
+ *
+ * @param os The stream to write to
+ * @param results The results
+ */
+void writeCSV(ostream& os, const vector<KernelResult>& results) {
+	os.precision(6);
+	os << std::scientific;
+	os << "config,material,size,dof,kernel,repeats,min,mean,max" << endl;
+	for (auto const& r : results) {
+		os << r.config << "," << r.material << "," << r.size << "," << r.dof
+				<< "," << r.kernel << "," << r.repeats << "," << r.min << ","
+				<< r.mean << "," << r.max << endl;
+	}
+
+	return;
+}
+
+//! Main program
+int main(int argc, char **argv) {
+	int ret = EXIT_SUCCESS;
+
+	// The network factories need MPI
+	MPI_Init(&argc, &argv);
+
+	try {
+		// Read the command line
+		int repeats = 10;
+		string format = "json";
+		string outputFileName;
+		vector<string> paramFileNames;
+		for (int i = 1; i < argc; i++) {
+			string arg = argv[i];
+			if (arg == "-n" && i + 1 < argc)
+				repeats = std::max(1, atoi(argv[++i]));
+			else if (arg == "-format" && i + 1 < argc)
+				format = argv[++i];
+			else if (arg == "-o" && i + 1 < argc)
+				outputFileName = argv[++i];
+			else
+				paramFileNames.push_back(arg);
+		}
+		if (format != "json" && format != "csv") {
+			throw std::string(
+					"\nKernelBenchmark: unknown output format " + format);
+		}
+		if (outputFileName.empty())
+			outputFileName = "kernelBenchmark." + format;
+
+		// Use the benchmark configurations by default
+		if (paramFileNames.empty()) {
+			string benchmarkDir = string(XolotlSourceDirectory)
+					+ "/../benchmarks/";
+			paramFileNames = {benchmarkDir + "params_PSI2.txt", benchmarkDir
+					+ "params_PSI2_HeDT.txt", benchmarkDir + "params_NE.txt",
+					benchmarkDir + "params_Iron.txt"};
+		}
+
+		// Run the benchmarks
+		vector<KernelResult> results;
+		for (auto const& paramFileName : paramFileNames) {
+			benchmarkNetwork(paramFileName, repeats, results);
+		}
+
+		// Print a summary
+		for (auto const& r : results) {
+			cout << r.config << " (" << r.size << " clusters) " << r.kernel
+					<< ": " << r.mean << " s" << endl;
+		}
+
+		// Save the results
+		ofstream outputFile(outputFileName);
+		if (format == "json")
+			writeJSON(outputFile, results);
+		else
+			writeCSV(outputFile, results);
+		cout << "Results written in " << outputFileName << endl;
+	} catch (const std::exception& e) {
+		cerr << e.what() << endl;
+		ret = EXIT_FAILURE;
+	} catch (const std::string& error) {
+		cerr << error << endl;
+		ret = EXIT_FAILURE;
+	}
+
+	MPI_Finalize();
+
+	return ret;
+}
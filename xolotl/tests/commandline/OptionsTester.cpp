@@ -109,7 +109,8 @@ BOOST_AUTO_TEST_CASE(goodParamFile) {
 			<< std::endl << "initialV=0.05" << std::endl << "dimensions=1"
 			<< std::endl << "voidPortion=60.0" << std::endl << "regularGrid=no"
 			<< std::endl << "process=diff" << std::endl << "grouping=11 2 4"
-			<< std::endl << "sputtering=0.5" << std::endl << "boundary=1 1"
+			<< std::endl << "groupingRatio=1.2" << std::endl
+			<< "sputtering=0.5" << std::endl << "boundary=1 1"
 			<< std::endl << "burstingDepth=5.0" << std::endl;
 	goodParamFile.close();
 
@@ -150,6 +151,7 @@ BOOST_AUTO_TEST_CASE(goodParamFile) {
 
 	// Check the performance handler
 	BOOST_REQUIRE_EQUAL(opts.useVizStandardHandlers(), true);
+	BOOST_REQUIRE_EQUAL(opts.useVizAsyncRendering(), false);
 
 	// Check the material option
 	BOOST_REQUIRE_EQUAL(opts.getMaterial(), "W100");
@@ -170,6 +172,7 @@ BOOST_AUTO_TEST_CASE(goodParamFile) {
 	BOOST_REQUIRE_EQUAL(opts.getGroupingMin(), 11);
 	BOOST_REQUIRE_EQUAL(opts.getGroupingWidthA(), 2);
 	BOOST_REQUIRE_EQUAL(opts.getGroupingWidthB(), 4);
+	BOOST_REQUIRE_EQUAL(opts.getGroupingRatio(), 1.2);
 
 	// Check the sputtering option
 	BOOST_REQUIRE_EQUAL(opts.getSputteringYield(), 0.5);
@@ -332,6 +335,39 @@ BOOST_AUTO_TEST_CASE(wrongVizHandler) {
 	std::remove(tempFile.c_str());
 }
 
+BOOST_AUTO_TEST_CASE(asyncVizHandler) {
+	xolotlCore::Options opts;
+
+	// Create a parameter file with the asynchronous visualization handler
+	std::ofstream paramFile("param_viz_async.txt");
+	paramFile << "vizHandler=async" << std::endl;
+	paramFile.close();
+
+	string pathToFile("param_viz_async.txt");
+	string filename = pathToFile;
+	const char* fname = filename.c_str();
+
+	// Build a command line with a parameter file containing the async option
+	char* args[3];
+	args[0] = const_cast<char*>("./xolotl");
+	args[1] = const_cast<char*>(fname);
+	args[2] = NULL;
+	char** fargv = args;
+
+	// Read the parameter file
+	fargv += 1;
+	opts.readParams(fargv);
+
+	// The standard handlers are used with the asynchronous rendering
+	BOOST_REQUIRE_EQUAL(opts.shouldRun(), true);
+	BOOST_REQUIRE_EQUAL(opts.useVizStandardHandlers(), true);
+	BOOST_REQUIRE_EQUAL(opts.useVizAsyncRendering(), true);
+
+	// Remove the created file
+	std::string tempFile = "param_viz_async.txt";
+	std::remove(tempFile.c_str());
+}
+
 BOOST_AUTO_TEST_CASE(goodParamFileWithProfiles) {
 	// Create a file with temperature profile data
 	// First column with the time and the second with
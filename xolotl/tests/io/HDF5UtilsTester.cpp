@@ -11,6 +11,7 @@
 #include <memory>
 #include <Options.h>
 #include "xolotlCore/io/XFile.h"
+#include "xolotlCore/io/AnalysisOutput.h"
 #include "tests/utils/MPIFixture.h"
 
 using namespace std;
@@ -521,4 +522,279 @@ BOOST_AUTO_TEST_CASE(checkSurface3D) {
 	}
 }
 
+/**
+ * Method checking that the concentrations written with one decomposition of
+ * the grid can be read back with another one.
+ */
+BOOST_AUTO_TEST_CASE(checkRedistributedConcentrations) {
+
+	// Determine where we are in the MPI world.
+	int commRank = -1;
+	int commSize = -1;
+	MPI_Comm_rank(MPI_COMM_WORLD, &commRank);
+	MPI_Comm_size(MPI_COMM_WORLD, &commSize);
+	const int nPoints = 6 * commSize;
+
+	// The concentrations of a grid point, their number varies
+	auto makeConcs = [](int point) {
+		xolotlCore::XFile::TimestepGroup::Concs1DType::value_type concs;
+		for (int l = 0; l < point % 3 + 1; l++) {
+			concs.emplace_back(2 * l, (double) point + 0.1 * l);
+		}
+		return concs;
+	};
+
+	// Create the test HDF5 file.
+	const std::string testFileName = "test_redistribution.h5";
+	{
+		std::vector<double> grid;
+		for (int i = 0; i < nPoints + 2; i++)
+			grid.push_back((double) i * 0.5);
+
+		xolotlCore::XFile testFile(testFileName, grid, createTestNetworkComps(),
+		MPI_COMM_WORLD);
+	}
+
+	// Write the concentrations, each process owns every commSize-th point
+	{
+		xolotlCore::XFile testFile(testFileName,
+		MPI_COMM_WORLD, xolotlCore::XFile::AccessMode::OpenReadWrite);
+		auto concGroup =
+				testFile.getGroup<xolotlCore::XFile::ConcentrationGroup>();
+		BOOST_REQUIRE(concGroup);
+		auto tsGroup = concGroup->addTimestepGroup(0, 0.0001, 0.00001,
+				0.000001);
+		BOOST_REQUIRE(tsGroup);
+
+		std::vector<int> gridPoints;
+		xolotlCore::XFile::TimestepGroup::Concs1DType concs;
+		for (int point = commRank; point < nPoints; point += commSize) {
+			gridPoints.push_back(point);
+			concs.push_back(makeConcs(point));
+		}
+		tsGroup->writeConcentrations(testFile, nPoints, gridPoints, concs);
+	}
+
+	// Read them back with a different decomposition, in reverse order
+	{
+		xolotlCore::XFile testFile(testFileName,
+		MPI_COMM_WORLD, xolotlCore::XFile::AccessMode::OpenReadOnly);
+		auto concGroup =
+				testFile.getGroup<xolotlCore::XFile::ConcentrationGroup>();
+		BOOST_REQUIRE(concGroup);
+		auto tsGroup = concGroup->getLastTimestepGroup();
+		BOOST_REQUIRE(tsGroup);
+		BOOST_REQUIRE(tsGroup->hasConcentrations());
+
+		std::vector<int> gridPoints;
+		for (int point = nPoints - 1; point >= 0; point--) {
+			if ((point / 2) % commSize == commRank)
+				gridPoints.push_back(point);
+		}
+		auto readConcs = tsGroup->readConcentrations(testFile, nPoints,
+				gridPoints);
+		BOOST_REQUIRE_EQUAL(readConcs.size(), gridPoints.size());
+		for (std::size_t n = 0; n < gridPoints.size(); n++) {
+			auto expectedConcs = makeConcs(gridPoints[n]);
+			BOOST_REQUIRE_EQUAL(readConcs[n].size(), expectedConcs.size());
+			for (std::size_t l = 0; l < expectedConcs.size(); l++) {
+				BOOST_REQUIRE_EQUAL(readConcs[n][l].first,
+						expectedConcs[l].first);
+				BOOST_REQUIRE_CLOSE(readConcs[n][l].second,
+						expectedConcs[l].second, 0.0001);
+			}
+		}
+	}
+}
+
+/**
+ * Method checking the reconstruction of incremental concentrations.
+ */
+BOOST_AUTO_TEST_CASE(checkDeltaConcentrations) {
+
+	// Determine where we are in the MPI world.
+	int commRank = -1;
+	int commSize = -1;
+	MPI_Comm_rank(MPI_COMM_WORLD, &commRank);
+	MPI_Comm_size(MPI_COMM_WORLD, &commSize);
+	const int nGridPointsPerRank = 4;
+	const int baseX = commRank * nGridPointsPerRank;
+
+	// The concentrations of a grid point at a given checkpoint: the first
+	// one does not change, the second one changes a little, the third one
+	// changes a lot, the fourth one is only there at the first checkpoint
+	// and the fifth one appears at the last one.
+	auto makeConcs = [](int point, int checkpoint) {
+		xolotlCore::XFile::TimestepGroup::Concs1DType::value_type concs;
+		concs.emplace_back(0, 1.0 + point);
+		concs.emplace_back(1, 2.0 + point + 1.0e-9 * checkpoint);
+		concs.emplace_back(2, 3.0 + point + checkpoint);
+		if (checkpoint == 0)
+			concs.emplace_back(3, 4.0);
+		if (checkpoint == 2)
+			concs.emplace_back(4, 5.0);
+		return concs;
+	};
+
+	// The changes are sorted and skip the small ones
+	auto delta = xolotlCore::XFile::TimestepGroup::computeDelta(
+			makeConcs(0, 0), makeConcs(0, 1), 1.0e-6);
+	BOOST_REQUIRE_EQUAL(delta.size(), 2);
+	BOOST_REQUIRE_EQUAL(delta[0].first, 2);
+	BOOST_REQUIRE_CLOSE(delta[0].second, 4.0, 0.0001);
+	BOOST_REQUIRE_EQUAL(delta[1].first, 3);
+	BOOST_REQUIRE_EQUAL(delta[1].second, 0.0);
+
+	// Create the test HDF5 file.
+	const std::string testFileName = "test_delta.h5";
+	{
+		std::vector<double> grid;
+		for (int i = 0; i < nGridPointsPerRank * commSize + 2; i++)
+			grid.push_back((double) i * 0.5);
+
+		xolotlCore::XFile testFile(testFileName, grid, createTestNetworkComps(),
+		MPI_COMM_WORLD);
+	}
+
+	// Write a full checkpoint then two incremental ones, keeping what
+	// can be reconstructed as the monitors do
+	xolotlCore::XFile::TimestepGroup::Concs1DType savedConcs;
+	{
+		xolotlCore::XFile testFile(testFileName,
+		MPI_COMM_WORLD, xolotlCore::XFile::AccessMode::OpenReadWrite);
+		auto concGroup =
+				testFile.getGroup<xolotlCore::XFile::ConcentrationGroup>();
+		BOOST_REQUIRE(concGroup);
+
+		for (int checkpoint = 0; checkpoint < 3; checkpoint++) {
+			auto tsGroup = concGroup->addTimestepGroup(checkpoint, 0.0001,
+					0.00001, 0.000001);
+			xolotlCore::XFile::TimestepGroup::Concs1DType concs;
+			for (int i = 0; i < nGridPointsPerRank; i++) {
+				concs.push_back(makeConcs(baseX + i, checkpoint));
+			}
+
+			if (checkpoint == 0) {
+				tsGroup->writeConcentrations(testFile, baseX, concs);
+				savedConcs = concs;
+				BOOST_REQUIRE(!tsGroup->isDelta());
+				continue;
+			}
+
+			xolotlCore::XFile::TimestepGroup::Concs1DType deltaConcs;
+			for (int i = 0; i < nGridPointsPerRank; i++) {
+				deltaConcs.push_back(
+						xolotlCore::XFile::TimestepGroup::computeDelta(
+								savedConcs[i], concs[i], 1.0e-6));
+				xolotlCore::XFile::TimestepGroup::applyDelta(savedConcs[i],
+						deltaConcs[i]);
+			}
+			tsGroup->writeDeltaConcentrations(testFile, baseX, deltaConcs,
+					checkpoint - 1);
+			BOOST_REQUIRE(tsGroup->isDelta());
+			BOOST_REQUIRE(tsGroup->hasConcentrations());
+		}
+	}
+
+	// Read the last one back, it is reconstructed from the first one
+	{
+		xolotlCore::XFile testFile(testFileName,
+		MPI_COMM_WORLD, xolotlCore::XFile::AccessMode::OpenReadOnly);
+		auto concGroup =
+				testFile.getGroup<xolotlCore::XFile::ConcentrationGroup>();
+		BOOST_REQUIRE(concGroup);
+		auto tsGroup = concGroup->getLastTimestepGroup();
+		BOOST_REQUIRE(tsGroup);
+		auto readConcs = tsGroup->readConcentrations(testFile, baseX,
+				nGridPointsPerRank);
+		BOOST_REQUIRE_EQUAL(readConcs.size(), nGridPointsPerRank);
+		for (int i = 0; i < nGridPointsPerRank; i++) {
+			auto expectedConcs = makeConcs(baseX + i, 2);
+			BOOST_REQUIRE_EQUAL(readConcs[i].size(), expectedConcs.size());
+			BOOST_REQUIRE(readConcs[i] == savedConcs[i]);
+			for (std::size_t l = 0; l < expectedConcs.size(); l++) {
+				BOOST_REQUIRE_EQUAL(readConcs[i][l].first,
+						expectedConcs[l].first);
+				BOOST_REQUIRE_CLOSE(readConcs[i][l].second,
+						expectedConcs[l].second, 0.0001);
+			}
+		}
+	}
+}
+
+/**
+ * Method checking the reduced precision analysis outputs.
+ */
+BOOST_AUTO_TEST_CASE(checkAnalysisPrecision) {
+	using namespace xolotlCore::AnalysisOutput;
+
+	// Determine where we are in the MPI world.
+	int commRank = -1;
+	int commSize = -1;
+	MPI_Comm_rank(MPI_COMM_WORLD, &commRank);
+	MPI_Comm_size(MPI_COMM_WORLD, &commSize);
+
+	BOOST_REQUIRE(toPrecision("log16") == Precision::Log16);
+	BOOST_REQUIRE_EQUAL(toString(toPrecision("float")), "float");
+	BOOST_REQUIRE_THROW(toPrecision("half"), std::string);
+
+	// Values over 30 decades, of both signs
+	double logMin = -30.0, logMax = 0.0;
+	double bound = getErrorBound(Precision::Log16, logMin, logMax);
+	BOOST_REQUIRE(bound < 1.1e-3);
+	BOOST_REQUIRE_EQUAL(encodeLog16(0.0, logMin, logMax), 0);
+	BOOST_REQUIRE_EQUAL(decodeLog16(0, logMin, logMax), 0.0);
+	for (int i = 0; i <= 300; i++) {
+		double value = std::pow(10.0, logMin + 0.1 * i) * (1.0 + 0.37 * (i % 3));
+		value = std::min(value, 1.0);
+		for (double sign : { 1.0, -1.0 }) {
+			auto code = encodeLog16(sign * value, logMin, logMax);
+			double decoded = decodeLog16(code, logMin, logMax);
+			BOOST_REQUIRE(decoded * sign > 0.0);
+			BOOST_REQUIRE(
+					std::fabs(decoded - sign * value) <= bound * value * 1.000001);
+		}
+	}
+
+	// Write a profile with each precision
+	const std::string testFileName = "test_analysis.h5";
+	const int nRowsPerRank = 3;
+	HDF5File::DataSet<double>::DataType2D<2> data(nRowsPerRank);
+	for (int i = 0; i < nRowsPerRank; i++) {
+		data[i][0] = commRank * nRowsPerRank + i;
+		data[i][1] = 1.0e-5 / (data[i][0] + 1.0);
+	}
+	{
+		HDF5File testFile(testFileName,
+				HDF5File::AccessMode::CreateOrTruncateIfExists, MPI_COMM_WORLD,
+				true);
+		for (auto precision : { Precision::Double, Precision::Float,
+				Precision::Log16 }) {
+			writeDataset2D<2>(testFile, MPI_COMM_WORLD, toString(precision),
+					nRowsPerRank * commSize, commRank * nRowsPerRank, data,
+					precision);
+		}
+	}
+
+	// Check the attributes
+	HDF5File testFile(testFileName, HDF5File::AccessMode::OpenReadOnly,
+			MPI_COMM_WORLD, true);
+	for (auto precision : { Precision::Double, Precision::Float,
+			Precision::Log16 }) {
+		HDF5File::DataSet<double> dataset(testFile, toString(precision));
+		HDF5File::Attribute<std::string> precisionAttr(dataset,
+				precisionAttrName);
+		BOOST_REQUIRE_EQUAL(precisionAttr.get(), toString(precision));
+		HDF5File::Attribute<double> errorAttr(dataset, errorBoundAttrName);
+		BOOST_REQUIRE(errorAttr.get() < 1.0e-3);
+	}
+	HDF5File::DataSet<double> log16Dataset(testFile, "log16");
+	HDF5File::Attribute<double> logMinAttr(log16Dataset, logMinAttrName);
+	BOOST_REQUIRE_CLOSE(logMinAttr.get(),
+			std::log10(1.0e-5 / (nRowsPerRank * commSize)), 0.0001);
+	HDF5File::Attribute<double> logMaxAttr(log16Dataset, logMaxAttrName);
+	BOOST_REQUIRE_CLOSE(logMaxAttr.get(),
+			std::log10(nRowsPerRank * commSize - 1.0), 0.0001);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,128 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Regression
+
+#include <boost/test/unit_test.hpp>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <mpi.h>
+#include "xolotlCore/io/TimeSeries.h"
+#include "xolotlCore/io/HDF5File.h"
+#include "tests/utils/MPIFixture.h"
+
+using namespace std;
+using namespace xolotlCore;
+
+// Initialize MPI before running any tests; finalize it running all tests.
+BOOST_GLOBAL_FIXTURE(MPIFixture);
+
+/**
+ * Count the lines of a text file.
+ */
+int countLines(const std::string& fileName) {
+	std::ifstream inputFile(fileName);
+	std::string line;
+	int n = 0;
+	while (std::getline(inputFile, line))
+		n++;
+	return n;
+}
+
+/**
+ * This suite is responsible for testing the TimeSeries class.
+ */
+BOOST_AUTO_TEST_SUITE(TimeSeries_testSuite)
+
+/**
+ * Method checking the buffered text file.
+ */
+BOOST_AUTO_TEST_CASE(checkText) {
+	{
+		TimeSeries series("timeSeriesTest", { "time", "position" },
+				TimeSeries::Format::Text, 3);
+		BOOST_REQUIRE_EQUAL(series.getFileName(), "timeSeriesTest.txt");
+
+		// The file is created empty
+		BOOST_REQUIRE_EQUAL(countLines("timeSeriesTest.txt"), 0);
+
+		// Nothing is written before the third row
+		series.addRow( { 0.0, 1.0 });
+		series.addRow( { 1.0, 1.5 });
+		BOOST_REQUIRE_EQUAL(countLines("timeSeriesTest.txt"), 0);
+		series.addRow( { 2.0, 2.0 });
+		BOOST_REQUIRE_EQUAL(countLines("timeSeriesTest.txt"), 3);
+
+		// A row with a wrong number of values
+		BOOST_REQUIRE_THROW(series.addRow( { 3.0 }), std::string);
+
+		// The last row is written by the destructor
+		series.addRow( { 3.0, 2.5 });
+		BOOST_REQUIRE_EQUAL(series.getNumRows(), 4);
+		BOOST_REQUIRE_EQUAL(countLines("timeSeriesTest.txt"), 3);
+	}
+	BOOST_REQUIRE_EQUAL(countLines("timeSeriesTest.txt"), 4);
+
+	// Check the last line
+	std::ifstream inputFile("timeSeriesTest.txt");
+	std::string line;
+	for (int i = 0; i < 4; i++)
+		std::getline(inputFile, line);
+	std::istringstream lineStream(line);
+	double time = 0.0, position = 0.0;
+	lineStream >> time >> position;
+	BOOST_REQUIRE_CLOSE(time, 3.0, 1.0e-12);
+	BOOST_REQUIRE_CLOSE(position, 2.5, 1.0e-12);
+
+	// An unknown format
+	BOOST_REQUIRE_THROW(TimeSeries::toFormat("csv"), std::string);
+	std::remove("timeSeriesTest.txt");
+}
+
+/**
+ * Method checking the extendable HDF5 dataset.
+ */
+BOOST_AUTO_TEST_CASE(checkHDF5) {
+	std::vector<std::string> columns = { "fluence", "heliumContent",
+			"heliumBottom" };
+	{
+		TimeSeries series("timeSeriesTest", columns,
+				TimeSeries::Format::HDF5, 2);
+		BOOST_REQUIRE_EQUAL(series.getFileName(), "timeSeriesTest.h5");
+		for (int i = 0; i < 5; i++)
+			series.addRow( { (double) i, 2.0 * i, 3.0 * i });
+		TimeSeries::flushAll();
+	}
+
+	// Read the file back
+	HDF5File file("timeSeriesTest.h5", HDF5File::AccessMode::OpenReadOnly,
+	MPI_COMM_SELF, false);
+	hid_t dataSetId = H5Dopen2(file.getId(),
+			TimeSeries::dataSetName.c_str(), H5P_DEFAULT);
+	BOOST_REQUIRE(dataSetId >= 0);
+	hid_t spaceId = H5Dget_space(dataSetId);
+	std::array<hsize_t, 2> dims;
+	H5Sget_simple_extent_dims(spaceId, dims.data(), nullptr);
+	H5Sclose(spaceId);
+	BOOST_REQUIRE_EQUAL(dims[0], 5);
+	BOOST_REQUIRE_EQUAL(dims[1], 3);
+
+	std::vector<double> values(15);
+	H5Dread(dataSetId, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
+			values.data());
+	for (int i = 0; i < 5; i++) {
+		BOOST_REQUIRE_CLOSE(values[3 * i + 1], 2.0 * i, 1.0e-12);
+		BOOST_REQUIRE_CLOSE(values[3 * i + 2], 3.0 * i, 1.0e-12);
+	}
+
+	// The names of the columns
+	{
+		HDF5Object dataSet(TimeSeries::dataSetName, dataSetId);
+		HDF5File::Attribute<std::vector<std::string> > columnsAttr(dataSet,
+				TimeSeries::columnsAttrName);
+		BOOST_REQUIRE(columnsAttr.get() == columns);
+	}
+	H5Dclose(dataSetId);
+	std::remove("timeSeriesTest.h5");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -181,6 +181,43 @@ BOOST_AUTO_TEST_CASE(checkModifiedTrapMutation) {
 	BOOST_REQUIRE_CLOSE(val[4], 5.53624e+14, 0.01);
 	BOOST_REQUIRE_CLOSE(val[5], 5.53624e+14, 0.01);
 
+	// The second grid point of the fourth row is close to the GB
+	nMutating = trapMutationHandler.computePartialsForTrapMutation(*network,
+			valPointer, indicesPointer, 1, 0, 3);
+	BOOST_REQUIRE_EQUAL(nMutating, 4);
+
+	// Move the surface of the fourth row and only update this column
+	surfacePos[3] = 2;
+	trapMutationHandler.updateIndex2D(3, surfacePos[3], advectionHandlers,
+			grid, 0.5, 0, nGrid - 2);
+
+	// The grid point is now on the left side of the surface
+	nMutating = trapMutationHandler.computePartialsForTrapMutation(*network,
+			valPointer, indicesPointer, 1, 0, 3);
+	BOOST_REQUIRE_EQUAL(nMutating, 0);
+
+	// The update must give the same indices as a full initialization
+	DummyTrapMutationHandler fullHandler;
+	fullHandler.initialize(*network, grid, 5, 0.5);
+	fullHandler.initializeIndex2D(surfacePos, *network, advectionHandlers,
+			grid, 5, 0.5);
+	int fullIndices[6 * nHelium];
+	double fullVal[6 * nHelium];
+	int updatedIndices[6 * nHelium];
+	double updatedVal[6 * nHelium];
+	for (int j = 0; j < 5; j++) {
+		for (int i = 0; i < nGrid - 2; i++) {
+			int nFull = fullHandler.computePartialsForTrapMutation(*network,
+					fullVal, fullIndices, i, 0, j);
+			int nUpdated = trapMutationHandler.computePartialsForTrapMutation(
+					*network, updatedVal, updatedIndices, i, 0, j);
+			BOOST_REQUIRE_EQUAL(nUpdated, nFull);
+			for (int n = 0; n < 3 * nFull; n++) {
+				BOOST_REQUIRE_EQUAL(updatedIndices[n], fullIndices[n]);
+			}
+		}
+	}
+
 	// Remove the created file
 	std::string tempFile = "param.txt";
 	std::remove(tempFile.c_str());
@@ -0,0 +1,35 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Regression
+
+#include <string>
+#include <boost/test/included/unit_test.hpp>
+#include "xolotlPerf/dummy/DummyMemoryTracker.h"
+
+using namespace std;
+using namespace xolotlPerf;
+
+/**
+ * This suite is responsible for testing the DummyMemoryTracker.
+ */
+BOOST_AUTO_TEST_SUITE (DummyMemoryTracker_testSuite)
+
+BOOST_AUTO_TEST_CASE(checkName) {
+
+	DummyMemoryTracker tester("test");
+
+	BOOST_REQUIRE_EQUAL("unused", tester.getName());
+}
+
+BOOST_AUTO_TEST_CASE(checkAccounting) {
+
+	DummyMemoryTracker tester("test");
+
+	tester.add(100);
+	tester.sample();
+
+	BOOST_REQUIRE_EQUAL(0U, tester.getValue());
+	BOOST_REQUIRE_EQUAL(0U, tester.getCurrentValue());
+
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,69 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Regression
+
+#include <boost/test/included/unit_test.hpp>
+#include <string>
+#include <vector>
+#include "xolotlPerf/standard/MemoryTracker.h"
+
+using namespace std;
+using namespace xolotlPerf;
+
+/**
+ * This suite is responsible for testing the MemoryTracker.
+ */
+BOOST_AUTO_TEST_SUITE (MemoryTracker_testSuite)
+
+BOOST_AUTO_TEST_CASE(checkName) {
+
+	MemoryTracker tester("test");
+
+	// Require that the name of this MemoryTracker is "test"
+	BOOST_REQUIRE_EQUAL("test", tester.getName());
+}
+
+BOOST_AUTO_TEST_CASE(checkAccounting) {
+
+	MemoryTracker tester("test");
+	BOOST_REQUIRE_EQUAL(0U, tester.getValue());
+
+	// The peak stays when the memory is released
+	tester.add(100);
+	tester.add(50);
+	tester.remove(120);
+	BOOST_REQUIRE_EQUAL(30U, tester.getCurrentValue());
+	BOOST_REQUIRE_EQUAL(150U, tester.getValue());
+
+	// It cannot go below zero
+	tester.remove(100);
+	BOOST_REQUIRE_EQUAL(0U, tester.getCurrentValue());
+	BOOST_REQUIRE_EQUAL(150U, tester.getValue());
+}
+
+BOOST_AUTO_TEST_CASE(checkSampling) {
+
+	MemoryTracker tester("test");
+
+	tester.sample();
+	auto before = tester.getCurrentValue();
+	BOOST_TEST_MESSAGE(
+			"\n" << "MemoryTracker Message: \n" << "resident set size = " << before << "\n");
+	BOOST_REQUIRE(before > 0);
+
+	// Touch 64 MB
+	std::vector<char> buffer(64 * 1024 * 1024, 1);
+	tester.sample();
+	BOOST_REQUIRE(tester.getCurrentValue() > before);
+	auto peak = tester.getValue();
+
+	// The peak stays when the memory is released
+	buffer.clear();
+	buffer.shrink_to_fit();
+	tester.sample();
+	BOOST_REQUIRE_EQUAL(peak, tester.getValue());
+
+	// The one recorded by the operating system
+	BOOST_REQUIRE(MemoryTracker::getPeakResidentSetSize() > 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,105 @@
+#define BOOST_TEST_MODULE Regression
+
+#include <string>
+#include <sstream>
+#include <unistd.h>
+#include <boost/test/included/unit_test.hpp>
+#include "xolotlPerf/trace/RegionTracer.h"
+
+using namespace std;
+namespace xperf = xolotlPerf;
+
+/**
+ * This suite is responsible for testing the RegionTracer.
+ */
+BOOST_AUTO_TEST_SUITE (RegionTracer_testSuite)
+
+BOOST_AUTO_TEST_CASE(checkRegionIds) {
+	int outerId = xperf::RegionTracer::getRegionId("outer");
+	int innerId = xperf::RegionTracer::getRegionId("inner");
+
+	// The same name always gives the same id
+	BOOST_REQUIRE(outerId != innerId);
+	BOOST_REQUIRE_EQUAL(outerId, xperf::RegionTracer::getRegionId("outer"));
+	BOOST_REQUIRE_EQUAL("inner", xperf::RegionTracer::getRegionName(innerId));
+}
+
+BOOST_AUTO_TEST_CASE(checkNesting) {
+	int outerId = xperf::RegionTracer::getRegionId("outer");
+	int innerId = xperf::RegionTracer::getRegionId("inner");
+
+	// Only the first level is recorded as events
+	xperf::RegionTracer tracer(1);
+	tracer.begin(outerId);
+	for (int i = 0; i < 3; i++) {
+		tracer.begin(innerId);
+		usleep(10000);
+		tracer.end();
+	}
+	tracer.end();
+
+	BOOST_REQUIRE_EQUAL(tracer.getNumberOfEvents(), 1);
+	BOOST_REQUIRE_EQUAL(tracer.getNumberOfDroppedEvents(), 0);
+
+	// But all the levels are in the totals
+	BOOST_REQUIRE(tracer.getStepTotal(innerId) >= 0.03);
+	BOOST_REQUIRE(
+			tracer.getStepTotal(outerId) >= tracer.getStepTotal(innerId));
+
+	// The totals are reset by the sample
+	tracer.sampleTimeStep(1, 1.0e-3);
+	BOOST_REQUIRE_EQUAL(tracer.getNumberOfSamples(), 1);
+	BOOST_REQUIRE_EQUAL(tracer.getStepTotal(innerId), 0.0);
+
+	// Leaving a region that was not entered is ignored
+	BOOST_REQUIRE_NO_THROW(tracer.end());
+	BOOST_REQUIRE_EQUAL(tracer.getNumberOfEvents(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(checkWrite) {
+	int outerId = xperf::RegionTracer::getRegionId("outer");
+	int quotedId = xperf::RegionTracer::getRegionId("a \"quoted\" region");
+
+	xperf::RegionTracer tracer(2, 1);
+	tracer.begin(outerId);
+	tracer.begin(quotedId);
+	tracer.end();
+	tracer.end();
+	tracer.sampleTimeStep(4, 2.0);
+
+	// Only one event could be kept
+	BOOST_REQUIRE_EQUAL(tracer.getNumberOfEvents(), 1);
+	BOOST_REQUIRE_EQUAL(tracer.getNumberOfDroppedEvents(), 1);
+
+	std::stringstream output;
+	tracer.write(output, 3);
+	auto trace = output.str();
+	BOOST_REQUIRE(trace.find("\"traceEvents\":[") != std::string::npos);
+	BOOST_REQUIRE(trace.find("\"name\":\"rank 3\"") != std::string::npos);
+	BOOST_REQUIRE(
+			trace.find("\"name\":\"a \\\"quoted\\\" region\",\"ph\":\"X\"")
+					!= std::string::npos);
+	BOOST_REQUIRE(trace.find("\"step\":4") != std::string::npos);
+	BOOST_REQUIRE(trace.find("\"ph\":\"C\"") != std::string::npos);
+	BOOST_REQUIRE_EQUAL(trace.substr(trace.size() - 3), "]}\n");
+}
+
+BOOST_AUTO_TEST_CASE(checkScopedRegion) {
+	int outerId = xperf::RegionTracer::getRegionId("outer");
+
+	// Nothing happens before the tracing is enabled
+	BOOST_REQUIRE(xperf::getRegionTracer() == nullptr);
+	{
+		xperf::ScopedRegion region(outerId);
+	}
+
+	xperf::enableRegionTracing(1);
+	auto tracer = xperf::getRegionTracer();
+	BOOST_REQUIRE(tracer != nullptr);
+	{
+		xperf::ScopedRegion region(outerId);
+	}
+	BOOST_REQUIRE_EQUAL(tracer->getNumberOfEvents(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -124,6 +124,12 @@ BOOST_AUTO_TEST_CASE(aggregateStats) {
 			throw std::runtime_error("Failed to create Timer");
 		}
 
+		std::shared_ptr<xperf::IMemoryTracker> memTracker =
+				reg->getMemoryTracker("testMemory");
+		if (!memTracker) {
+			throw std::runtime_error("Failed to create MemoryTracker");
+		}
+
 		// simulate the timing of some event.
 		BOOST_TEST_MESSAGE("Simulating timed event...");
 		const unsigned int nTimedSeconds = 5;
@@ -140,11 +146,17 @@ BOOST_AUTO_TEST_CASE(aggregateStats) {
 		}
 		BOOST_TEST_MESSAGE("done.");
 
+		// simulate allocations, the peak being larger than the last value
+		const unsigned long nBytes = 1024 * (cwRank + 1);
+		memTracker->add(2 * nBytes);
+		memTracker->remove(nBytes);
+
 		// compute statistics about the program's event counts
 		xperf::PerfObjStatsMap<xperf::ITimer::ValType> timerStats;
 		xperf::PerfObjStatsMap<xperf::IEventCounter::ValType> ctrStats;
 		xperf::PerfObjStatsMap<xperf::IHardwareCounter::CounterType> hwCtrStats;
-		reg->collectStatistics(timerStats, ctrStats, hwCtrStats);
+		xperf::PerfObjStatsMap<xperf::IMemoryTracker::ValType> memStats;
+		reg->collectStatistics(timerStats, ctrStats, hwCtrStats, memStats);
 
 		// Verify the statistics collected.
 		// Only rank 0 does the verification.
@@ -204,6 +216,21 @@ BOOST_AUTO_TEST_CASE(aggregateStats) {
 			BOOST_REQUIRE_EQUAL(ctrStatsObj.max, expMax);
 			BOOST_REQUIRE_CLOSE(ctrStatsObj.average, expAverage, 0.01);
 			BOOST_REQUIRE_CLOSE(ctrStatsObj.stdev, expStdev, 0.01);
+
+			// Then the memory, the peaks of the tracker and the resident
+			// set size of the processes that is added to them
+			BOOST_REQUIRE_EQUAL(memStats.size(), 3U);
+			auto memIter = memStats.find("testMemory");
+			BOOST_REQUIRE(memIter != memStats.end());
+			BOOST_REQUIRE_EQUAL(memIter->second.processCount,
+					(unsigned int )cwSize);
+			BOOST_REQUIRE_EQUAL(memIter->second.min, 2048U);
+			BOOST_REQUIRE_EQUAL(memIter->second.max, 2048U * cwSize);
+
+			memIter = memStats.find("process:peakResidentSetSize");
+			BOOST_REQUIRE(memIter != memStats.end());
+			BOOST_REQUIRE(memIter->second.min > 0);
+			BOOST_REQUIRE(memStats.count("process:residentSetSize") == 1);
 		}
 	} catch (const std::exception& e) {
 		BOOST_TEST_MESSAGE(
@@ -5,6 +5,7 @@
 #include <NEClusterReactionNetwork.h>
 #include <NEClusterNetworkLoader.h>
 #include <NECluster.h>
+#include <NESuperCluster.h>
 #include <DummyHandlerRegistry.h>
 #include <XolotlConfig.h>
 #include <mpi.h>
@@ -13,6 +14,7 @@
 #include "tests/utils/MPIFixture.h"
 #include <fstream>
 #include <iostream>
+#include <algorithm>
 
 using namespace std;
 using namespace xolotlCore;
@@ -200,4 +202,67 @@ BOOST_AUTO_TEST_CASE(checkApplySectional) {
 	return;
 }
 
+/**
+ * This operation checks the grouping with geometrically growing widths.
+ */
+BOOST_AUTO_TEST_CASE(checkApplyGeometricSectional) {
+	// Create the parameter file
+	std::ofstream paramFile("param.txt");
+	paramFile << "netParam=300" << std::endl << "grid=100 0.5" << std::endl;
+	paramFile.close();
+
+	// Create a fake command line to read the options
+	int argc = 0;
+	char **argv;
+	argv = new char*[2];
+	std::string parameterFile = "param.txt";
+	argv[0] = new char[parameterFile.length() + 1];
+	strcpy(argv[0], parameterFile.c_str());
+	argv[1] = 0; // null-terminate the array
+
+	// Read the options
+	Options opts;
+	opts.readParams(argv);
+
+	// Create the loader
+	NEClusterNetworkLoader loader = NEClusterNetworkLoader(
+			std::make_shared<xolotlPerf::DummyHandlerRegistry>());
+	// Set grouping parameters, the widths are 2, 3, 4, 6, 10, 15, 22, ...
+	loader.setXeMin(2);
+	loader.setWidth(2);
+	loader.setWidthRatio(1.5);
+
+	// Generate the network from the options
+	auto network = loader.generate(opts);
+
+	// Xe_1 and 11 super clusters instead of 150 with a constant width
+	int networkSize = network->size();
+	BOOST_REQUIRE_EQUAL(networkSize, 12);
+	int dof = network->getDOF();
+	BOOST_REQUIRE_EQUAL(dof, 24);
+
+	// The groups cover all the sizes from 2 to 300
+	int totalWidth = 0, maxWidth = 0;
+	for (auto const& superMapItem : network->getAll(ReactantType::NESuper)) {
+		auto& cluster = static_cast<NESuperCluster&>(*(superMapItem.second));
+		int width = cluster.getSectionWidth();
+		totalWidth += width;
+		maxWidth = std::max(maxWidth, width);
+
+		// The distance is -1 and 1 at the edges of the group
+		int first = (int) (cluster.getAverage() - (double) width / 2.0) + 1;
+		BOOST_REQUIRE_CLOSE(cluster.getDistance(first), -1.0, 1.0e-10);
+		BOOST_REQUIRE_CLOSE(cluster.getDistance(first + width - 1), 1.0,
+				1.0e-10);
+	}
+	BOOST_REQUIRE_EQUAL(totalWidth, 299);
+	BOOST_REQUIRE_EQUAL(maxWidth, 76);
+
+	// Remove the created file
+	std::string tempFile = "param.txt";
+	std::remove(tempFile.c_str());
+
+	return;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -138,6 +138,21 @@ BOOST_AUTO_TEST_CASE(checkReactants) {
 	auto& heIReactants = psiNetwork->getAll(ReactantType::HeI);
 	BOOST_REQUIRE_EQUAL(36U, heIReactants.size());
 
+	// Every mixed cluster is found from its composition
+	for (auto const& heVMapItem : heVReactants) {
+		auto const& comp = heVMapItem.second->getComposition();
+		BOOST_REQUIRE_EQUAL(heVMapItem.second.get(),
+				psiNetwork->get(ReactantType::PSIMixed, comp));
+	}
+	// Compositions outside of the network are not found
+	IReactant::Composition missingComp;
+	missingComp[toCompIdx(Species::He)] = 9;
+	missingComp[toCompIdx(Species::V)] = 9;
+	BOOST_REQUIRE(!psiNetwork->get(ReactantType::PSIMixed, missingComp));
+	missingComp[toCompIdx(Species::He)] = 100;
+	BOOST_REQUIRE(!psiNetwork->get(ReactantType::PSIMixed, missingComp));
+	BOOST_REQUIRE(!psiNetwork->get(Species::He, 11));
+
 	// Add the required He_1, V_1, I_1 clusters to the network.
 	heCluster = std::unique_ptr<PSIHeCluster>(
 			new PSIHeCluster(1, *(psiNetwork.get()), registry));
@@ -260,4 +275,110 @@ BOOST_AUTO_TEST_CASE(checkArrayOperations) {
 	return;
 }
 
+/**
+ * This operation tests that the rate constants computed from the rate table
+ * follow the changes of the reactant properties.
+ */
+BOOST_AUTO_TEST_CASE(checkRateConstants) {
+	// Local Declarations
+	shared_ptr<ReactionNetwork> network = getSimplePSIReactionNetwork();
+	// Add a grid point for the rates
+	network->addGridPoints(1);
+	double temperature = 1000.0;
+
+	// Make the single helium diffuse slower
+	IReactant& heCluster = *(network->get(Species::He, 1));
+	heCluster.setDiffusionFactor(2.950e+10);
+	heCluster.setMigrationEnergy(0.13);
+
+	// The diffusion coefficients must be the ones of the Arrhenius equation
+	network->setTemperature(temperature, 0);
+	auto reactants = network->getAll();
+	for (IReactant& reactant : reactants) {
+		double diffCoef = reactant.getDiffusionFactor()
+				* exp(-reactant.getMigrationEnergy()
+						/ (xolotlCore::kBoltzmann * temperature));
+		BOOST_REQUIRE_CLOSE(diffCoef, reactant.getDiffusionCoefficient(0),
+				1.0e-10);
+		BOOST_REQUIRE_CLOSE(temperature, reactant.getTemperature(0), 1.0e-10);
+	}
+	double biggestRate = network->getBiggestRate();
+	BOOST_REQUIRE(biggestRate > 0.0);
+
+	// Change the migration energy, the table must be compiled again
+	heCluster.setMigrationEnergy(0.5);
+	network->setTemperature(temperature, 0);
+	double diffCoef = 2.950e+10
+			* exp(-0.5 / (xolotlCore::kBoltzmann * temperature));
+	BOOST_REQUIRE_CLOSE(diffCoef, heCluster.getDiffusionCoefficient(0),
+			1.0e-10);
+
+	// The same value as the one computed by the reactant itself
+	heCluster.setTemperature(temperature, 0);
+	BOOST_REQUIRE_CLOSE(diffCoef, heCluster.getDiffusionCoefficient(0),
+			1.0e-10);
+
+	return;
+}
+
+/**
+ * This operation checks that the negligible dissociations are pruned at low
+ * temperature and activated again when the temperature rises.
+ */
+BOOST_AUTO_TEST_CASE(checkDissociationPruning) {
+	// Local Declarations
+	shared_ptr<ReactionNetwork> network = getSimplePSIReactionNetwork();
+	// Add a grid point for the rates
+	network->addGridPoints(1);
+
+	// Without pruning everything is active
+	network->setTemperature(300.0, 0);
+	BOOST_REQUIRE_CLOSE(network->getActiveDissociationFraction(), 1.0,
+			1.0e-10);
+
+	// The dissociations are negligible at low temperature
+	network->setPruningThreshold(1.0e-6);
+	network->setTemperature(300.0, 0);
+	double lowFraction = network->getActiveDissociationFraction();
+	BOOST_REQUIRE(lowFraction < 1.0);
+	BOOST_REQUIRE(lowFraction >= 0.0);
+
+	// More of them are active at high temperature
+	network->setTemperature(3000.0, 0);
+	double highFraction = network->getActiveDissociationFraction();
+	BOOST_REQUIRE(highFraction >= lowFraction);
+
+	// And they are pruned again when it cools down
+	network->setTemperature(300.0, 0);
+	BOOST_REQUIRE_CLOSE(network->getActiveDissociationFraction(), lowFraction,
+			1.0e-10);
+
+	// Switching the pruning off activates everything
+	network->setPruningThreshold(0.0);
+	network->setTemperature(300.0, 0);
+	BOOST_REQUIRE_CLOSE(network->getActiveDissociationFraction(), 1.0,
+			1.0e-10);
+
+	return;
+}
+
+/**
+ * This operation checks the number of reactions of the network.
+ */
+BOOST_AUTO_TEST_CASE(checkReactionCounts) {
+	// Local Declarations
+	shared_ptr<ReactionNetwork> network = getSimplePSIReactionNetwork();
+
+	// The connectivity is created with the network
+	BOOST_REQUIRE_EQUAL(network->getNumProductionReactions(), 1875);
+	BOOST_REQUIRE_EQUAL(network->getNumDissociationReactions(), 611);
+
+	// Through the interface too
+	IReactionNetwork& iNetwork = *network;
+	BOOST_REQUIRE_EQUAL(iNetwork.getNumProductionReactions(),
+			network->getNumProductionReactions());
+
+	return;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -327,6 +327,82 @@ BOOST_AUTO_TEST_CASE(checkGetConcentrations) {
 	return;
 }
 
+/**
+ * This operation checks that the PSISuperCluster can use its coefficients
+ * from shared memory.
+ */
+BOOST_AUTO_TEST_CASE(checkSharedCoefficients) {
+	// Create the parameter file
+	std::ofstream paramFile("param.txt");
+	paramFile << "netParam=8 0 0 5 0" << std::endl << "grid=100 0.5"
+	<< std::endl;
+	paramFile.close();
+
+	// Create a fake command line to read the options
+	int argc = 0;
+	char **argv;
+	argv = new char*[2];
+	std::string parameterFile = "param.txt";
+	argv[0] = new char[parameterFile.length() + 1];
+	strcpy(argv[0], parameterFile.c_str());
+	argv[1] = 0; // null-terminate the array
+
+	// Read the options
+	Options opts;
+	opts.readParams(argv);
+
+	// Create the loader
+	PSIClusterNetworkLoader loader = PSIClusterNetworkLoader(
+			std::make_shared<xolotlPerf::DummyHandlerRegistry>());
+	// Set grouping parameters
+	loader.setVMin(4);
+	loader.setWidth(4, 0);
+	loader.setWidth(1, 3);
+
+	// Generate the network from the options
+	auto network = loader.generate(opts);
+	// Add a grid point for the rates
+	network->addGridPoints(1);
+
+	// Set the temperature in the network
+	double temperature = 1000.0;
+	network->setTemperature(temperature, 0);
+	// Recompute Ids and network size and redefine the connectivities
+	network->reinitializeConnectivities();
+
+	// Get the super cluster and set the concentrations
+	auto& cluster = network->getAll(ReactantType::PSISuper).begin()->second;
+	for (IReactant& currReactant : network->getAll()) {
+		currReactant.setConcentration(0.1);
+	}
+	double flux = cluster->getTotalFlux(0);
+
+	// Use shared memory for its coefficients
+	std::size_t nCoefs = cluster->getNumCoefficients();
+	BOOST_REQUIRE(nCoefs > 0);
+	std::vector<double> shared(nCoefs);
+	BOOST_REQUIRE_EQUAL(cluster->useSharedCoefficients(shared.data(), true),
+			nCoefs);
+	BOOST_REQUIRE_EQUAL(cluster->getTotalFlux(0), flux);
+
+	// Different coefficients are not used
+	std::vector<double> other(nCoefs, -1.0);
+	BOOST_REQUIRE_EQUAL(cluster->useSharedCoefficients(other.data(), false),
+			0);
+	BOOST_REQUIRE_EQUAL(cluster->getTotalFlux(0), flux);
+
+	// The same ones are
+	std::vector<double> copy(shared);
+	BOOST_REQUIRE_EQUAL(cluster->useSharedCoefficients(copy.data(), false),
+			nCoefs);
+	BOOST_REQUIRE_EQUAL(cluster->getTotalFlux(0), flux);
+
+	// Alone on its node, a process keeps its own coefficients
+	BOOST_REQUIRE_EQUAL(network->shareCoefficients(MPI_COMM_SELF), 0);
+
+	return;
+}
+
 /**
  * This operation checks the boundary methods for PSISuperCluster.
  */
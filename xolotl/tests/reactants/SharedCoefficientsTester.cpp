@@ -0,0 +1,151 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Regression
+
+#include <boost/test/unit_test.hpp>
+#include <PSIClusterNetworkLoader.h>
+#include <DummyHandlerRegistry.h>
+#include <xolotlPerf.h>
+#include <Options.h>
+#include "tests/utils/MPIFixture.h"
+#include <fstream>
+#include <iostream>
+#include <mpi.h>
+
+using namespace std;
+using namespace xolotlCore;
+
+// Initialize MPI before running any tests; finalize it running all tests.
+BOOST_GLOBAL_FIXTURE(MPIFixture);
+
+/**
+ * Generate the same small network on every process.
+ *
+ * @param registry The performance handler registry of the network
+ * @return The network
+ */
+static std::unique_ptr<IReactionNetwork> generateNetwork(
+		std::shared_ptr<xolotlPerf::IHandlerRegistry> registry) {
+	// Create the parameter file once
+	int procId;
+	MPI_Comm_rank(MPI_COMM_WORLD, &procId);
+	if (procId == 0) {
+		std::ofstream paramFile("param.txt");
+		paramFile << "netParam=8 0 0 5 0" << std::endl << "grid=100 0.5"
+				<< std::endl;
+		paramFile.close();
+	}
+	MPI_Barrier(MPI_COMM_WORLD);
+
+	// Create a fake command line to read the options
+	char **argv;
+	argv = new char*[2];
+	std::string parameterFile = "param.txt";
+	argv[0] = new char[parameterFile.length() + 1];
+	strcpy(argv[0], parameterFile.c_str());
+	argv[1] = 0; // null-terminate the array
+
+	// Read the options
+	Options opts;
+	opts.readParams(argv);
+
+	// Create the loader
+	PSIClusterNetworkLoader loader = PSIClusterNetworkLoader(registry);
+	// Set grouping parameters
+	loader.setVMin(4);
+	loader.setWidth(4, 0);
+	loader.setWidth(1, 3);
+
+	// Generate the network from the options
+	auto network = loader.generate(opts);
+	// Add a grid point for the rates
+	network->addGridPoints(1);
+	network->setTemperature(1000.0, 0);
+	// Recompute Ids and network size and redefine the connectivities
+	network->reinitializeConnectivities();
+
+	return network;
+}
+
+/**
+ * Get the number of coefficients of all the reactants of a network.
+ *
+ * @param network The network
+ * @return The number of coefficients
+ */
+static std::size_t getNumCoefficients(const IReactionNetwork& network) {
+	std::size_t nCoefs = 0;
+	for (IReactant const& currReactant : network.getAll()) {
+		nCoefs += currReactant.getNumCoefficients();
+	}
+	return nCoefs;
+}
+
+/**
+ * This suite is responsible for testing the sharing of the reaction
+ * coefficients between the processes of a node. Run on a single process
+ * nothing is shared, it has to be run on several processes of a node to
+ * check the sharing itself.
+ */
+BOOST_AUTO_TEST_SUITE(SharedCoefficients_testSuite)
+
+/**
+ * This operation checks that the network records the number of
+ * coefficients it shares.
+ */
+BOOST_AUTO_TEST_CASE(checkNumShared) {
+	auto network = generateNetwork(
+			std::make_shared<xolotlPerf::DummyHandlerRegistry>());
+	std::size_t nCoefs = getNumCoefficients(*network);
+	BOOST_REQUIRE(nCoefs > 0);
+	BOOST_REQUIRE_EQUAL(network->getNumSharedCoefficients(), 0);
+
+	// The processes of the node
+	MPI_Comm nodeComm;
+	MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0,
+			MPI_INFO_NULL, &nodeComm);
+	int nodeRank, nodeSize;
+	MPI_Comm_rank(nodeComm, &nodeRank);
+	MPI_Comm_size(nodeComm, &nodeSize);
+	MPI_Comm_free(&nodeComm);
+
+	// The first process of the node keeps its coefficients, the other ones
+	// read all of them from its memory
+	std::size_t nShared = network->shareCoefficients(MPI_COMM_WORLD);
+	BOOST_REQUIRE_EQUAL(nShared, (nodeRank > 0) ? nCoefs : 0);
+	BOOST_REQUIRE_EQUAL(network->getNumSharedCoefficients(), nShared);
+
+	// Sharing again does nothing
+	BOOST_REQUIRE_EQUAL(network->shareCoefficients(MPI_COMM_WORLD), 0);
+	BOOST_REQUIRE_EQUAL(network->getNumSharedCoefficients(), nShared);
+
+	return;
+}
+
+/**
+ * This operation checks that the memory tracker of the coefficients only
+ * counts the ones the process stores.
+ */
+BOOST_AUTO_TEST_CASE(checkTrackedCoefficients) {
+	xolotlPerf::initialize(xolotlPerf::IHandlerRegistry::std);
+	auto registry = xolotlPerf::getHandlerRegistry();
+	auto network = generateNetwork(registry);
+	std::size_t nCoefs = getNumCoefficients(*network);
+	auto tracker = registry->getMemoryTracker("network:coefficients");
+
+	// All the coefficients before sharing them
+	network->trackMemory();
+	auto before = tracker->getCurrentValue();
+	BOOST_REQUIRE_EQUAL(before, nCoefs * sizeof(double));
+
+	// Only the ones that are not shared after
+	std::size_t nShared = network->shareCoefficients(MPI_COMM_WORLD);
+	network->trackMemory();
+	auto after = tracker->getCurrentValue();
+	BOOST_REQUIRE_EQUAL(after, (nCoefs - nShared) * sizeof(double));
+	if (nShared > 0)
+		BOOST_REQUIRE(after < before);
+
+	return;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -24,6 +24,7 @@
 #include <IReactionHandlerFactory.h>
 #include <VizHandlerRegistryFactory.h>
 #include <cassert>
+#include <sstream>
 
 using namespace std;
 using namespace xolotlCore;
@@ -584,4 +585,172 @@ BOOST_AUTO_TEST_CASE(checkPetscSolver2DHandler) {
 //	std::remove(tempFile.c_str());
 //}
 
+/**
+ * This operation checks the load-aware split of the grid in the depth
+ * direction.
+ */
+BOOST_AUTO_TEST_CASE(checkBalancedRanges) {
+	// Uniform costs are split evenly
+	std::vector<double> costs(12, 1.0);
+	auto ranges = xolotlSolver::PetscSolverHandler::ComputeBalancedRanges(
+			costs, 4);
+	BOOST_REQUIRE_EQUAL(ranges.size(), 4);
+	for (auto size : ranges) {
+		BOOST_REQUIRE_EQUAL(size, 3);
+	}
+
+	// Cheap points on the left of the surface, expensive ones on the right
+	costs.assign(12, 0.1);
+	for (int i = 8; i < 12; i++) {
+		costs[i] = 1.0;
+	}
+	ranges = xolotlSolver::PetscSolverHandler::ComputeBalancedRanges(costs,
+			4);
+	BOOST_REQUIRE_EQUAL(ranges.size(), 4);
+	BOOST_REQUIRE_EQUAL(ranges[0], 8);
+	BOOST_REQUIRE_EQUAL(ranges[1], 1);
+	BOOST_REQUIRE_EQUAL(ranges[2], 1);
+	BOOST_REQUIRE_EQUAL(ranges[3], 2);
+
+	// Every range gets at least one point
+	costs.assign(4, 0.0);
+	costs[0] = 10.0;
+	ranges = xolotlSolver::PetscSolverHandler::ComputeBalancedRanges(costs,
+			4);
+	for (auto size : ranges) {
+		BOOST_REQUIRE_EQUAL(size, 1);
+	}
+
+	// Not enough points
+	BOOST_REQUIRE_THROW(
+			xolotlSolver::PetscSolverHandler::ComputeBalancedRanges(costs, 5),
+			std::string);
+}
+
+/**
+ * This operation checks the refinement and coarsening of the 1D grid and the
+ * conservation of the remapping.
+ */
+BOOST_AUTO_TEST_CASE(checkAdaptedGrid) {
+	// A regular grid with the surface at 1 and a step in the middle
+	std::vector<double> positions, indicator;
+	for (int i = 0; i < 10; i++) {
+		positions.push_back((double) i);
+		indicator.push_back((i < 5) ? 1.0 : 0.0);
+	}
+	auto newPositions =
+			xolotlSolver::PetscSolver1DHandler::ComputeAdaptedGrid(positions,
+					indicator, 1, 0.5, 0.05, 0.1);
+
+	// 0, 1, 2 are kept, 3 is removed, 4, 4.5, 5 are kept, 6 is removed,
+	// 7 is kept, 8 is removed, 9 is kept
+	std::vector<double> expected = { 0.0, 1.0, 2.0, 4.0, 4.5, 5.0, 7.0, 9.0 };
+	BOOST_REQUIRE_EQUAL(newPositions.size(), expected.size());
+	for (std::size_t i = 0; i < expected.size(); i++) {
+		BOOST_REQUIRE_CLOSE(newPositions[i], expected[i], 1.0e-10);
+	}
+
+	// The remapping conserves the integral of the solution
+	std::vector<double> values;
+	for (int i = 0; i < 10; i++) {
+		values.push_back(1.0 + (double) (i * i));
+	}
+	auto weights = xolotlSolver::PetscSolver1DHandler::ComputeRemapWeights(
+			positions, newPositions);
+	BOOST_REQUIRE_EQUAL(weights.size(), newPositions.size());
+	auto cellWidth = [](const std::vector<double>& pos, std::size_t i) {
+		double lower = (i == 0) ? pos[0] : 0.5 * (pos[i - 1] + pos[i]);
+		double upper =
+				(i == pos.size() - 1) ? pos[i] : 0.5 * (pos[i] + pos[i + 1]);
+		return upper - lower;
+	};
+	double oldIntegral = 0.0, newIntegral = 0.0;
+	for (std::size_t i = 0; i < positions.size(); i++) {
+		oldIntegral += values[i] * cellWidth(positions, i);
+	}
+	for (std::size_t i = 0; i < newPositions.size(); i++) {
+		double value = 0.0, sum = 0.0;
+		for (auto const& weight : weights[i]) {
+			value += weight.second * values[weight.first];
+			sum += weight.second;
+		}
+		BOOST_REQUIRE_CLOSE(sum, 1.0, 1.0e-10);
+		newIntegral += value * cellWidth(newPositions, i);
+	}
+	BOOST_REQUIRE_CLOSE(newIntegral, oldIntegral, 1.0e-10);
+
+	// The grids have to span the same interval
+	newPositions.back() = 10.0;
+	BOOST_REQUIRE_THROW(
+			xolotlSolver::PetscSolver1DHandler::ComputeRemapWeights(positions,
+					newPositions), std::string);
+}
+
+/**
+ * This operation checks when a grid point is skipped with -activity_threshold,
+ * and that it becomes active again when a concentration crosses the threshold.
+ */
+BOOST_AUTO_TEST_CASE(checkActivityThreshold) {
+	// Two clusters and the temperature at the middle, left, and right points
+	const int dof = 3;
+	const double threshold = 1.0e-12;
+	double middle[dof] = { 1.0e-13, 0.0, 1000.0 };
+	double left[dof] = { 0.0, -1.0e-13, 1000.0 };
+	double right[dof] = { 0.0, 0.0, 1000.0 };
+	double *concVector[3] = { middle, left, right };
+
+	// Everything is below the threshold, the temperature does not count
+	BOOST_REQUIRE(
+			xolotlSolver::PetscSolver1DHandler::IsQuiet(concVector, dof,
+					threshold));
+
+	// A cluster grows above the threshold at the point itself
+	middle[1] = 2.0e-12;
+	BOOST_REQUIRE(
+			!xolotlSolver::PetscSolver1DHandler::IsQuiet(concVector, dof,
+					threshold));
+
+	// It goes back below, the point is skipped again
+	middle[1] = 5.0e-13;
+	BOOST_REQUIRE(
+			xolotlSolver::PetscSolver1DHandler::IsQuiet(concVector, dof,
+					threshold));
+
+	// Diffusion brings something from a neighbor, negative values count too
+	right[0] = -2.0e-12;
+	BOOST_REQUIRE(
+			!xolotlSolver::PetscSolver1DHandler::IsQuiet(concVector, dof,
+					threshold));
+}
+
+/**
+ * This operation checks the reading of the systems of an ensemble run.
+ */
+BOOST_AUTO_TEST_CASE(checkEnsembleSamples) {
+	std::stringstream input;
+	input << "# temperature flux energy" << std::endl << "1000.0" << std::endl
+			<< std::endl << "  900.0 2.0" << std::endl << "800.0 0.5 -0.1"
+			<< std::endl;
+	auto samples = xolotlSolver::PetscSolver0DHandler::ReadEnsembleSamples(
+			input);
+
+	BOOST_REQUIRE_EQUAL(samples.size(), 3);
+	BOOST_REQUIRE_CLOSE(samples[0].temperature, 1000.0, 1.0e-10);
+	BOOST_REQUIRE_CLOSE(samples[0].fluxFactor, 1.0, 1.0e-10);
+	BOOST_REQUIRE_SMALL(samples[0].energyShift, 1.0e-16);
+	BOOST_REQUIRE_CLOSE(samples[1].temperature, 900.0, 1.0e-10);
+	BOOST_REQUIRE_CLOSE(samples[1].fluxFactor, 2.0, 1.0e-10);
+	BOOST_REQUIRE_SMALL(samples[1].energyShift, 1.0e-16);
+	BOOST_REQUIRE_CLOSE(samples[2].temperature, 800.0, 1.0e-10);
+	BOOST_REQUIRE_CLOSE(samples[2].fluxFactor, 0.5, 1.0e-10);
+	BOOST_REQUIRE_CLOSE(samples[2].energyShift, -0.1, 1.0e-10);
+
+	// A line without temperature
+	std::stringstream badInput;
+	badInput << "hot" << std::endl;
+	BOOST_REQUIRE_THROW(
+			xolotlSolver::PetscSolver0DHandler::ReadEnsembleSamples(badInput),
+			std::string);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,116 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Regression
+
+#include <boost/test/unit_test.hpp>
+#include <SparseLU.h>
+#include <vector>
+
+using namespace std;
+using namespace xolotlSolver;
+
+/**
+ * The test suite configuration
+ */
+BOOST_AUTO_TEST_SUITE (SparseLUTester_testSuite)
+
+/**
+ * This operation checks the symbolic factorization, including the fill-in.
+ */
+BOOST_AUTO_TEST_CASE(checkSymbolic) {
+	// The pattern of the matrix
+	// x x . x
+	// x x x .
+	// . x x .
+	// x . . x
+	vector<vector<int> > pattern = { { 0, 1, 3 }, { 0, 1, 2 }, { 1, 2 },
+			{ 0, 3 } };
+
+	SparseLU lu;
+	lu.symbolic(4, pattern);
+
+	BOOST_REQUIRE_EQUAL(lu.size(), 4);
+	// Row 1 gets (1, 3) from row 0, row 2 gets (2, 3) from row 1, and row 3
+	// gets (3, 1) and (3, 2)
+	BOOST_REQUIRE_EQUAL(lu.getNumberOfNonZeros(), 14);
+	BOOST_REQUIRE(lu.find(1, 3) >= 0);
+	BOOST_REQUIRE(lu.find(2, 3) >= 0);
+	BOOST_REQUIRE(lu.find(3, 1) >= 0);
+	BOOST_REQUIRE(lu.find(3, 2) >= 0);
+	BOOST_REQUIRE_EQUAL(lu.find(0, 2), -1);
+	BOOST_REQUIRE_EQUAL(lu.find(2, 0), -1);
+}
+
+/**
+ * This operation checks the numeric factorization and the solve.
+ */
+BOOST_AUTO_TEST_CASE(checkSolve) {
+	// The matrix
+	// 4 1 0 1
+	// 1 4 1 0
+	// 0 1 4 0
+	// 1 0 0 4
+	vector<vector<int> > pattern = { { 0, 1, 3 }, { 0, 1, 2 }, { 1, 2 },
+			{ 0, 3 } };
+	vector<vector<double> > values = { { 4.0, 1.0, 1.0 }, { 1.0, 4.0, 1.0 }, {
+			1.0, 4.0 }, { 1.0, 4.0 } };
+
+	SparseLU lu;
+	lu.symbolic(4, pattern);
+
+	// Fill the value array
+	vector<double> vals(lu.getNumberOfNonZeros(), 0.0);
+	for (int i = 0; i < 4; i++) {
+		for (std::size_t j = 0; j < pattern[i].size(); j++) {
+			vals[lu.find(i, pattern[i][j])] = values[i][j];
+		}
+	}
+	BOOST_REQUIRE(lu.factor(vals.data()));
+
+	// The right hand side for the solution 1, 2, 3, 4
+	vector<double> x = { 10.0, 12.0, 14.0, 17.0 };
+	lu.solve(vals.data(), x.data());
+
+	BOOST_REQUIRE_CLOSE(x[0], 1.0, 1.0e-10);
+	BOOST_REQUIRE_CLOSE(x[1], 2.0, 1.0e-10);
+	BOOST_REQUIRE_CLOSE(x[2], 3.0, 1.0e-10);
+	BOOST_REQUIRE_CLOSE(x[3], 4.0, 1.0e-10);
+
+	// The same factors can be used again
+	x = { 4.0, 1.0, 0.0, 1.0 };
+	lu.solve(vals.data(), x.data());
+
+	BOOST_REQUIRE_CLOSE(x[0], 1.0, 1.0e-10);
+	BOOST_REQUIRE_SMALL(x[1], 1.0e-12);
+	BOOST_REQUIRE_SMALL(x[2], 1.0e-12);
+	BOOST_REQUIRE_SMALL(x[3], 1.0e-12);
+}
+
+/**
+ * This operation checks that the factorization fails on a zero pivot
+ * instead of dividing by it, the LU not pivoting.
+ */
+BOOST_AUTO_TEST_CASE(checkZeroPivot) {
+	// The matrix
+	// 0 1
+	// 1 0
+	vector<vector<int> > pattern = { { 0, 1 }, { 0, 1 } };
+
+	SparseLU lu;
+	lu.symbolic(2, pattern);
+
+	vector<double> vals(lu.getNumberOfNonZeros(), 0.0);
+	vals[lu.find(0, 1)] = 1.0;
+	vals[lu.find(1, 0)] = 1.0;
+	BOOST_REQUIRE(!lu.factor(vals.data()));
+
+	// A tiny pivot compared to the rest of its row fails too
+	vals[lu.find(0, 0)] = 1.0e-15;
+	BOOST_REQUIRE(!lu.factor(vals.data()));
+
+	// A well conditioned block is factorized
+	vals[lu.find(0, 0)] = 2.0;
+	vals[lu.find(1, 1)] = 2.0;
+	BOOST_REQUIRE(lu.factor(vals.data()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
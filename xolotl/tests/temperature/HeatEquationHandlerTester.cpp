@@ -137,4 +137,44 @@ BOOST_AUTO_TEST_CASE(checkHeat) {
 	MPI_Finalize();
 }
 
+/**
+ * Method checking the heat equation when it is solved on its own.
+ */
+BOOST_AUTO_TEST_CASE(checkSplitHeat) {
+	// Create the heat handler
+	HeatEquationHandler heatHandler = HeatEquationHandler(5.0e-12, 1000.0);
+	heatHandler.setHeatCoefficient(xolotlCore::tungstenHeatCoefficient);
+	heatHandler.setHeatConductivity(xolotlCore::tungstenHeatConductivity);
+	heatHandler.setOperatorSplit(true);
+	BOOST_REQUIRE(heatHandler.isOperatorSplit());
+
+	// The size parameter in the x direction
+	double hx = 1.0;
+
+	// The temperatures at the left, middle, and right grid points,
+	// the same as the ones of the coupled case
+	double temperature[3] = { 81.0, 361.0, 841.0 };
+	double newTemperature[3] = { 0.0, 0.0, 0.0 };
+	double *tempVector[3];
+	tempVector[0] = &temperature[1]; // middle
+	tempVector[1] = &temperature[0]; // left
+	tempVector[2] = &temperature[2]; // right
+
+	// Nothing happens in the solve of the clusters
+	heatHandler.computeTemperature(tempVector, &newTemperature[1], hx, hx, 1);
+	BOOST_REQUIRE_EQUAL(newTemperature[1], 0.0);
+
+	// Compute the heat equation at this grid point
+	heatHandler.computeSplitTemperature(tempVector, &newTemperature[1], hx, hx,
+			1);
+	BOOST_REQUIRE_CLOSE(newTemperature[1], 1.367e+16, 0.01);
+
+	// Compute the partial derivatives
+	double val[3];
+	heatHandler.computeSplitPartialsForTemperature(val, hx, hx, 1);
+	BOOST_REQUIRE_CLOSE(val[0], -1.367e+14, 0.01);
+	BOOST_REQUIRE_CLOSE(val[1], 6.835e+13, 0.01);
+	BOOST_REQUIRE_CLOSE(val[2], 6.835e+13, 0.01);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,168 @@
+#define BOOST_TEST_MODULE Regression
+
+#include <boost/test/included/unit_test.hpp>
+#include <AsyncPlot.h>
+#include <AsyncRenderer.h>
+#include <DummyPlot.h>
+#include <CvsXDataProvider.h>
+#include <LabelProvider.h>
+#include <mutex>
+#include <condition_variable>
+
+using namespace std;
+using namespace xolotlViz;
+
+/**
+ * What the RecordingPlot saw when it was written.
+ */
+struct Frame {
+	string fileName;
+	string title;
+	string dataName;
+	vector<double> values;
+};
+
+/**
+ * A plot that records what it renders instead of rendering it.
+ */
+class RecordingPlot: public DummyPlot {
+public:
+
+	shared_ptr<vector<Frame> > frames;
+
+	RecordingPlot(shared_ptr<vector<Frame> > _frames) :
+			DummyPlot("recording"), frames(_frames) {
+	}
+
+	void write(const std::string& fileName) {
+		Frame frame;
+		frame.fileName = fileName;
+		frame.title = plotLabelProvider->titleLabel;
+		frame.dataName = getDataProvider()->getDataName();
+		frame.values = getDataProvider()->getAxis2Vector();
+		// Only the rendering thread writes here
+		frames->push_back(frame);
+	}
+};
+
+/**
+ * This suite is responsible for testing the AsyncPlot and AsyncRenderer classes.
+ */
+BOOST_AUTO_TEST_SUITE(AsyncPlot_testSuite)
+
+/**
+ * Method checking that the frames are rendered with the data they had when
+ * they were written, even if the providers are modified right after.
+ */
+BOOST_AUTO_TEST_CASE(checkSnapshot) {
+	auto frames = make_shared<vector<Frame> >();
+	auto renderer = make_shared<AsyncRenderer>(10);
+	auto plot = make_shared<AsyncPlot>("myPlot",
+			[frames]() {return make_shared<RecordingPlot>(frames);}, renderer);
+
+	BOOST_REQUIRE_EQUAL("myPlot", plot->getName());
+
+	// Set the providers
+	auto labelProvider = make_shared<LabelProvider>("labelProvider");
+	plot->setLabelProvider(labelProvider);
+	auto dataProvider = make_shared<CvsXDataProvider>("dataProvider");
+	plot->setDataProvider(dataProvider);
+
+	// Write two frames, changing everything in between
+	for (int i = 0; i < 2; i++) {
+		auto points = make_shared<vector<Point> >();
+		Point aPoint;
+		aPoint.value = (double) i + 1.0;
+		aPoint.x = 1.0;
+		points->push_back(aPoint);
+		plot->getDataProvider()->setPoints(points);
+		plot->getDataProvider()->setDataName("data" + to_string(i));
+		plot->plotLabelProvider->titleLabel = "title" + to_string(i);
+		plot->write("frame" + to_string(i) + ".png");
+
+		// Modify the points in place after writing
+		(*points)[0].value = 100.0;
+	}
+
+	// Wait for the rendering
+	renderer->flush();
+
+	BOOST_REQUIRE_EQUAL(renderer->getNumberOfRenderedFrames(), 2);
+	BOOST_REQUIRE_EQUAL(renderer->getNumberOfDroppedFrames(), 0);
+	BOOST_REQUIRE_EQUAL(frames->size(), 2);
+	for (int i = 0; i < 2; i++) {
+		BOOST_REQUIRE_EQUAL(frames->at(i).fileName,
+				"frame" + to_string(i) + ".png");
+		BOOST_REQUIRE_EQUAL(frames->at(i).title, "title" + to_string(i));
+		BOOST_REQUIRE_EQUAL(frames->at(i).dataName, "data" + to_string(i));
+		BOOST_REQUIRE_EQUAL(frames->at(i).values.size(), 1);
+		BOOST_REQUIRE_CLOSE(frames->at(i).values[0], (double) i + 1.0, 1.0e-10);
+	}
+}
+
+/**
+ * Method checking that the frames are dropped when the queue is full.
+ */
+BOOST_AUTO_TEST_CASE(checkBackpressure) {
+	AsyncRenderer renderer(2);
+
+	// Block the rendering thread
+	mutex gateMutex;
+	condition_variable gateCond;
+	bool started = false, open = false;
+	BOOST_REQUIRE(renderer.push([&]() {
+		unique_lock<mutex> lock(gateMutex);
+		started = true;
+		gateCond.notify_all();
+		gateCond.wait(lock, [&] {return open;});
+	}));
+
+	// Wait for the first task to be taken out of the queue
+	{
+		unique_lock<mutex> lock(gateMutex);
+		gateCond.wait(lock, [&] {return started;});
+	}
+
+	// Two tasks fit in the queue, the next ones are dropped
+	int count = 0;
+	BOOST_REQUIRE(renderer.push([&]() {count++;}));
+	BOOST_REQUIRE(renderer.push([&]() {count++;}));
+	BOOST_REQUIRE(!renderer.push([&]() {count++;}));
+	BOOST_REQUIRE(!renderer.push([&]() {count++;}));
+
+	// Let the rendering continue
+	{
+		lock_guard<mutex> lock(gateMutex);
+		open = true;
+	}
+	gateCond.notify_all();
+	renderer.flush();
+
+	BOOST_REQUIRE_EQUAL(count, 2);
+	BOOST_REQUIRE_EQUAL(renderer.getNumberOfRenderedFrames(), 3);
+	BOOST_REQUIRE_EQUAL(renderer.getNumberOfDroppedFrames(), 2);
+}
+
+/**
+ * Method checking that the shutdown renders the queued frames and drops the
+ * later ones.
+ */
+BOOST_AUTO_TEST_CASE(checkShutdown) {
+	AsyncRenderer renderer(10);
+
+	int count = 0;
+	for (int i = 0; i < 3; i++) {
+		BOOST_REQUIRE(renderer.push([&]() {count++;}));
+	}
+	renderer.shutdown();
+	BOOST_REQUIRE_EQUAL(count, 3);
+	BOOST_REQUIRE_EQUAL(renderer.getNumberOfRenderedFrames(), 3);
+
+	// Nothing is rendered anymore, shutting down again does nothing
+	BOOST_REQUIRE(!renderer.push([&]() {count++;}));
+	renderer.shutdown();
+	BOOST_REQUIRE_EQUAL(count, 3);
+	BOOST_REQUIRE_EQUAL(renderer.getNumberOfDroppedFrames(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
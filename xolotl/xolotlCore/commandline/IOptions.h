@@ -297,6 +297,21 @@ public:
 	 */
 	virtual void setVizStandardHandlers(bool flag) = 0;
 
+	/**
+	 * Should the standard visualization handlers render the plots on a
+	 * background thread instead of blocking the time stepping?
+	 *
+	 * @return true if the plots are rendered asynchronously
+	 */
+	virtual bool useVizAsyncRendering() const = 0;
+
+	/**
+	 * Set the vizAsyncRenderingFlag.
+	 *
+	 * @param flag The value for the vizAsyncRenderingFlag
+	 */
+	virtual void setVizAsyncRendering(bool flag) = 0;
+
 	/**
 	 * Obtain the name of the material to be used for the simulation.
 	 *
@@ -434,6 +449,21 @@ public:
 	 */
 	virtual void setGroupingWidthB(int width) = 0;
 
+	/**
+	 * Obtain the ratio by which the width of the groups grows from one
+	 * group to the next, 1 meaning that all the groups have the same width.
+	 *
+	 * @return The ratio
+	 */
+	virtual double getGroupingRatio() const = 0;
+
+	/**
+	 * Set the ratio by which the width of the groups grows.
+	 *
+	 * @param ratio The ratio
+	 */
+	virtual void setGroupingRatio(double ratio) = 0;
+
 	/**
 	 * Obtain the value of the intensity of the sputtering yield to be used.
 	 *
@@ -2,6 +2,7 @@
 #include <limits>
 #include <fstream>
 #include <TokenizedLineReader.h>
+#include <MPIUtils.h>
 #include <NetworkOptionHandler.h>
 #include <PetscOptionHandler.h>
 #include <ConstTempOptionHandler.h>
@@ -19,6 +20,7 @@
 #include <ProcessOptionHandler.h>
 #include <GrainBoundariesOptionHandler.h>
 #include <GroupingOptionHandler.h>
+#include <GroupingRatioOptionHandler.h>
 #include <SputteringOptionHandler.h>
 #include <NetworkParamOptionHandler.h>
 #include <GridParamOptionHandler.h>
@@ -36,10 +38,11 @@ Options::Options() :
 				""), heatFlag(false), bulkTemperature(0.0), fluxFlag(false), fluxAmplitude(
 				0.0), fluxProfileFlag(false), perfRegistryType(
 				xolotlPerf::IHandlerRegistry::std), vizStandardHandlersFlag(
-				false), materialName(""), initialVConcentration(0.0), voidPortion(
+				false), vizAsyncRenderingFlag(false), materialName(""), initialVConcentration(
+				0.0), voidPortion(
 				50.0), dimensionNumber(1), useRegularGridFlag(true), gbList(""), groupingMin(
 				std::numeric_limits<int>::max()), groupingWidthA(1), groupingWidthB(
-				1), sputteringYield(0.0), useHDF5Flag(true), usePhaseCutFlag(
+				1), groupingRatio(1.0), sputteringYield(0.0), useHDF5Flag(true), usePhaseCutFlag(
 				false), maxImpurity(8), maxD(0), maxT(0), maxV(20), maxI(6), nX(
 				10), nY(0), nZ(0), xStepSize(0.5), yStepSize(0.0), zStepSize(
 				0.0), leftBoundary(1), rightBoundary(1), burstingDepth(10.0),
@@ -79,6 +82,8 @@ Options::Options() :
 	auto gbHandler = new GrainBoundariesOptionHandler();
 	// Create the grouping option handler
 	auto groupingHandler = new GroupingOptionHandler();
+	// Create the grouping ratio option handler
+	auto groupingRatioHandler = new GroupingRatioOptionHandler();
 	// Create the sputtering option handler
 	auto sputteringHandler = new SputteringOptionHandler();
 	// Create the network param option handler
@@ -110,6 +115,7 @@ Options::Options() :
 	optionsMap[procHandler->key] = procHandler;
 	optionsMap[gbHandler->key] = gbHandler;
 	optionsMap[groupingHandler->key] = groupingHandler;
+	optionsMap[groupingRatioHandler->key] = groupingRatioHandler;
 	optionsMap[sputteringHandler->key] = sputteringHandler;
 	optionsMap[netParamHandler->key] = netParamHandler;
 	optionsMap[gridParamHandler->key] = gridParamHandler;
@@ -140,12 +146,11 @@ void Options::readParams(char* argv[]) {
 	// We assume that the name of this file is the first and only
 	// argument.
 
-	// Load the content of the file in a stream
-	// Create the param stream
-	std::shared_ptr<std::ifstream> paramStream;
-	paramStream = std::make_shared<std::ifstream>(argv[0]);
+	// Load the content of the file in a stream, the file is only
+	// read by the first process
+	auto paramStream = xolotlCore::MPIUtils::broadcastFile(argv[0]);
 
-	if (!paramStream->good()) {
+	if (!paramStream || !paramStream->good()) {
 		// The file is empty.
 		std::cerr << "The parameter file is empty. Aborting!" << std::endl;
 		showHelp(std::cerr);
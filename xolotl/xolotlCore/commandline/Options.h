@@ -109,6 +109,11 @@ protected:
 	 */
 	bool vizStandardHandlersFlag;
 
+	/**
+	 * Render the standard plots on a background thread?
+	 */
+	bool vizAsyncRenderingFlag;
+
 	/**
 	 * Name of the material.
 	 */
@@ -159,6 +164,11 @@ protected:
 	 */
 	int groupingWidthB;
 
+	/**
+	 * Growth ratio of the width of the groups.
+	 */
+	double groupingRatio;
+
 	/**
 	 * Value of the sputtering yield.
 	 */
@@ -576,6 +586,22 @@ public:
 		vizStandardHandlersFlag = flag;
 	}
 
+	/**
+	 * Should the plots be rendered on a background thread?
+	 * \see IOptions.h
+	 */
+	bool useVizAsyncRendering() const override {
+		return vizAsyncRenderingFlag;
+	}
+
+	/**
+	 * Set the vizAsyncRenderingFlag.
+	 * \see IOptions.h
+	 */
+	void setVizAsyncRendering(bool flag) override {
+		vizAsyncRenderingFlag = flag;
+	}
+
 	/**
 	 * Obtain the name of the material to be used for simulation.
 	 * \see IOptions.h
@@ -738,6 +764,22 @@ public:
 		groupingWidthB = width;
 	}
 
+	/**
+	 * Obtain the growth ratio of the width of the groups.
+	 * \see IOptions.h
+	 */
+	double getGroupingRatio() const override {
+		return groupingRatio;
+	}
+
+	/**
+	 * Set the growth ratio of the width of the groups.
+	 * \see IOptions.h
+	 */
+	void setGroupingRatio(double ratio) override {
+		groupingRatio = ratio;
+	}
+
 	/**
 	 * Obtain the value of the intensity of the sputtering yield to be used.
 	 * \see IOptions.h
@@ -0,0 +1,59 @@
+#ifndef GROUPINGRATIOOPTIONHANDLER_H
+#define GROUPINGRATIOOPTIONHANDLER_H
+
+// Includes
+#include "OptionHandler.h"
+
+namespace xolotlCore {
+
+/**
+ * GroupingRatioOptionHandler handles the growth ratio of the group widths.
+ */
+class GroupingRatioOptionHandler: public OptionHandler {
+public:
+
+	/**
+	 * The default constructor
+	 */
+	GroupingRatioOptionHandler() :
+			OptionHandler("groupingRatio",
+					"groupingRatio <ratio>             "
+							"This option allows the width of each group to be 'ratio' times "
+							"the width of the previous one (only for NE, 1 by default).\n") {
+	}
+
+	/**
+	 * The destructor
+	 */
+	~GroupingRatioOptionHandler() {
+	}
+
+	/**
+	 * This method will set the IOptions groupingRatio
+	 * to the value given as the argument.
+	 *
+	 * @param opt The pointer to the option that will be modified.
+	 * @param arg The ratio.
+	 */
+	bool handler(IOptions *opt, const std::string& arg) {
+		// Convert to double
+		double ratio = strtod(arg.c_str(), NULL);
+		// The widths can't decrease
+		if (ratio < 1.0) {
+			std::cerr << "\nThe grouping ratio must be at least 1." << std::endl;
+			opt->setShouldRunFlag(false);
+			opt->setExitCode(EXIT_FAILURE);
+			return false;
+		}
+		// Set the ratio
+		opt->setGroupingRatio(ratio);
+
+		return true;
+	}
+
+};
+//end class GroupingRatioOptionHandler
+
+} /* namespace xolotlCore */
+
+#endif
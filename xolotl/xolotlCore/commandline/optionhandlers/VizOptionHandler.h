@@ -17,8 +17,10 @@ public:
 	 */
 	VizOptionHandler() :
 		OptionHandler("vizHandler",
-				"vizHandler {std,dummy}            "
-				"Which set of handlers to use for the visualization. (default = dummy)\n") {}
+				"vizHandler {std,async,dummy}      "
+				"Which set of handlers to use for the visualization. (default = dummy)\n"
+				"                                    async uses the standard handlers and renders "
+				"the plots on a background thread.\n") {}
 
 	/**
 	 * The destructor
@@ -38,6 +40,10 @@ public:
 		if (arg == "std") {
 			opt->setVizStandardHandlers(true);
 		}
+		else if (arg == "async") {
+			opt->setVizStandardHandlers(true);
+			opt->setVizAsyncRendering(true);
+		}
 		else if (arg == "dummy") {
 			opt->setVizStandardHandlers(false);
 		}
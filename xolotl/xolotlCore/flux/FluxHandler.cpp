@@ -1,6 +1,7 @@
 #include "FluxHandler.h"
 #include <xolotlPerf.h>
 #include <Reactant.h>
+#include <MPIUtils.h>
 #include <iostream>
 #include <fstream>
 #include <cmath>
@@ -87,12 +88,15 @@ void FluxHandler::initializeTimeProfile(const std::string& fileName) {
 	// Set use time profile to true
 	useTimeProfile = true;
 
-	// Open file dataFile.dat containing the time and amplitude
-	std::ifstream inputFile(fileName.c_str());
+	// Open file dataFile.dat containing the time and amplitude,
+	// only the first process reads it
+	auto inputFile = MPIUtils::broadcastFile(fileName);
+	if (!inputFile)
+		return;
 	std::string line;
 
 	// Read the file and store the values in the two vectors
-	while (getline(inputFile, line)) {
+	while (getline(*inputFile, line)) {
 		if (!line.length() || line[0] == '#')
 			continue;
 		double xamp = 0.0, yamp = 0.0;
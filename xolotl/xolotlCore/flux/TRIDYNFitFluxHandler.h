@@ -8,6 +8,7 @@
 #include <iostream>
 #include <fstream>
 #include <mpi.h>
+#include <MPIUtils.h>
 
 namespace xolotlCore {
 
@@ -102,83 +103,83 @@ public:
 	 */
 	void initializeFluxHandler(const IReactionNetwork& network, int surfacePos,
 			std::vector<double> grid) {
-		// Read the parameter file
-		std::ifstream paramFile;
-		paramFile.open("tridyn.dat");
-
-		if (!paramFile.good()) {
-			// Print a message
-			std::cout
-					<< "No parameter files for TRIDYN flux, the flux will be 0"
-					<< std::endl;
-
-			// Set the depths to 0.0
-			totalDepths.push_back(0.0);
-			totalDepths.push_back(0.0);
-			totalDepths.push_back(0.0);
-			totalDepths.push_back(0.0);
-
-			// Set the reduction factors to 0.0
-			reductionFactors.push_back(0.0);
-			reductionFactors.push_back(0.0);
-			reductionFactors.push_back(0.0);
-			reductionFactors.push_back(0.0);
-		} else {
-			// Build an input stream from the string
-			xolotlCore::TokenizedLineReader<double> reader;
-			// Get the line
-			std::string line;
-			getline(paramFile, line);
-			auto lineSS = std::make_shared<std::istringstream>(line);
-			reader.setInputStream(lineSS);
-
-			// Read the first line
-			auto tokens = reader.loadLine();
-			// And start looping on the lines
-			int i = 0;
-			while (i < 4) {
-				// Get the fraction
-				reductionFactors.push_back(tokens[0]);
-
-				// Set the parameters for the fit
-				getline(paramFile, line);
-				lineSS = std::make_shared<std::istringstream>(line);
+		// The parameters are read the first time only, by the first process,
+		// this first call happens on all the processes
+		if (reductionFactors.empty()) {
+			// Read the parameter file
+			auto paramFile = MPIUtils::broadcastFile("tridyn.dat");
+
+			if (!paramFile) {
+				// Print a message
+				std::cout
+						<< "No parameter files for TRIDYN flux, the flux will be 0"
+						<< std::endl;
+
+				// Set the depths to 0.0
+				totalDepths.push_back(0.0);
+				totalDepths.push_back(0.0);
+				totalDepths.push_back(0.0);
+				totalDepths.push_back(0.0);
+
+				// Set the reduction factors to 0.0
+				reductionFactors.push_back(0.0);
+				reductionFactors.push_back(0.0);
+				reductionFactors.push_back(0.0);
+				reductionFactors.push_back(0.0);
+			} else {
+				// Build an input stream from the string
+				xolotlCore::TokenizedLineReader<double> reader;
+				// Get the line
+				std::string line;
+				getline(*paramFile, line);
+				auto lineSS = std::make_shared<std::istringstream>(line);
 				reader.setInputStream(lineSS);
-				tokens = reader.loadLine();
-				std::vector<double> params;
-				params.push_back(tokens[0]);
-				params.push_back(tokens[1]);
-				params.push_back(tokens[2]);
-				params.push_back(tokens[3]);
-				params.push_back(tokens[4]);
-				params.push_back(tokens[5]);
-				params.push_back(tokens[6]);
-				params.push_back(tokens[7]);
-				params.push_back(tokens[8]);
-				params.push_back(tokens[9]);
-				params.push_back(tokens[10]);
-				params.push_back(tokens[11]);
-				params.push_back(tokens[12]);
-				params.push_back(tokens[13]);
-				params.push_back(tokens[14]);
-				params.push_back(tokens[15]);
-				fitParams.push_back(params);
-				// Set the total depth where the fit is defined
-				totalDepths.push_back(tokens[16] + 0.1);
-
-				// Read the next line
-				getline(paramFile, line);
-				lineSS = std::make_shared<std::istringstream>(line);
-				reader.setInputStream(lineSS);
-				tokens = reader.loadLine();
-				// Increase the loop number
-				i++;
+
+				// Read the first line
+				auto tokens = reader.loadLine();
+				// And start looping on the lines
+				int i = 0;
+				while (i < 4) {
+					// Get the fraction
+					reductionFactors.push_back(tokens[0]);
+
+					// Set the parameters for the fit
+					getline(*paramFile, line);
+					lineSS = std::make_shared<std::istringstream>(line);
+					reader.setInputStream(lineSS);
+					tokens = reader.loadLine();
+					std::vector<double> params;
+					params.push_back(tokens[0]);
+					params.push_back(tokens[1]);
+					params.push_back(tokens[2]);
+					params.push_back(tokens[3]);
+					params.push_back(tokens[4]);
+					params.push_back(tokens[5]);
+					params.push_back(tokens[6]);
+					params.push_back(tokens[7]);
+					params.push_back(tokens[8]);
+					params.push_back(tokens[9]);
+					params.push_back(tokens[10]);
+					params.push_back(tokens[11]);
+					params.push_back(tokens[12]);
+					params.push_back(tokens[13]);
+					params.push_back(tokens[14]);
+					params.push_back(tokens[15]);
+					fitParams.push_back(params);
+					// Set the total depth where the fit is defined
+					totalDepths.push_back(tokens[16] + 0.1);
+
+					// Read the next line
+					getline(*paramFile, line);
+					lineSS = std::make_shared<std::istringstream>(line);
+					reader.setInputStream(lineSS);
+					tokens = reader.loadLine();
+					// Increase the loop number
+					i++;
+				}
 			}
 		}
 
-		// Close the file
-		paramFile.close();
-
 		// Set the grid
 		xGrid = grid;
 
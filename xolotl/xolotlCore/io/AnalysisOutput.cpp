@@ -0,0 +1,109 @@
+#include <cfloat>
+#include "xolotlCore/io/AnalysisOutput.h"
+
+namespace xolotlCore {
+
+namespace AnalysisOutput {
+
+const std::string precisionAttrName = "precision";
+const std::string logMinAttrName = "logMin";
+const std::string logMaxAttrName = "logMax";
+const std::string errorBoundAttrName = "relativeErrorBound";
+
+Precision toPrecision(const std::string& name) {
+	if (name == "double")
+		return Precision::Double;
+	if (name == "float")
+		return Precision::Float;
+	if (name == "log16")
+		return Precision::Log16;
+
+	throw std::string(
+			"\nxolotlCore::AnalysisOutput: unknown precision " + name
+					+ ", it must be double, float, or log16.");
+}
+
+std::string toString(Precision precision) {
+	switch (precision) {
+	case Precision::Float:
+		return "float";
+	case Precision::Log16:
+		return "log16";
+	default:
+		return "double";
+	}
+}
+
+double getErrorBound(Precision precision, double logMin, double logMax) {
+	switch (precision) {
+	case Precision::Float:
+		// Rounding to the nearest float
+		return FLT_EPSILON / 2.0;
+	case Precision::Log16: {
+		// Half a level in logarithmic scale
+		double step = (logMax - logMin) / (double) (log16Levels - 1);
+		return std::pow(10.0, step / 2.0) - 1.0;
+	}
+	default:
+		return DBL_EPSILON / 2.0;
+	}
+}
+
+uint16_t encodeLog16(double value, double logMin, double logMax) {
+	if (value == 0.0)
+		return 0;
+
+	// The magnitude level, from 1 for logMin to log16Levels for logMax
+	uint16_t level = 1;
+	if (logMax > logMin) {
+		double position = (std::log10(std::fabs(value)) - logMin)
+				/ (logMax - logMin);
+		position = std::min(std::max(position, 0.0), 1.0);
+		level += (uint16_t) std::lround(position * (log16Levels - 1));
+	}
+
+	// The sign is the first bit
+	if (value < 0.0)
+		level |= 0x8000;
+
+	return level;
+}
+
+double decodeLog16(uint16_t code, double logMin, double logMax) {
+	uint16_t level = code & log16Levels;
+	if (level == 0)
+		return 0.0;
+
+	double value = std::pow(10.0,
+			logMin
+					+ (logMax - logMin) * (double) (level - 1)
+							/ (double) (log16Levels - 1));
+
+	return (code & 0x8000) ? -value : value;
+}
+
+void writeAttributes(const HDF5Object& dataset, Precision precision,
+		double logMin, double logMax) {
+	HDF5File::ScalarDataSpace scalarDSpace;
+
+	HDF5File::Attribute<std::string> precisionAttr(dataset, precisionAttrName,
+			scalarDSpace);
+	precisionAttr.setTo(toString(precision));
+	if (precision == Precision::Log16) {
+		HDF5File::Attribute<double> logMinAttr(dataset, logMinAttrName,
+				scalarDSpace);
+		logMinAttr.setTo(logMin);
+		HDF5File::Attribute<double> logMaxAttr(dataset, logMaxAttrName,
+				scalarDSpace);
+		logMaxAttr.setTo(logMax);
+	}
+	HDF5File::Attribute<double> errorAttr(dataset, errorBoundAttrName,
+			scalarDSpace);
+	errorAttr.setTo(getErrorBound(precision, logMin, logMax));
+
+	return;
+}
+
+} /* namespace AnalysisOutput */
+
+} /* namespace xolotlCore */
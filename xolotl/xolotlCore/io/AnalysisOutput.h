@@ -0,0 +1,185 @@
+#ifndef XCORE_ANALYSISOUTPUT_H
+#define XCORE_ANALYSISOUTPUT_H
+
+#include <string>
+#include <vector>
+#include <array>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include "xolotlCore/io/HDF5File.h"
+
+namespace xolotlCore {
+
+/**
+ * Reduced precision storage of the data that is only written for analysis
+ * (profiles, observables), never for restarting.  The values are stored as
+ * doubles, as floats, or quantized on 16 bits in logarithmic scale, and the
+ * datasets carry the largest relative error of their encoding.
+ */
+namespace AnalysisOutput {
+
+//! The storage precision of the analysis datasets.
+enum class Precision {
+	Double, Float, Log16
+};
+
+//! The name of the attribute with the precision of a dataset.
+extern const std::string precisionAttrName;
+//! The names of the attributes with the range of a log16 dataset.
+extern const std::string logMinAttrName;
+extern const std::string logMaxAttrName;
+//! The name of the attribute with the largest relative error of a dataset.
+extern const std::string errorBoundAttrName;
+
+//! The number of magnitude levels of the log16 encoding, the first bit
+//! being the sign.
+constexpr uint16_t log16Levels = 0x7fff;
+
+/**
+ * Get the precision from its name, "double", "float", or "log16".
+ *
+ * @param name The name of the precision
+ * @return The precision
+ */
+Precision toPrecision(const std::string& name);
+
+/**
+ * Get the name of a precision.
+ *
+ * @param precision The precision
+ * @return Its name
+ */
+std::string toString(Precision precision);
+
+/**
+ * Compute the largest relative error of an encoding.  For floats it holds
+ * for the values larger than the smallest normal float, for log16 it holds
+ * for all the values, zero being exact.
+ *
+ * @param precision The precision
+ * @param logMin The decimal logarithm of the smallest non-zero magnitude
+ * @param logMax The decimal logarithm of the largest magnitude
+ * @return The relative error bound
+ */
+double getErrorBound(Precision precision, double logMin = 0.0,
+		double logMax = 0.0);
+
+/**
+ * Encode a value on 16 bits, the first bit is the sign, the other ones the
+ * decimal logarithm of the magnitude between logMin and logMax.  Zero is
+ * encoded as zero.
+ *
+ * @param value The value
+ * @param logMin The decimal logarithm of the smallest non-zero magnitude
+ * @param logMax The decimal logarithm of the largest magnitude
+ * @return The code
+ */
+uint16_t encodeLog16(double value, double logMin, double logMax);
+
+/**
+ * Decode a value encoded with encodeLog16.
+ *
+ * @param code The code
+ * @param logMin The decimal logarithm of the smallest non-zero magnitude
+ * @param logMax The decimal logarithm of the largest magnitude
+ * @return The value
+ */
+double decodeLog16(uint16_t code, double logMin, double logMax);
+
+/**
+ * Describe the encoding of a dataset with its attributes.
+ *
+ * @param dataset The dataset
+ * @param precision The precision
+ * @param logMin The decimal logarithm of the smallest non-zero magnitude
+ * @param logMax The decimal logarithm of the largest magnitude
+ */
+void writeAttributes(const HDF5Object& dataset, Precision precision,
+		double logMin = 0.0, double logMax = 0.0);
+
+/**
+ * Write our rows of a 2D dataset with the given precision, with a
+ * collective write.  With log16, the range of the magnitudes is computed
+ * over all the processes.
+ *
+ * @param loc The file or group where the dataset is created
+ * @param comm The communicator of the file
+ * @param name The name of the dataset
+ * @param nRows The total number of rows
+ * @param baseIdx The first row we write
+ * @param data Our rows
+ * @param precision The precision
+ */
+template<uint32_t dim0>
+void writeDataset2D(const HDF5Object& loc, MPI_Comm comm,
+		const std::string& name, uint32_t nRows, uint32_t baseIdx,
+		const HDF5File::DataSet<double>::DataType2D<dim0>& data,
+		Precision precision) {
+
+	// Everyone must create the dataset with the same shape.
+	HDF5File::SimpleDataSpace<2>::Dimensions dims = { (hsize_t) nRows, dim0 };
+	HDF5File::SimpleDataSpace<2> dspace(dims);
+
+	switch (precision) {
+	case Precision::Double: {
+		HDF5File::DataSet<double> dataset(loc, name, dspace);
+		dataset.parWrite2D<dim0>(comm, baseIdx, data);
+		writeAttributes(dataset, precision);
+		break;
+	}
+	case Precision::Float: {
+		HDF5File::DataSet<float>::DataType2D<dim0> floatData(data.size());
+		for (std::size_t i = 0; i < data.size(); i++) {
+			std::copy(data[i].begin(), data[i].end(), floatData[i].begin());
+		}
+		HDF5File::DataSet<float> dataset(loc, name, dspace);
+		dataset.parWrite2D<dim0>(comm, baseIdx, floatData);
+		writeAttributes(dataset, precision);
+		break;
+	}
+	case Precision::Log16: {
+		// The range of the non-zero magnitudes
+		// (the largest one is negated to reduce both with MPI_MIN)
+		std::array<double, 2> localRange = {
+				std::numeric_limits<double>::max(),
+				std::numeric_limits<double>::max() };
+		for (auto const& row : data) {
+			for (auto value : row) {
+				if (value == 0.0)
+					continue;
+				double logValue = std::log10(std::fabs(value));
+				localRange[0] = std::min(localRange[0], logValue);
+				localRange[1] = std::min(localRange[1], -logValue);
+			}
+		}
+		std::array<double, 2> range;
+		MPI_Allreduce(localRange.data(), range.data(), 2, MPI_DOUBLE, MPI_MIN,
+				comm);
+		double logMin = range[0];
+		double logMax = -range[1];
+		// Only zeros
+		if (logMin > logMax) {
+			logMin = 0.0;
+			logMax = 0.0;
+		}
+
+		HDF5File::DataSet<uint16_t>::DataType2D<dim0> codes(data.size());
+		for (std::size_t i = 0; i < data.size(); i++) {
+			for (std::size_t j = 0; j < dim0; j++) {
+				codes[i][j] = encodeLog16(data[i][j], logMin, logMax);
+			}
+		}
+		HDF5File::DataSet<uint16_t> dataset(loc, name, dspace);
+		dataset.parWrite2D<dim0>(comm, baseIdx, codes);
+		writeAttributes(dataset, precision, logMin, logMax);
+		break;
+	}
+	}
+}
+
+} /* namespace AnalysisOutput */
+
+} /* namespace xolotlCore */
+
+#endif
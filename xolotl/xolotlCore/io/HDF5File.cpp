@@ -120,6 +120,22 @@ void HDF5File::Open(fs::path _path,
     }
 }
 
+void HDF5File::OpenImage(fs::path _path,
+                        const std::vector<char>& image) {
+
+    // Use the core driver without backing store, the image is copied.
+    PropertyList plist(H5P_FILE_ACCESS);
+    auto plistId = plist.getId();
+    H5Pset_fapl_core(plistId, 1 << 20, 0);
+    H5Pset_file_image(plistId, (void*)image.data(), image.size());
+
+    setId(H5Fopen(_path.string().c_str(), H5F_ACC_RDONLY, plistId));
+
+    if(getId() < 0) {
+        throw HDF5Exception(BuildHDF5ErrorString());
+    }
+}
+
 bool
 HDF5File::hasGroup(fs::path path) const {
 
@@ -725,6 +725,15 @@ protected:
 				MPI_Comm _comm,
 				bool par);
 
+	/**
+	 * Open an in-memory image of an HDF5 file, read only.
+	 *
+	 * @param _path Path of the file the image was taken from.
+	 * @param image The content of the file.
+	 */
+	void OpenImage(fs::path _path,
+				const std::vector<char>& image);
+
 public:
 	/**
 	 * Create or open an HDF5 file.
@@ -743,6 +752,23 @@ public:
 		Open(_path, _mode, _comm, par);
 	}
 
+	/**
+	 * Open an in-memory image of an HDF5 file, read only.  Each process
+	 * works on its own copy of the image, no file is accessed.
+	 *
+	 * @param _path Path of the file the image was taken from.
+	 * @param image The content of the file.
+	 * @param _comm The communicator of the processes sharing the image.
+	 */
+	HDF5File(fs::path _path,
+				const std::vector<char>& image,
+				MPI_Comm _comm = MPI_COMM_WORLD)
+	  : HDF5Object("/"),
+		comm(_comm) {
+
+		OpenImage(_path, image);
+	}
+
 	/**
 	 * Close the file if open and destroy the in-memory object.
 	 */
@@ -75,6 +75,40 @@ HDF5File::TypeInMemory<double>::TypeInMemory(void)
 { }
 
 
+//----------------------------------------------------------------------------
+// float
+//----------------------------------------------------------------------------
+
+template<>
+inline
+HDF5File::TypeInFile<float>::TypeInFile(void)
+  : HDF5File::TypeBase("float", H5T_IEEE_F32LE, false)
+{ }
+
+template<>
+inline
+HDF5File::TypeInMemory<float>::TypeInMemory(void)
+  : HDF5File::TypeBase("float", H5T_NATIVE_FLOAT, false)
+{ }
+
+
+//----------------------------------------------------------------------------
+// uint16_t
+//----------------------------------------------------------------------------
+
+template<>
+inline
+HDF5File::TypeInFile<uint16_t>::TypeInFile(void)
+  : HDF5File::TypeBase("uint16_t", H5T_STD_U16LE, false)
+{ }
+
+template<>
+inline
+HDF5File::TypeInMemory<uint16_t>::TypeInMemory(void)
+  : HDF5File::TypeBase("uint16_t", H5T_NATIVE_USHORT, false)
+{ }
+
+
 #if defined(__clang__) && defined(__APPLE__)
 //----------------------------------------------------------------------------
 // size_t
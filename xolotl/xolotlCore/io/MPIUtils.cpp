@@ -2,6 +2,8 @@
 #include "MPIUtils.h"
 #include <fstream>
 #include <sstream>
+#include <algorithm>
+#include <cstdint>
 
 using namespace xolotlCore;
 using std::shared_ptr;
@@ -11,51 +13,84 @@ shared_ptr<std::istream> MPIUtils::broadcastStream(
 	shared_ptr<std::istream> stream, int master) {
 	// Local declarations
 	int rank;
-	int tasks;
-	auto bufferSS = std::make_shared<std::stringstream>();
-	int bufferSize = 0;
-	char *buffer = NULL;
+	std::vector<char> buffer;
 
-	// Get the rank and number of tasks
+	// Get the rank
 	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-	MPI_Comm_size(MPI_COMM_WORLD, &tasks);
 	
 	// Master task
 	if (rank == master) {
 		// Load the data from the input stream into memory
-		// This method is clean and potentially bug-free, but it copies memory
-		// three times. However, this is not a problem for files under
-		// a few MiB, and reading from disk takes longer anyway.
-		(*bufferSS) << stream->rdbuf();
-		std::string bufferString = bufferSS->str();
-		// Create the new buffer and copy its contents into the string
-		bufferSize = bufferString.size();
-		buffer = new char[bufferSize];
-		bufferString.copy(buffer, bufferSize);
-	}
-	
-	// Broadcast the size
-	MPI_Bcast(&bufferSize, 1, MPI_INT, master, MPI_COMM_WORLD);
-	
-	// Create a new buffer on the nodes
-	if (rank != master) {
-		buffer = new char[bufferSize];
+		std::ostringstream bufferSS;
+		bufferSS << stream->rdbuf();
+		std::string bufferString = bufferSS.str();
+		buffer.assign(bufferString.begin(), bufferString.end());
 	}
 	
 	// Broadcast the buffer
-	MPI_Bcast(buffer, bufferSize, MPI_CHAR, master, MPI_COMM_WORLD);
+	broadcastBuffer(buffer, master, MPI_COMM_WORLD);
 	
-	// Create the string from the buffer on the nodes
-	if (rank != master) {
-		std::string bufferString(buffer, bufferSize);
-		bufferSS->str(bufferString);
+	// Create the stream from the buffer
+	return std::make_shared<std::istringstream>(
+		std::string(buffer.begin(), buffer.end()));
+}
+
+void MPIUtils::broadcastBuffer(std::vector<char>& buffer, int root,
+	MPI_Comm comm) {
+	// Broadcast the size
+	uint64_t bufferSize = buffer.size();
+	MPI_Bcast(&bufferSize, 1, MPI_UINT64_T, root, comm);
+	buffer.resize(bufferSize);
+
+	// Broadcast the buffer in chunks that fit in an int
+	const uint64_t chunkSize = 1 << 30;
+	for (uint64_t offset = 0; offset < bufferSize; offset += chunkSize) {
+		int count = std::min(chunkSize, bufferSize - offset);
+		MPI_Bcast(buffer.data() + offset, count, MPI_CHAR, root, comm);
 	}
-	
-	// Rewind the stringstream before returning it
-	bufferSS->seekg(0);
 
-	// Clean up the buffer memory and return it
-	delete[] buffer;
-	
-	return bufferSS;
+	return;
+}
+
+shared_ptr<std::istream> MPIUtils::broadcastFile(const std::string& fileName,
+	int root, MPI_Comm comm) {
+	// Without MPI there is nobody to share the file with
+	int initialized = 0;
+	MPI_Initialized(&initialized);
+	if (!initialized) {
+		auto fileStream = std::make_shared<std::ifstream>(fileName);
+		if (!fileStream->good())
+			return nullptr;
+		return fileStream;
+	}
+
+	int rank;
+	MPI_Comm_rank(comm, &rank);
+
+	// The first byte tells if the root process could open the file,
+	// the content follows
+	std::vector<char> buffer;
+	if (rank == root) {
+		std::ifstream fileStream(fileName);
+		if (fileStream.good()) {
+			std::ostringstream bufferSS;
+			bufferSS << fileStream.rdbuf();
+			std::string bufferString = bufferSS.str();
+			buffer.reserve(bufferString.size() + 1);
+			buffer.push_back(1);
+			buffer.insert(buffer.end(), bufferString.begin(),
+				bufferString.end());
+		}
+		else {
+			buffer.push_back(0);
+		}
+	}
+
+	// Everyone gets the same buffer
+	broadcastBuffer(buffer, root, comm);
+	if (buffer[0] == 0)
+		return nullptr;
+
+	return std::make_shared<std::istringstream>(
+		std::string(buffer.begin() + 1, buffer.end()));
 }
@@ -4,6 +4,8 @@
 #include <mpi.h>
 #include <memory>
 #include <iostream>
+#include <string>
+#include <vector>
 
 
 namespace xolotlCore {
@@ -23,6 +25,38 @@ namespace MPIUtils {
 	 */
 	std::shared_ptr<std::istream> broadcastStream(
 		std::shared_ptr<std::istream> stream, int root);
+
+	/**
+	 * Sends a buffer of bytes from the root process to all the others,
+	 * their buffers are resized to match. It is sent in chunks so its
+	 * size is not limited by the range of an int.
+	 *
+	 * This method blocks until it is called by all processes.
+	 *
+	 * @param buffer The buffer, only the one of the root process is read
+	 * @param root The rank of the root process
+	 * @param comm The communicator
+	 */
+	void broadcastBuffer(std::vector<char>& buffer, int root,
+		MPI_Comm comm = MPI_COMM_WORLD);
+
+	/**
+	 * Reads an input file on the root process only and sends its content
+	 * to all the other processes, which parse it from memory. This is how
+	 * every input file should be read, to avoid opening the same file from
+	 * all the processes at startup.
+	 *
+	 * This method blocks until it is called by all processes. If MPI is not
+	 * initialized the file is simply read.
+	 *
+	 * @param fileName The name of the file
+	 * @param root The rank of the process reading the file
+	 * @param comm The communicator
+	 * @return The content of the file, or a null pointer on all the
+	 * processes if the root process could not open it
+	 */
+	std::shared_ptr<std::istream> broadcastFile(const std::string& fileName,
+		int root = 0, MPI_Comm comm = MPI_COMM_WORLD);
 }
 
 } /* namespace xolotlCore */
@@ -0,0 +1,178 @@
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include "xolotlCore/io/TimeSeries.h"
+#include "xolotlCore/io/HDF5File.h"
+#include "xolotlCore/io/HDF5Exception.h"
+
+namespace xolotlCore {
+
+const std::string TimeSeries::dataSetName = "data";
+const std::string TimeSeries::columnsAttrName = "columns";
+
+TimeSeries::Format TimeSeries::toFormat(const std::string& name) {
+	if (name == "text")
+		return Format::Text;
+	if (name == "hdf5")
+		return Format::HDF5;
+
+	throw std::string(
+			"\nxolotlCore::TimeSeries: unknown format " + name
+					+ ", it must be text or hdf5.");
+}
+
+std::set<TimeSeries*>& TimeSeries::getAllSeries() {
+	static std::set<TimeSeries*> allSeries;
+	return allSeries;
+}
+
+void TimeSeries::flushAll() {
+	for (auto series : getAllSeries())
+		series->flush();
+
+	return;
+}
+
+TimeSeries::TimeSeries(const std::string& baseName,
+		const std::vector<std::string>& _columns, Format _format,
+		std::size_t _flushInterval) :
+		columns(_columns), format(_format), flushInterval(
+				std::max(_flushInterval, (std::size_t) 1)), nWritten(0) {
+
+	if (columns.empty())
+		throw std::string(
+				"\nxolotlCore::TimeSeries: " + baseName
+						+ " does not have any column.");
+
+	// Create the empty file
+	if (format == Format::HDF5) {
+		fileName = baseName + ".h5";
+		createHDF5File();
+	} else {
+		fileName = baseName + ".txt";
+		std::ofstream outputFile(fileName);
+	}
+
+	pending.reserve(flushInterval * columns.size());
+	getAllSeries().insert(this);
+}
+
+TimeSeries::~TimeSeries() {
+	getAllSeries().erase(this);
+
+	// A destructor must not throw
+	try {
+		flush();
+	} catch (...) {
+	}
+}
+
+void TimeSeries::addRow(const std::vector<double>& row) {
+	if (row.size() != columns.size()) {
+		std::ostringstream estr;
+		estr << "\nxolotlCore::TimeSeries: a row of " << fileName << " has "
+				<< row.size() << " values instead of " << columns.size()
+				<< ".";
+		throw estr.str();
+	}
+
+	pending.insert(pending.end(), row.begin(), row.end());
+	if (pending.size() >= flushInterval * columns.size())
+		flush();
+
+	return;
+}
+
+void TimeSeries::flush() {
+	if (pending.empty())
+		return;
+
+	if (format == Format::HDF5) {
+		appendToHDF5File();
+	} else {
+		std::ofstream outputFile(fileName, std::ios::app);
+		for (std::size_t i = 0; i < pending.size(); i += columns.size()) {
+			outputFile << pending[i];
+			for (std::size_t j = 1; j < columns.size(); ++j)
+				outputFile << " " << pending[i + j];
+			outputFile << "\n";
+		}
+	}
+
+	nWritten += pending.size() / columns.size();
+	pending.clear();
+
+	return;
+}
+
+void TimeSeries::createHDF5File() const {
+	HDF5File file(fileName, HDF5File::AccessMode::CreateOrTruncateIfExists,
+	MPI_COMM_SELF, false);
+
+	// No row yet, as many as needed later
+	HDF5File::SimpleDataSpace<2>::Dimensions dims { 0, columns.size() };
+	HDF5File::SimpleDataSpace<2>::Dimensions maxDims { H5S_UNLIMITED,
+			columns.size() };
+	HDF5File::SimpleDataSpace<2> dataSpace(dims, maxDims);
+
+	// An extendable dataset has to be chunked, a chunk holds the rows of
+	// a flush
+	HDF5File::PropertyList createPList(H5P_DATASET_CREATE);
+	HDF5File::SimpleDataSpace<2>::Dimensions chunkDims { flushInterval,
+			columns.size() };
+	H5Pset_chunk(createPList.getId(), 2, chunkDims.data());
+
+	hid_t dataSetId = H5Dcreate2(file.getId(), dataSetName.c_str(),
+	H5T_IEEE_F64LE, dataSpace.getId(), H5P_DEFAULT, createPList.getId(),
+	H5P_DEFAULT);
+	if (dataSetId < 0)
+		throw HDF5Exception("Unable to create the dataset of " + fileName);
+
+	// The names of the columns
+	{
+		HDF5Object dataSet(dataSetName, dataSetId);
+		HDF5File::SimpleDataSpace<1>::Dimensions attrDims { columns.size() };
+		HDF5File::SimpleDataSpace<1> attrDSpace(attrDims);
+		HDF5File::Attribute<std::vector<std::string> > columnsAttr(dataSet,
+				columnsAttrName, attrDSpace);
+		columnsAttr.setTo(columns);
+	}
+	H5Dclose(dataSetId);
+
+	return;
+}
+
+void TimeSeries::appendToHDF5File() const {
+	HDF5File file(fileName, HDF5File::AccessMode::OpenReadWrite,
+	MPI_COMM_SELF, false);
+
+	hid_t dataSetId = H5Dopen2(file.getId(), dataSetName.c_str(),
+	H5P_DEFAULT);
+	if (dataSetId < 0)
+		throw HDF5Exception("Unable to open the dataset of " + fileName);
+
+	// Extend the dataset by the new rows
+	hsize_t nRows = pending.size() / columns.size();
+	std::array<hsize_t, 2> dims { nWritten + nRows, columns.size() };
+	H5Dset_extent(dataSetId, dims.data());
+
+	// Select them
+	hid_t fileSpaceId = H5Dget_space(dataSetId);
+	std::array<hsize_t, 2> offset { nWritten, 0 };
+	std::array<hsize_t, 2> count { nRows, columns.size() };
+	H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, offset.data(), nullptr,
+			count.data(), nullptr);
+	hid_t memSpaceId = H5Screate_simple(2, count.data(), nullptr);
+
+	auto status = H5Dwrite(dataSetId, H5T_NATIVE_DOUBLE, memSpaceId,
+			fileSpaceId, H5P_DEFAULT, pending.data());
+	H5Sclose(memSpaceId);
+	H5Sclose(fileSpaceId);
+	H5Dclose(dataSetId);
+	if (status < 0)
+		throw HDF5Exception("Unable to append the rows to " + fileName);
+
+	return;
+}
+
+} /* namespace xolotlCore */
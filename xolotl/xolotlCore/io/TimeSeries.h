@@ -0,0 +1,135 @@
+#ifndef XCORE_TIMESERIES_H
+#define XCORE_TIMESERIES_H
+
+#include <string>
+#include <vector>
+#include <set>
+
+namespace xolotlCore {
+
+/**
+ * A time series written by the monitors, one row of values per time step
+ * (the retention, the surface position...).  The rows are kept in memory
+ * and appended to the file every few rows, either as lines of text or to
+ * an extendable two dimensional dataset named "data" in an HDF5 file, the
+ * names of the columns being its "columns" attribute.  The file is only
+ * open while the rows are flushed so it is always readable, and the rows
+ * left in memory are flushed when the series is destroyed or by flushAll().
+ * The rows kept in memory are lost if the program crashes, the solver
+ * calls flushAll() at each checkpoint to bound this.
+ */
+class TimeSeries {
+public:
+	//! The format of the file.
+	enum class Format {
+		Text, HDF5
+	};
+
+	//! The name of the dataset in the HDF5 files.
+	static const std::string dataSetName;
+	//! The name of the attribute with the names of the columns.
+	static const std::string columnsAttrName;
+
+	/**
+	 * Get the format from its name, "text" or "hdf5".
+	 *
+	 * @param name The name of the format
+	 * @return The format
+	 */
+	static Format toFormat(const std::string& name);
+
+	/**
+	 * Flush the rows of all the existing series.
+	 */
+	static void flushAll();
+
+	/**
+	 * The constructor creates the file, or empties it if it exists.
+	 *
+	 * @param baseName The name of the file without its extension, ".txt"
+	 * or ".h5" being added depending on the format
+	 * @param columns The names of the columns
+	 * @param format The format of the file
+	 * @param flushInterval The number of rows kept in memory before they
+	 * are written
+	 */
+	TimeSeries(const std::string& baseName,
+			const std::vector<std::string>& columns, Format format =
+					Format::Text, std::size_t flushInterval = 100);
+
+	/**
+	 * The destructor flushes the rows left in memory.
+	 */
+	~TimeSeries();
+
+	TimeSeries(const TimeSeries&) = delete;
+	TimeSeries& operator=(const TimeSeries&) = delete;
+
+	/**
+	 * Add a row, it must have a value for each column.
+	 *
+	 * @param row The values
+	 */
+	void addRow(const std::vector<double>& row);
+
+	/**
+	 * Write the rows kept in memory to the file.
+	 */
+	void flush();
+
+	/**
+	 * Get the name of the file.
+	 *
+	 * @return The name of the file
+	 */
+	const std::string& getFileName() const {
+		return fileName;
+	}
+
+	/**
+	 * Get the number of rows, written or not.
+	 *
+	 * @return The number of rows
+	 */
+	std::size_t getNumRows() const {
+		return nWritten + pending.size() / columns.size();
+	}
+
+private:
+	//! The name of the file.
+	std::string fileName;
+
+	//! The names of the columns.
+	std::vector<std::string> columns;
+
+	//! The format of the file.
+	Format format;
+
+	//! The number of rows kept in memory before they are written.
+	std::size_t flushInterval;
+
+	//! The values of the rows not written yet, row after row.
+	std::vector<double> pending;
+
+	//! The number of rows already in the file.
+	std::size_t nWritten;
+
+	/**
+	 * Create the empty HDF5 file and its dataset.
+	 */
+	void createHDF5File() const;
+
+	/**
+	 * Append the rows kept in memory to the HDF5 dataset.
+	 */
+	void appendToHDF5File() const;
+
+	/**
+	 * The series that exist, for flushAll().
+	 */
+	static std::set<TimeSeries*>& getAllSeries();
+};
+
+} /* namespace xolotlCore */
+
+#endif /* XCORE_TIMESERIES_H */
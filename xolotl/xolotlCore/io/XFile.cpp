@@ -2,9 +2,14 @@
 #include <sstream>
 #include <iterator>
 #include <array>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <limits>
 #include "hdf5.h"
 #include "mpi.h"
 #include "xolotlCore/io/XFile.h"
+#include "xolotlCore/io/MPIUtils.h"
 #include <PSISuperCluster.h>
 #include <FeSuperCluster.h>
 #include <NESuperCluster.h>
@@ -52,6 +57,61 @@ XFile::XFile(fs::path _path, MPI_Comm _comm, AccessMode _mode) :
 	// Nothing else to do.
 }
 
+XFile::XFile(fs::path _path, const std::vector<char>& image, MPI_Comm _comm) :
+		HDF5File(_path, image, _comm) {
+
+	// Nothing else to do.
+}
+
+std::unique_ptr<XFile> XFile::stage(fs::path path, MPI_Comm _comm) {
+	int procId;
+	MPI_Comm_rank(_comm, &procId);
+
+	// The root process copies the small groups in an in-memory file
+	std::vector<char> image;
+	if (procId == 0) {
+		hid_t fileId = H5Fopen(path.string().c_str(), H5F_ACC_RDONLY,
+		H5P_DEFAULT);
+		if (fileId >= 0) {
+			hid_t plistId = H5Pcreate(H5P_FILE_ACCESS);
+			H5Pset_fapl_core(plistId, 1 << 20, 0);
+			auto stagedName = path.string() + ".staged";
+			hid_t stagedId = H5Fcreate(stagedName.c_str(), H5F_ACC_TRUNC,
+			H5P_DEFAULT, plistId);
+			H5Pclose(plistId);
+
+			for (auto const& groupPath : { HeaderGroup::path,
+					NetworkGroup::path }) {
+				if (H5Lexists(fileId, groupPath.string().c_str(), H5P_DEFAULT)
+						> 0) {
+					H5Ocopy(fileId, groupPath.string().c_str(), stagedId,
+							groupPath.string().c_str(), H5P_DEFAULT,
+							H5P_DEFAULT);
+				}
+			}
+
+			// Get the image
+			H5Fflush(stagedId, H5F_SCOPE_GLOBAL);
+			ssize_t imageSize = H5Fget_file_image(stagedId, NULL, 0);
+			if (imageSize > 0) {
+				image.resize(imageSize);
+				H5Fget_file_image(stagedId, image.data(), imageSize);
+			}
+			H5Fclose(stagedId);
+			H5Fclose(fileId);
+		}
+	}
+
+	// Send it to everyone
+	MPIUtils::broadcastBuffer(image, 0, _comm);
+	if (image.empty()) {
+		throw HDF5Exception(
+				"XFile::stage: could not read the file " + path.string());
+	}
+
+	return std::unique_ptr<XFile>(new XFile(path, image, _comm));
+}
+
 //----------------------------------------------------------------------------
 // HeaderGroup
 //
@@ -182,6 +242,36 @@ void XFile::HeaderGroup::read(int &nx, double &hx, int &ny, double &hy, int &nz,
 	hz = hzAttr.get();
 }
 
+std::vector<double> XFile::HeaderGroup::readGrid(void) const {
+
+	std::vector<double> grid;
+
+	// Older files do not have the grid dataset
+	bool datasetExist = H5Lexists(getId(), "grid", H5P_DEFAULT);
+	if (!datasetExist)
+		return grid;
+
+	// Open the dataset
+	hid_t datasetId = H5Dopen(getId(), "grid", H5P_DEFAULT);
+
+	// Get the dimensions of the dataset
+	std::array<hsize_t, 1> dims;
+	// Get the dataspace object
+	hid_t dataspaceId = H5Dget_space(datasetId);
+	auto status = H5Sget_simple_extent_dims(dataspaceId, dims.data(), nullptr);
+
+	// Read the data set
+	grid.resize(dims[0]);
+	status = H5Dread(datasetId, H5T_IEEE_F64LE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
+			grid.data());
+
+	// Close everything
+	status = H5Sclose(dataspaceId);
+	status = H5Dclose(datasetId);
+
+	return grid;
+}
+
 XFile::HeaderGroup::NetworkCompsType XFile::HeaderGroup::readNetworkComps(
 		void) const {
 
@@ -854,6 +944,8 @@ const std::string XFile::TimestepGroup::nTAttrName = "nTritium";
 const std::string XFile::TimestepGroup::prevTFluxAttrName = "previousTFlux";
 
 const std::string XFile::TimestepGroup::concDatasetName = "concs";
+const std::string XFile::TimestepGroup::deltaConcDatasetName = "deltaConcs";
+const std::string XFile::TimestepGroup::deltaBaseAttrName = "deltaBase";
 
 std::string XFile::TimestepGroup::makeGroupName(
 		const XFile::ConcentrationGroup& concGroup, int timeStep) {
@@ -1181,9 +1273,401 @@ void XFile::TimestepGroup::writeConcentrations(const XFile& file, int baseX,
 XFile::TimestepGroup::Concs1DType XFile::TimestepGroup::readConcentrations(
 		const XFile& file, int baseX, int numX) const {
 
-	// Open and read the ragged dataset.
-	RaggedDataSet2D<ConcType> dataset(file.getComm(), *this, concDatasetName);
-	return dataset.read(baseX, numX);
+	if (not isDelta()) {
+		// Open and read the ragged dataset.
+		RaggedDataSet2D<ConcType> dataset(file.getComm(), *this,
+				concDatasetName);
+		return dataset.read(baseX, numX);
+	}
+
+	// Reconstruct the time step we are relative to, it may itself be
+	// relative to a previous one until the last full one.
+	Attribute<int> deltaBaseAttr(*this, deltaBaseAttrName);
+	int baseTimeStep = deltaBaseAttr.get();
+	ConcentrationGroup concGroup(file);
+	auto baseGroup = concGroup.getTimestepGroup(baseTimeStep);
+	if (not baseGroup) {
+		std::ostringstream estr;
+		estr << "Unable to open time step " << baseTimeStep
+				<< " needed to reconstruct " << getName();
+		throw HDF5Exception(estr.str());
+	}
+	auto concs = baseGroup->readConcentrations(file, baseX, numX);
+
+	// Apply our changes.
+	RaggedDataSet2D<ConcType> dataset(file.getComm(), *this,
+			deltaConcDatasetName);
+	auto deltaConcs = dataset.read(baseX, numX);
+	for (int i = 0; i < numX; ++i) {
+		applyDelta(concs[i], deltaConcs[i]);
+	}
+	return concs;
+}
+
+void XFile::TimestepGroup::writeDeltaConcentrations(const XFile& file,
+		int baseX, const Concs1DType& raggedConcs, int baseTimeStep) const {
+
+	// Create and write the ragged dataset.
+	RaggedDataSet2D<ConcType> dataset(file.getComm(), *this,
+			deltaConcDatasetName, baseX, raggedConcs);
+
+	// Add the time step we are relative to.
+	XFile::ScalarDataSpace scalarDSpace;
+	Attribute<int> deltaBaseAttr(*this, deltaBaseAttrName, scalarDSpace);
+	deltaBaseAttr.setTo(baseTimeStep);
+}
+
+bool XFile::TimestepGroup::isDelta(void) const {
+
+	return H5Lexists(getId(), deltaConcDatasetName.c_str(), H5P_DEFAULT) > 0;
+}
+
+XFile::TimestepGroup::Concs1DType::value_type XFile::TimestepGroup::computeDelta(
+		const Concs1DType::value_type& saved,
+		const Concs1DType::value_type& current, double tolerance) {
+
+	// Both are sorted by index, walk them together.
+	Concs1DType::value_type delta;
+	auto savedIter = saved.begin();
+	auto currIter = current.begin();
+	while (savedIter != saved.end() or currIter != current.end()) {
+		if (currIter == current.end()
+				or (savedIter != saved.end()
+						and savedIter->first < currIter->first)) {
+			// Not there anymore
+			delta.emplace_back(savedIter->first, 0.0);
+			++savedIter;
+		} else if (savedIter == saved.end()
+				or currIter->first < savedIter->first) {
+			// New one
+			delta.emplace_back(*currIter);
+			++currIter;
+		} else {
+			// Only save it if it changed enough
+			if (std::fabs(currIter->second - savedIter->second)
+					> tolerance * std::fabs(savedIter->second)) {
+				delta.emplace_back(*currIter);
+			}
+			++savedIter;
+			++currIter;
+		}
+	}
+
+	return delta;
+}
+
+void XFile::TimestepGroup::applyDelta(Concs1DType::value_type& concs,
+		const Concs1DType::value_type& delta) {
+
+	if (delta.empty())
+		return;
+
+	// Both are sorted by index, merge them.
+	Concs1DType::value_type merged;
+	merged.reserve(concs.size() + delta.size());
+	auto concIter = concs.begin();
+	auto deltaIter = delta.begin();
+	while (concIter != concs.end() or deltaIter != delta.end()) {
+		if (deltaIter == delta.end()
+				or (concIter != concs.end()
+						and concIter->first < deltaIter->first)) {
+			merged.emplace_back(*concIter);
+			++concIter;
+		} else {
+			// The change replaces the value, a zero removes it
+			if (deltaIter->second != 0.0)
+				merged.emplace_back(*deltaIter);
+			if (concIter != concs.end() and concIter->first == deltaIter->first)
+				++concIter;
+			++deltaIter;
+		}
+	}
+	concs = std::move(merged);
+}
+
+namespace {
+
+/**
+ * Split the grid points in contiguous chunks of balanced sizes, one for
+ * each process.
+ *
+ * @param nPoints The total number of grid points.
+ * @param commSize The number of processes.
+ * @return The first point of each chunk, plus nPoints at the end.
+ */
+std::vector<int> getChunkStarts(int nPoints, int commSize) {
+
+	std::vector<int> starts(commSize + 1);
+	for (int r = 0; r <= commSize; ++r) {
+		starts[r] = (int) (((long long) nPoints * r) / commSize);
+	}
+	return starts;
+}
+
+/**
+ * Find which process has a grid point in its chunk.
+ *
+ * @param starts The first point of each chunk.
+ * @param point The linear index of the grid point.
+ * @return The rank of the process.
+ */
+int getChunkOwner(const std::vector<int>& starts, int point) {
+
+	return (std::upper_bound(starts.begin(), starts.end(), point)
+			- starts.begin()) - 1;
+}
+
+/**
+ * Sort grid points by destination process.
+ *
+ * @param destinations The destination of each point.
+ * @param commSize The number of processes.
+ * @param sendCounts The number of points going to each process.
+ * @return The positions of the points, ordered by destination.
+ */
+std::vector<int> sortByDestination(const std::vector<int>& destinations,
+		int commSize, std::vector<int>& sendCounts) {
+
+	sendCounts.assign(commSize, 0);
+	for (auto dest : destinations) {
+		++sendCounts[dest];
+	}
+	std::vector<int> offsets(commSize, 0);
+	std::partial_sum(sendCounts.begin(), sendCounts.end() - 1,
+			offsets.begin() + 1);
+	std::vector<int> order(destinations.size());
+	for (std::size_t n = 0; n < destinations.size(); ++n) {
+		order[offsets[destinations[n]]++] = n;
+	}
+	return order;
+}
+
+/**
+ * Exchange ragged concentrations between all the processes.  Collective.
+ *
+ * @param comm The MPI communicator.
+ * @param sendCounts The number of points we send to each process.
+ * @param sendPoints The points we send, ordered by destination.
+ * @param sendConcs The concentrations of the points we send.
+ * @param recvPoints The points we receive, ordered by source.
+ * @return The concentrations of the points we receive.
+ */
+XFile::TimestepGroup::Concs1DType exchangeConcentrations(MPI_Comm comm,
+		const std::vector<int>& sendCounts, const std::vector<int>& sendPoints,
+		const XFile::TimestepGroup::Concs1DType& sendConcs,
+		std::vector<int>& recvPoints) {
+
+	using ConcType = XFile::TimestepGroup::ConcType;
+	int commSize;
+	MPI_Comm_size(comm, &commSize);
+
+	// Tell everyone how many points they will receive from us.
+	std::vector<int> recvCounts(commSize);
+	MPI_Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT,
+			comm);
+	std::vector<int> sendDispls(commSize, 0), recvDispls(commSize, 0);
+	std::partial_sum(sendCounts.begin(), sendCounts.end() - 1,
+			sendDispls.begin() + 1);
+	std::partial_sum(recvCounts.begin(), recvCounts.end() - 1,
+			recvDispls.begin() + 1);
+	int nRecvPoints = recvDispls.back() + recvCounts.back();
+
+	// Exchange the points and their number of concentrations.
+	recvPoints.resize(nRecvPoints);
+	MPI_Alltoallv(sendPoints.data(), sendCounts.data(), sendDispls.data(),
+			MPI_INT, recvPoints.data(), recvCounts.data(), recvDispls.data(),
+			MPI_INT, comm);
+	std::vector<int> sendSizes(sendConcs.size());
+	for (std::size_t n = 0; n < sendConcs.size(); ++n) {
+		sendSizes[n] = sendConcs[n].size();
+	}
+	std::vector<int> recvSizes(nRecvPoints);
+	MPI_Alltoallv(sendSizes.data(), sendCounts.data(), sendDispls.data(),
+			MPI_INT, recvSizes.data(), recvCounts.data(), recvDispls.data(),
+			MPI_INT, comm);
+
+	// Exchange the flattened concentrations, counted in elements of a
+	// contiguous type so large exchanges do not overflow the int counts.
+	std::vector<int> sendElems(commSize, 0), recvElems(commSize, 0);
+	std::vector<int> sendElemDispls(commSize, 0), recvElemDispls(commSize, 0);
+	auto countElements = [commSize](const std::vector<int>& pointCounts,
+			const std::vector<int>& sizes, std::vector<int>& elems,
+			std::vector<int>& displs) {
+		long long total = 0;
+		for (int r = 0, n = 0; r < commSize; ++r) {
+			long long count = 0;
+			for (int m = 0; m < pointCounts[r]; ++m, ++n) {
+				count += sizes[n];
+			}
+			if (total + count > std::numeric_limits<int>::max()) {
+				std::ostringstream estr;
+				estr << "exchangeConcentrations: too many concentrations ("
+						<< total + count << ") to exchange in one call.";
+				throw HDF5Exception(estr.str());
+			}
+			elems[r] = (int) count;
+			displs[r] = (int) total;
+			total += count;
+		}
+		return total;
+	};
+	countElements(sendCounts, sendSizes, sendElems, sendElemDispls);
+	auto nRecvElems = countElements(recvCounts, recvSizes, recvElems,
+			recvElemDispls);
+	std::vector<ConcType> sendFlat;
+	for (auto const& currConcs : sendConcs) {
+		sendFlat.insert(sendFlat.end(), currConcs.begin(), currConcs.end());
+	}
+	std::vector<ConcType> recvFlat(nRecvElems);
+	MPI_Datatype concMPIType;
+	MPI_Type_contiguous(sizeof(ConcType), MPI_BYTE, &concMPIType);
+	MPI_Type_commit(&concMPIType);
+	MPI_Alltoallv(sendFlat.data(), sendElems.data(), sendElemDispls.data(),
+			concMPIType, recvFlat.data(), recvElems.data(),
+			recvElemDispls.data(), concMPIType, comm);
+	MPI_Type_free(&concMPIType);
+
+	// Convert back to the ragged representation.
+	XFile::TimestepGroup::Concs1DType recvConcs(nRecvPoints);
+	auto currItem = recvFlat.begin();
+	for (int n = 0; n < nRecvPoints; ++n) {
+		recvConcs[n].assign(currItem, currItem + recvSizes[n]);
+		currItem += recvSizes[n];
+	}
+	return recvConcs;
+}
+
+/**
+ * Send the concentrations of our grid points to the processes writing the
+ * contiguous chunk they belong to.
+ *
+ * @param comm The communicator of the file.
+ * @param nPoints The total number of grid points.
+ * @param gridPoints The linear indices of the points we own.
+ * @param raggedConcs Concentrations associated with the points we own.
+ * @param baseX The first point of our chunk.
+ * @return The concentrations of the points of our chunk.
+ */
+XFile::TimestepGroup::Concs1DType redistributeConcentrations(MPI_Comm comm,
+		int nPoints, const std::vector<int>& gridPoints,
+		const XFile::TimestepGroup::Concs1DType& raggedConcs, int& baseX) {
+
+	int commRank, commSize;
+	MPI_Comm_rank(comm, &commRank);
+	MPI_Comm_size(comm, &commSize);
+
+	// Send each of our points to the process writing it.
+	auto starts = getChunkStarts(nPoints, commSize);
+	std::vector<int> destinations(gridPoints.size());
+	std::transform(gridPoints.begin(), gridPoints.end(), destinations.begin(),
+			[&starts](int point) {
+				return getChunkOwner(starts, point);
+			});
+	std::vector<int> sendCounts;
+	auto order = sortByDestination(destinations, commSize, sendCounts);
+	std::vector<int> sendPoints(order.size());
+	XFile::TimestepGroup::Concs1DType sendConcs(order.size());
+	for (std::size_t n = 0; n < order.size(); ++n) {
+		sendPoints[n] = gridPoints[order[n]];
+		sendConcs[n] = raggedConcs[order[n]];
+	}
+	std::vector<int> recvPoints;
+	auto recvConcs = exchangeConcentrations(comm, sendCounts,
+			sendPoints, sendConcs, recvPoints);
+
+	// Put them in order.
+	baseX = starts[commRank];
+	XFile::TimestepGroup::Concs1DType chunkConcs(starts[commRank + 1] - baseX);
+	for (std::size_t n = 0; n < recvPoints.size(); ++n) {
+		chunkConcs[recvPoints[n] - baseX] = std::move(recvConcs[n]);
+	}
+	return chunkConcs;
+}
+
+} // namespace
+
+void XFile::TimestepGroup::writeConcentrations(const XFile& file, int nPoints,
+		const std::vector<int>& gridPoints,
+		const Concs1DType& raggedConcs) const {
+
+	// Write our chunk.
+	int baseX = 0;
+	auto chunkConcs = redistributeConcentrations(file.getComm(), nPoints,
+			gridPoints, raggedConcs, baseX);
+	writeConcentrations(file, baseX, chunkConcs);
+}
+
+void XFile::TimestepGroup::writeDeltaConcentrations(const XFile& file,
+		int nPoints, const std::vector<int>& gridPoints,
+		const Concs1DType& raggedConcs, int baseTimeStep) const {
+
+	// Write our chunk.
+	int baseX = 0;
+	auto chunkConcs = redistributeConcentrations(file.getComm(), nPoints,
+			gridPoints, raggedConcs, baseX);
+	writeDeltaConcentrations(file, baseX, chunkConcs, baseTimeStep);
+}
+
+XFile::TimestepGroup::Concs1DType XFile::TimestepGroup::readConcentrations(
+		const XFile& file, int nPoints,
+		const std::vector<int>& gridPoints) const {
+
+	int commRank, commSize;
+	MPI_Comm_rank(file.getComm(), &commRank);
+	MPI_Comm_size(file.getComm(), &commSize);
+
+	// Read our chunk in one collective operation.
+	auto starts = getChunkStarts(nPoints, commSize);
+	int baseX = starts[commRank];
+	auto chunkConcs = readConcentrations(file, baseX,
+			starts[commRank + 1] - baseX);
+
+	// Ask the processes that read our points for them.
+	std::vector<int> sources(gridPoints.size());
+	std::transform(gridPoints.begin(), gridPoints.end(), sources.begin(),
+			[&starts](int point) {
+				return getChunkOwner(starts, point);
+			});
+	std::vector<int> requestCounts;
+	auto order = sortByDestination(sources, commSize, requestCounts);
+	std::vector<int> requestedPoints(order.size());
+	for (std::size_t n = 0; n < order.size(); ++n) {
+		requestedPoints[n] = gridPoints[order[n]];
+	}
+	std::vector<int> askedCounts(commSize);
+	MPI_Alltoall(requestCounts.data(), 1, MPI_INT, askedCounts.data(), 1,
+			MPI_INT, file.getComm());
+	std::vector<int> requestDispls(commSize, 0), askedDispls(commSize, 0);
+	std::partial_sum(requestCounts.begin(), requestCounts.end() - 1,
+			requestDispls.begin() + 1);
+	std::partial_sum(askedCounts.begin(), askedCounts.end() - 1,
+			askedDispls.begin() + 1);
+	std::vector<int> askedPoints(askedDispls.back() + askedCounts.back());
+	MPI_Alltoallv(requestedPoints.data(), requestCounts.data(),
+			requestDispls.data(), MPI_INT, askedPoints.data(),
+			askedCounts.data(), askedDispls.data(), MPI_INT, file.getComm());
+
+	// Answer, in the order of the requests.
+	Concs1DType answerConcs(askedPoints.size());
+	for (std::size_t n = 0; n < askedPoints.size(); ++n) {
+		answerConcs[n] = chunkConcs[askedPoints[n] - baseX];
+	}
+	std::vector<int> recvPoints;
+	auto recvConcs = exchangeConcentrations(file.getComm(), askedCounts,
+			askedPoints, answerConcs, recvPoints);
+
+	// The answers come back in the order we asked.
+	Concs1DType ret(gridPoints.size());
+	for (std::size_t n = 0; n < order.size(); ++n) {
+		ret[order[n]] = std::move(recvConcs[n]);
+	}
+	return ret;
+}
+
+bool XFile::TimestepGroup::hasConcentrations(void) const {
+
+	return H5Lexists(getId(), concDatasetName.c_str(), H5P_DEFAULT) > 0
+			or isDelta();
 }
 
 std::pair<double, double> XFile::TimestepGroup::readTimes(void) const {
@@ -56,6 +56,11 @@ public:
 		// Name of the concentrations data set.
 		static const std::string concDatasetName;
 
+		// Names of the incremental concentrations data set and of the
+		// time step it is relative to.
+		static const std::string deltaConcDatasetName;
+		static const std::string deltaBaseAttrName;
+
 		/**
 		 * Construct the group name for the given time step.
 		 *
@@ -207,7 +212,8 @@ public:
 		/**
 		 * Read concentration dataset for our grid points in a 1D problem.
 		 * Assumes that grid point slabs are assigned to processes in
-		 * MPI rank order.
+		 * MPI rank order.  Incremental concentrations are reconstructed
+		 * from the previous time steps.
 		 *
 		 * @param file The HDF5 file that owns our group.  Needed to support
 		 *              parallel file access.
@@ -220,6 +226,114 @@ public:
 		Concs1DType readConcentrations(const XFile& file, int baseX,
 				int numX) const;
 
+		/**
+		 * Add a concentration dataset for all grid points in a problem
+		 * where the points owned by each process are not a contiguous
+		 * slab (2D and 3D).  The points are identified by their linear
+		 * index i + nX * (j + nY * k).  The concentrations are first
+		 * redistributed so that each process writes a contiguous chunk
+		 * of the points, in the same format as the 1D dataset.
+		 * Collective, every process must own at least one point.
+		 *
+		 * @param file The HDF5 file that owns our group.
+		 * @param nPoints The total number of grid points.
+		 * @param gridPoints The linear indices of the points we own.
+		 * @param concs Concentrations associated with the points we own.
+		 *              Element n contains concentration data for
+		 *              gridPoints[n]
+		 */
+		void writeConcentrations(const XFile& file, int nPoints,
+				const std::vector<int>& gridPoints,
+				const Concs1DType& concs) const;
+
+		/**
+		 * Read the concentration dataset for any set of grid points,
+		 * whatever the decomposition the file was written with.  Each
+		 * process reads a contiguous chunk of the points with a
+		 * collective read, then the concentrations are sent to the
+		 * processes that asked for them.  Collective.
+		 *
+		 * @param file The HDF5 file that owns our group.
+		 * @param nPoints The total number of grid points.
+		 * @param gridPoints The linear indices of the points we want.
+		 * @return Concentrations associated with the points we want.
+		 *              Element n contains concentration data for
+		 *              gridPoints[n]
+		 */
+		Concs1DType readConcentrations(const XFile& file, int nPoints,
+				const std::vector<int>& gridPoints) const;
+
+		/**
+		 * Check whether the concentrations were saved in a single
+		 * dataset, full or incremental, or with one dataset per grid
+		 * point (older files).
+		 *
+		 * @return True if the concentration dataset exists
+		 */
+		bool hasConcentrations(void) const;
+
+		/**
+		 * Add an incremental concentration dataset for all grid points in
+		 * a 1D problem.  Only the concentrations that changed since the
+		 * given time step are saved, the other ones are read from it.
+		 *
+		 * @param file The HDF5 file that owns our group.
+		 * @param baseX Index of first grid point we own.
+		 * @param concs Concentration changes associated with the grid
+		 *              points we own, see computeDelta.
+		 * @param baseTimeStep The previous time step saved in the file.
+		 */
+		void writeDeltaConcentrations(const XFile& file, int baseX,
+				const Concs1DType& concs, int baseTimeStep) const;
+
+		/**
+		 * Add an incremental concentration dataset for all grid points in
+		 * a 2D or 3D problem, see writeConcentrations.
+		 *
+		 * @param file The HDF5 file that owns our group.
+		 * @param nPoints The total number of grid points.
+		 * @param gridPoints The linear indices of the points we own.
+		 * @param concs Concentration changes associated with the points
+		 *              we own, see computeDelta.
+		 * @param baseTimeStep The previous time step saved in the file.
+		 */
+		void writeDeltaConcentrations(const XFile& file, int nPoints,
+				const std::vector<int>& gridPoints, const Concs1DType& concs,
+				int baseTimeStep) const;
+
+		/**
+		 * Check whether the concentrations of this time step were saved
+		 * as changes from a previous one.  readConcentrations
+		 * reconstructs them either way.
+		 *
+		 * @return True if the concentrations are incremental
+		 */
+		bool isDelta(void) const;
+
+		/**
+		 * Compute the changes to save for one grid point, the entries of
+		 * the current concentrations that differ from the saved ones by
+		 * more than the relative tolerance, and a zero for each saved
+		 * entry that is not there anymore.
+		 *
+		 * @param saved The concentrations as they are in the file.
+		 * @param current The current concentrations.
+		 * @param tolerance The relative tolerance.
+		 * @return The changes, sorted by index
+		 */
+		static Concs1DType::value_type computeDelta(
+				const Concs1DType::value_type& saved,
+				const Concs1DType::value_type& current, double tolerance);
+
+		/**
+		 * Apply the changes of one grid point, a zero removes the entry.
+		 *
+		 * @param concs The concentrations to update, sorted by index.
+		 * @param delta The changes, sorted by index.
+		 */
+		static void applyDelta(Concs1DType::value_type& concs,
+				const Concs1DType::value_type& delta);
+
 		/**
 		 * Read the times from our timestep group.
 		 *
@@ -428,6 +542,14 @@ public:
 		void read(int &nx, double &hx, int &ny, double &hy, int &nz,
 				double &hz) const;
 
+		/**
+		 * Read the positions of the grid points in the x direction.
+		 *
+		 * @return The positions relative to the first point, empty if
+		 *         the grid was not saved in the file.
+		 */
+		std::vector<double> readGrid(void) const;
+
 		/**
 		 * Read our network compositions.
 		 *
@@ -639,6 +761,31 @@ public:
 	XFile(fs::path path, MPI_Comm _comm = MPI_COMM_WORLD, AccessMode mode =
 			AccessMode::OpenReadOnly);
 
+	/**
+	 * Open an in-memory image of a checkpoint or network file, read only.
+	 *
+	 * @param path Path of the file the image was taken from.
+	 * @param image The content of the file.
+	 * @param _comm The MPI communicator of the processes sharing the image.
+	 */
+	XFile(fs::path path, const std::vector<char>& image, MPI_Comm _comm =
+			MPI_COMM_WORLD);
+
+	/**
+	 * Open the header and network groups of an existing file without
+	 * having all the processes access it: the root process copies them in
+	 * memory and sends the image to the others.  The concentrations are not
+	 * copied, they must be read from the file itself.
+	 *
+	 * This method blocks until it is called by all processes.
+	 *
+	 * @param path Path of file to read.
+	 * @param _comm The MPI communicator of the processes.
+	 * @return The in-memory file with the header and network groups.
+	 */
+	static std::unique_ptr<XFile> stage(fs::path path, MPI_Comm _comm =
+			MPI_COMM_WORLD);
+
 	/**
 	 * Check whether we have one of our top-level Groups.
 	 *
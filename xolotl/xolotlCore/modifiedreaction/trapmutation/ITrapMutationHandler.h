@@ -86,6 +86,41 @@ public:
 			std::vector<IAdvectionHandler *> advectionHandlers,
 			std::vector<double> grid, int ny, double hy, int nz, double hz) = 0;
 
+	/**
+	 * This method redefines which trap-mutation is allowed in the column yj
+	 * after its surface moved. Only the grid points xs to xs + xm - 1 are
+	 * updated, the other ones are not used by this process.
+	 *
+	 * @param yj The index of the column in the Y direction
+	 * @param surfacePos The new index of the position of the surface
+	 * @param advectionHandlers The vector of advection handlers
+	 * @param grid The grid on the x axis
+	 * @param hy The step size in the Y direction
+	 * @param xs The beginning of the grid on this process
+	 * @param xm The number of grid points on this process
+	 */
+	virtual void updateIndex2D(int yj, int surfacePos,
+			std::vector<IAdvectionHandler *> advectionHandlers,
+			std::vector<double> grid, double hy, int xs, int xm) = 0;
+
+	/**
+	 * This method redefines which trap-mutation is allowed in the column
+	 * (yj, zk) after its surface moved. Only the grid points xs to xs + xm - 1
+	 * are updated, the other ones are not used by this process.
+	 *
+	 * @param yj The index of the column in the Y direction
+	 * @param zk The index of the column in the Z direction
+	 * @param surfacePos The new index of the position of the surface
+	 * @param advectionHandlers The vector of advection handlers
+	 * @param grid The grid on the x axis
+	 * @param hy The step size in the Y direction
+	 * @param xs The beginning of the grid on this process
+	 * @param xm The number of grid points on this process
+	 */
+	virtual void updateIndex3D(int yj, int zk, int surfacePos,
+			std::vector<IAdvectionHandler *> advectionHandlers,
+			std::vector<double> grid, double hy, int xs, int xm) = 0;
+
 	/**
 	 * This method update the rate for the modified trap-mutation if the rates
 	 * changed in the network, it should be called when temperature changes
@@ -8,6 +8,19 @@ namespace xolotlCore {
 
 void TrapMutationHandler::initialize(const IReactionNetwork& network,
 		std::vector<double> grid, int ny, double hy, int nz, double hz) {
+	// Store the bubbles that can be created by trap-mutation
+	// with their number of helium and vacancy
+	bubbleMap.clear();
+	for (auto const& heVMapItem : network.getAll(ReactantType::PSIMixed)) {
+		auto& bubble = *(heVMapItem.second);
+		auto const& comp = bubble.getComposition();
+		if (comp[toCompIdx(Species::D)] == 0
+				&& comp[toCompIdx(Species::T)] == 0) {
+			bubbleMap[std::make_pair(comp[toCompIdx(Species::He)],
+					comp[toCompIdx(Species::V)])] = &bubble;
+		}
+	}
+
 	// Add the needed reaction (dissociation) connectivity
 	// Each (He_i)(V) cluster and I clusters are connected to He_i
 
@@ -115,70 +128,91 @@ void TrapMutationHandler::initialize(const IReactionNetwork& network,
 	return;
 }
 
-void TrapMutationHandler::initializeIndex1D(int surfacePos,
-		const IReactionNetwork& network,
-		std::vector<IAdvectionHandler *> advectionHandlers,
-		std::vector<double> grid) {
-	// Clear the vector of HeV indices created by He undergoing trap-mutation
-	// at each grid point
-	tmBubbles.clear();
-
-	// No GB trap mutation handler in 1D for now
-
-	// Create the temporary 2D vector
-	ReactantRefVector2D temp2DVector;
-	// Create the temporary 1D vector
-	ReactantRefVector1D temp1DVector;
+void TrapMutationHandler::initializeColumn(ReactantRefVector1D& column,
+		int surfacePos, double yPos,
+		const std::vector<IAdvectionHandler *>& advectionHandlers,
+		const std::vector<double>& grid, int xs, int xm) {
+	// The bubbles created near the grain boundaries only depend on the
+	// Y position of the column
+	IReactant::RefVector gbBubbles;
+	// Loop on the GB advection handlers
+	for (std::size_t n = 1; n < advectionHandlers.size(); n++) {
+		// Get the current distance from the GB
+		double distance = fabs(yPos - advectionHandlers[n]->getLocation());
+		// Loop on the sigma 3 distance vector
+		for (std::size_t l = 0; l < sigma3DistanceVec.size(); l++) {
+			// Check if a helium cluster undergo TM at this distance
+			if (std::fabs(distance - sigma3DistanceVec[l]) < 0.01) {
+				// Add the bubble of size l+1
+				auto bubble = getBubble(l + 1, sigma3SizeVec[l]);
+				if (bubble)
+					gbBubbles.emplace_back(*bubble);
+			}
+		}
+	}
 
 	// Loop on the grid points in the depth direction
-	for (int i = 0; i < grid.size() - 2; i++) {
+	for (int i = xs; i < xs + xm; i++) {
+		// Create the list (vector) of indices at this grid point
+		auto& indices = column[i];
+		indices.clear();
+
 		// If we are on the left side of the surface there is no
 		// modified trap-mutation
-		if (i <= surfacePos) {
-			temp1DVector.emplace_back();
+		if (i <= surfacePos)
 			continue;
-		}
 
 		// Get the depth
 		double depth = grid[i + 1] - grid[surfacePos + 1];
 		double previousDepth = grid[i] - grid[surfacePos + 1];
 
 		// Loop on the depth vector
-		std::vector<std::reference_wrapper<IReactant> > indices;
 		for (int l = 0; l < depthVec.size(); l++) {
 			// Check if a helium cluster undergo TM at this depth
 			if (std::fabs(depth - depthVec[l]) < 0.01
 					|| (depthVec[l] - 0.01 < depth
 							&& depthVec[l] - 0.01 > previousDepth)) {
 				// Add the bubble of size l+1 to the indices
-				// Loop on the bubbles
-				for (auto const& heVMapItem : network.getAll(
-						ReactantType::PSIMixed)) {
-					// Get the bubble and its composition
-					auto& bubble =
-							static_cast<PSICluster&>(*(heVMapItem.second));
-					auto const& comp = bubble.getComposition();
-					// Get the correct bubble
-					if (comp[toCompIdx(Species::He)] == l + 1
-							&& comp[toCompIdx(Species::V)] == sizeVec[l]
-							&& comp[toCompIdx(Species::D)] == 0
-							&& comp[toCompIdx(Species::T)] == 0) {
-						// Add this bubble to the indices
-						indices.emplace_back(bubble);
-					}
-				}
+				auto bubble = getBubble(l + 1, sizeVec[l]);
+				if (bubble)
+					indices.emplace_back(*bubble);
 			}
 		}
 
-		// Add indices to the index vector
-		temp1DVector.emplace_back(indices);
+		// Add the grain boundary bubbles
+		for (IReactant& bubble : gbBubbles) {
+			// Check if this bubble is already
+			// associated with this grid point.
+			auto biter = std::find_if(indices.begin(), indices.end(),
+					[&bubble](const IReactant& testReactant) {
+						return testReactant.getId() == bubble.getId();
+					});
+			if (biter == indices.end()) {
+				// Add this bubble to the indices
+				indices.emplace_back(bubble);
+			}
+		}
 	}
 
-	// Give the 1D vector to the 2D vector
-	temp2DVector.emplace_back(temp1DVector);
+	return;
+}
 
-	// Give the 2D vector to the final vector
-	tmBubbles.emplace_back(temp2DVector);
+void TrapMutationHandler::initializeIndex1D(int surfacePos,
+		const IReactionNetwork& network,
+		std::vector<IAdvectionHandler *> advectionHandlers,
+		std::vector<double> grid) {
+	// Clear the vector of HeV indices created by He undergoing trap-mutation
+	// at each grid point
+	tmBubbles.clear();
+
+	// No GB trap mutation handler in 1D for now
+	int nX = grid.size() - 2;
+	ReactantRefVector1D temp1DVector(nX);
+	initializeColumn(temp1DVector, surfacePos, 0.0,
+			std::vector<IAdvectionHandler *>(), grid, 0, nX);
+
+	// Give the 1D vector to the final vector
+	tmBubbles.emplace_back(ReactantRefVector2D(1, temp1DVector));
 
 	return;
 }
@@ -191,122 +225,19 @@ void TrapMutationHandler::initializeIndex2D(std::vector<int> surfacePos,
 	// at each grid point
 	tmBubbles.clear();
 
-	// Create a Sigma 3 trap mutation handler because it is the
-	// only one available right now
-	auto sigma3Handler = new Sigma3TrapMutationHandler();
-	auto sigma3DistanceVec = sigma3Handler->getDistanceVector();
-	auto sigma3SizeVec = sigma3Handler->getSizeVector();
-
 	// Create the temporary 2D vector
-	ReactantRefVector2D temp2DVector;
+	int nX = grid.size() - 2;
+	ReactantRefVector2D temp2DVector(ny, ReactantRefVector1D(nX));
 
 	// Loop on the grid points in the Y direction
-	temp2DVector.reserve(ny);
 	for (int j = 0; j < ny; j++) {
-
-		// Create the temporary 1D vector
-		ReactantRefVector1D temp1DVector;
-
-		// Loop on the grid points in the depth direction
-		for (int i = 0; i < grid.size() - 2; i++) {
-			// Create the list (vector) of indices at this grid point
-			std::vector<std::reference_wrapper<IReactant> > indices;
-
-			// If we are on the left side of the surface there is no
-			// modified trap-mutation
-			if (i <= surfacePos[j]) {
-				temp1DVector.push_back(indices);
-				continue;
-			}
-
-			// Get the depth
-			double depth = grid[i + 1] - grid[surfacePos[j] + 1];
-			double previousDepth = grid[i] - grid[surfacePos[j] + 1];
-
-			// Loop on the depth vector
-			for (int l = 0; l < depthVec.size(); l++) {
-				// Check if a helium cluster undergo TM at this depth
-				if (std::fabs(depth - depthVec[l]) < 0.01
-						|| (depthVec[l] - 0.01 < depth
-								&& depthVec[l] - 0.01 > previousDepth)) {
-					// Add the bubble of size l+1 to the indices
-					// Loop on the bubbles
-					for (auto const& heVMapItem : network.getAll(
-							ReactantType::PSIMixed)) {
-						// Get the bubble and its composition
-						auto& bubble =
-								static_cast<PSICluster&>(*(heVMapItem.second));
-						auto const& comp = bubble.getComposition();
-						// Get the correct bubble
-						if (comp[toCompIdx(Species::He)] == l + 1
-								&& comp[toCompIdx(Species::V)] == sizeVec[l]
-								&& comp[toCompIdx(Species::D)] == 0
-								&& comp[toCompIdx(Species::T)] == 0) {
-							// Add this bubble to the indices
-							indices.emplace_back(bubble);
-						}
-					}
-				}
-			}
-
-			// Get the Y position
-			double yPos = (double) j * hy;
-			// Loop on the GB advection handlers
-			for (int n = 1; n < advectionHandlers.size(); n++) {
-				// Get the location of the GB
-				double location = advectionHandlers[n]->getLocation();
-				// Get the current distance from the GB
-				double distance = fabs(yPos - location);
-				// Loop on the sigma 3 distance vector
-				for (int l = 0; l < sigma3DistanceVec.size(); l++) {
-					// Check if a helium cluster undergo TM at this depth
-					if (std::fabs(distance - sigma3DistanceVec[l]) < 0.01) {
-						// Add the bubble of size l+1 to the indices
-						// Loop on the bubbles
-						for (auto const& heVMapItem : network.getAll(
-								ReactantType::PSIMixed)) {
-							// Get the bubble and its composition
-							auto& bubble =
-									static_cast<PSICluster&>(*(heVMapItem.second));
-							auto const& comp = bubble.getComposition();
-							// Get the correct bubble
-							if (comp[toCompIdx(Species::He)] == l + 1
-									&& comp[toCompIdx(Species::V)]
-											== sigma3SizeVec[l]
-									&& comp[toCompIdx(Species::D)] == 0
-									&& comp[toCompIdx(Species::T)] == 0) {
-								// Check if this bubble is already 
-								// associated with this grid point.
-								auto biter =
-										std::find_if(indices.begin(),
-												indices.end(),
-												[&bubble](const IReactant& testReactant) {
-													return testReactant.getId() == bubble.getId();
-												});
-								if (biter == indices.end()) {
-									// Add this bubble to the indices
-									indices.emplace_back(bubble);
-								}
-							}
-						}
-					}
-				}
-			}
-
-			// Add indices to the index vector
-			temp1DVector.push_back(indices);
-		}
-
-		// Give the 1D vector to the 2D vector
-		temp2DVector.push_back(temp1DVector);
+		initializeColumn(temp2DVector[j], surfacePos[j], (double) j * hy,
+				advectionHandlers, grid, 0, nX);
 	}
 
 	// Give the 2D vector to the final vector
 	tmBubbles.push_back(temp2DVector);
 
-	// Clear the memory
-	delete sigma3Handler;
-
 	return;
 }
 
@@ -317,128 +248,34 @@ void TrapMutationHandler::initializeIndex3D(
 		std::vector<double> grid, int ny, double hy, int nz, double hz) {
 	// Clear the vector of HeV indices created by He undergoing trap-mutation
 	// at each grid point
-	tmBubbles.clear();
-
-	// Create a Sigma 3 trap mutation handler because it is the
-	// only one available right now
-	auto sigma3Handler = new Sigma3TrapMutationHandler();
-	auto sigma3DistanceVec = sigma3Handler->getDistanceVector();
-	auto sigma3SizeVec = sigma3Handler->getSizeVector();
+	int nX = grid.size() - 2;
+	tmBubbles.assign(nz, ReactantRefVector2D(ny, ReactantRefVector1D(nX)));
 
-	// Loop on the grid points in the Z direction
-	tmBubbles.reserve(nz);
+	// Loop on the grid points in the Z and Y directions
 	for (int k = 0; k < nz; k++) {
-
-		// Create the temporary 2D vector
-		ReactantRefVector2D temp2DVector;
-
-		// Loop on the grid points in the Y direction
-		temp2DVector.reserve(ny);
 		for (int j = 0; j < ny; j++) {
-			// Create the temporary 1D vector
-			ReactantRefVector1D temp1DVector;
-
-			// Loop on the grid points in the depth direction
-			for (int i = 0; i < grid.size() - 2; i++) {
-				// Create the list (vector) of indices at this grid point
-				std::vector<std::reference_wrapper<IReactant> > indices;
-
-				// If we are on the left side of the surface there is no
-				// modified trap-mutation
-				if (i <= surfacePos[j][k]) {
-					temp1DVector.emplace_back(indices);
-					continue;
-				}
-
-				// Get the depth
-				double depth = grid[i + 1] - grid[surfacePos[j][k] + 1];
-				double previousDepth = grid[i] - grid[surfacePos[j][k] + 1];
-
-				// Loop on the depth vector
-				for (int l = 0; l < depthVec.size(); l++) {
-					// Check if a helium cluster undergo TM at this depth
-					if (std::fabs(depth - depthVec[l]) < 0.01
-							|| (depthVec[l] - 0.01 < depth
-									&& depthVec[l] - 0.01 > previousDepth)) {
-						// Add the bubble of size l+1 to the indices
-						// Loop on the bubbles
-						for (auto const& heVMapItem : network.getAll(
-								ReactantType::PSIMixed)) {
-							// Get the bubble and its composition
-							auto& bubble =
-									static_cast<PSICluster&>(*(heVMapItem.second));
-							auto const& comp = bubble.getComposition();
-							// Get the correct bubble
-							if (comp[toCompIdx(Species::He)] == l + 1
-									&& comp[toCompIdx(Species::V)] == sizeVec[l]
-									&& comp[toCompIdx(Species::D)] == 0
-									&& comp[toCompIdx(Species::T)] == 0) {
-								// Add this bubble to the indices
-								indices.emplace_back(bubble);
-							}
-						}
-					}
-				}
-
-				// Get the Y position
-				double yPos = (double) j * hy;
-				// Loop on the GB advection handlers
-				for (int n = 1; n < advectionHandlers.size(); n++) {
-					// Get the location of the GB
-					double location = advectionHandlers[n]->getLocation();
-					// Get the current distance from the GB
-					double distance = fabs(yPos - location);
-
-					// Loop on the sigma 3 distance vector
-					for (int l = 0; l < sigma3DistanceVec.size(); l++) {
-						// Check if a helium cluster undergo TM at this depth
-						if (std::fabs(distance - sigma3DistanceVec[l]) < 0.01) {
-							// Add the bubble of size l+1 to the indices
-							// Loop on the bubbles
-							for (auto const& heVMapItem : network.getAll(
-									ReactantType::PSIMixed)) {
-								// Get the bubble and its composition
-								auto& bubble =
-										static_cast<PSICluster&>(*(heVMapItem.second));
-								auto const& comp = bubble.getComposition();
-								// Get the correct bubble
-								if (comp[toCompIdx(Species::He)] == l + 1
-										&& comp[toCompIdx(Species::V)]
-												== sigma3SizeVec[l]
-										&& comp[toCompIdx(Species::D)] == 0
-										&& comp[toCompIdx(Species::T)] == 0) {
-									// Check if this bubble is already
-									// associated with this grid point.
-									auto biter =
-											std::find_if(indices.begin(),
-													indices.end(),
-													[&bubble](const IReactant& testReactant) {
-														return testReactant.getId() == bubble.getId();
-													});
-									if (biter == indices.end()) {
-										// Add this bubble to the indices
-										indices.emplace_back(bubble);
-									}
-								}
-							}
-						}
-					}
-				}
+			initializeColumn(tmBubbles[k][j], surfacePos[j][k],
+					(double) j * hy, advectionHandlers, grid, 0, nX);
+		}
+	}
 
-				// Add indices to the index vector
-				temp1DVector.push_back(indices);
-			}
+	return;
+}
 
-			// Give the 1D vector to the 2D vector
-			temp2DVector.push_back(temp1DVector);
-		}
+void TrapMutationHandler::updateIndex2D(int yj, int surfacePos,
+		std::vector<IAdvectionHandler *> advectionHandlers,
+		std::vector<double> grid, double hy, int xs, int xm) {
+	initializeColumn(tmBubbles[0][yj], surfacePos, (double) yj * hy,
+			advectionHandlers, grid, xs, xm);
 
-		// Give the 2D vector to the final vector
-		tmBubbles.push_back(temp2DVector);
-	}
+	return;
+}
 
-	// Clear the memory
-	delete sigma3Handler;
+void TrapMutationHandler::updateIndex3D(int yj, int zk, int surfacePos,
+		std::vector<IAdvectionHandler *> advectionHandlers,
+		std::vector<double> grid, double hy, int xs, int xm) {
+	initializeColumn(tmBubbles[zk][yj], surfacePos, (double) yj * hy,
+			advectionHandlers, grid, xs, xm);
 
 	return;
 }
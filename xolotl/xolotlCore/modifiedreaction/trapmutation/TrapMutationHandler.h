@@ -5,6 +5,7 @@
 #include <ITrapMutationHandler.h>
 #include <Sigma3TrapMutationHandler.h>
 #include <Constants.h>
+#include <map>
 
 namespace xolotlCore {
 
@@ -66,6 +67,19 @@ protected:
 	using ReactantRefVector3D = std::vector<ReactantRefVector2D>;
 	ReactantRefVector3D tmBubbles;
 
+	/**
+	 * The bubbles that can be created through modified trap-mutation, without
+	 * deuterium nor tritium, by number of helium and vacancy. It is built once
+	 * so that the indices can be updated without scanning the network.
+	 */
+	std::map<std::pair<int, int>, IReactant *> bubbleMap;
+
+	//! The distances from the sigma 3 grain boundaries where trap-mutation happens
+	std::vector<double> sigma3DistanceVec;
+
+	//! The vacancy sizes for the trap-mutation near the sigma 3 grain boundaries
+	std::vector<int> sigma3SizeVec;
+
 	/**
 	 * The desorption information
 	 */
@@ -85,6 +99,37 @@ protected:
 		return;
 	}
 
+	/**
+	 * Get the bubble with the given number of helium and vacancy, and
+	 * neither deuterium nor tritium.
+	 *
+	 * @param heSize The number of helium
+	 * @param vSize The number of vacancy
+	 * @return The bubble, nullptr if it is not in the network
+	 */
+	IReactant * getBubble(int heSize, int vSize) const {
+		auto it = bubbleMap.find(std::make_pair(heSize, vSize));
+		return (it != bubbleMap.end()) ? it->second : nullptr;
+	}
+
+	/**
+	 * This method defines which trap-mutation is allowed at the grid points
+	 * xs to xs + xm - 1 of a column in the depth direction. The column must
+	 * already have one entry per grid point.
+	 *
+	 * @param column The bubbles at each grid point of the column
+	 * @param surfacePos The index of the position of the surface in this column
+	 * @param yPos The position of the column in the Y direction
+	 * @param advectionHandlers The vector of advection handlers
+	 * @param grid The grid on the x axis
+	 * @param xs The first grid point to define
+	 * @param xm The number of grid points to define
+	 */
+	void initializeColumn(ReactantRefVector1D& column, int surfacePos,
+			double yPos,
+			const std::vector<IAdvectionHandler *>& advectionHandlers,
+			const std::vector<double>& grid, int xs, int xm);
+
 public:
 
 	/**
@@ -92,6 +137,10 @@ public:
 	 */
 	TrapMutationHandler() :
 			kMutation(0.0), kDis(1.0), attenuation(true), desorp(0, 0.0) {
+		// The sigma 3 grain boundary is the only one available right now
+		Sigma3TrapMutationHandler sigma3Handler;
+		sigma3DistanceVec = sigma3Handler.getDistanceVector();
+		sigma3SizeVec = sigma3Handler.getSizeVector();
 	}
 
 	/**
@@ -146,6 +195,26 @@ public:
 			std::vector<IAdvectionHandler *> advectionHandlers,
 			std::vector<double> grid, int ny, double hy, int nz, double hz);
 
+	/**
+	 * This method redefines which trap-mutation is allowed in a single column
+	 * after its surface moved, only at the grid points of this process.
+	 *
+	 * \see ITrapMutationHandler.h
+	 */
+	void updateIndex2D(int yj, int surfacePos,
+			std::vector<IAdvectionHandler *> advectionHandlers,
+			std::vector<double> grid, double hy, int xs, int xm);
+
+	/**
+	 * This method redefines which trap-mutation is allowed in a single column
+	 * after its surface moved, only at the grid points of this process.
+	 *
+	 * \see ITrapMutationHandler.h
+	 */
+	void updateIndex3D(int yj, int zk, int surfacePos,
+			std::vector<IAdvectionHandler *> advectionHandlers,
+			std::vector<double> grid, double hy, int xs, int xm);
+
 	/**
 	 * This method update the rate for the modified trap-mutation if the rates
 	 * changed in the network, it should be called when temperature changes
@@ -422,6 +422,47 @@ public:
 	 */
 	virtual void setTemperature(double temp, int i) = 0;
 
+	/**
+	 * This operation sets the temperature at which the reactant currently
+	 * exists, with its diffusion coefficient at this temperature already
+	 * computed. It is used by ReactionNetwork::setTemperature() which
+	 * computes the diffusion coefficients of all the reactants at once.
+	 *
+	 * @param temp The new reactant temperature
+	 * @param diffCoef The diffusion coefficient at this temperature
+	 * @param i The location on the grid
+	 */
+	virtual void setTemperature(double temp, double diffCoef, int i) = 0;
+
+	/**
+	 * This operation is called by the network when some of its dissociations
+	 * were activated or deactivated, for the reactant to update the pairs it
+	 * loops on in the flux and partial derivative computations.
+	 */
+	virtual void updateActiveReactions() = 0;
+
+	/**
+	 * This operation returns the number of coefficients of the reactions
+	 * this reactant takes part in, that can be stored in the memory shared
+	 * by the processes of a node.
+	 *
+	 * @return The number of coefficients
+	 */
+	virtual std::size_t getNumCoefficients() const = 0;
+
+	/**
+	 * This operation makes the reactant use the coefficients of its
+	 * reactions stored in shared memory, in the same order on every
+	 * process, instead of its own copy. The coefficients that are not
+	 * exactly equal to its own are not used.
+	 *
+	 * @param shared Where the getNumCoefficients() coefficients are
+	 * @param copy Whether to copy the coefficients there first, by the
+	 * process that owns the shared memory
+	 * @return The number of coefficients now used from the shared memory
+	 */
+	virtual std::size_t useSharedCoefficients(double* shared, bool copy) = 0;
+
 	/**
 	 * This operation returns the temperature at which the reactant currently exists.
 	 *
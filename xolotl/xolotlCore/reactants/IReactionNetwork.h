@@ -5,6 +5,7 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <mpi.h>
 #include "NDArray.h"
 #include "IReactant.h"
 
@@ -147,6 +148,22 @@ public:
 	 */
 	virtual int getSuperSize() const = 0;
 
+	/**
+	 * This operation returns the number of production reactions in the
+	 * network.
+	 *
+	 * @return The number of production reactions
+	 */
+	virtual std::size_t getNumProductionReactions() const = 0;
+
+	/**
+	 * This operation returns the number of dissociation reactions in the
+	 * network.
+	 *
+	 * @return The number of dissociation reactions
+	 */
+	virtual std::size_t getNumDissociationReactions() const = 0;
+
 	/**
 	 * This operation returns the size or number of reactants and momentums in the network.
 	 *
@@ -246,6 +263,74 @@ public:
 	 */
 	virtual void computeRateConstants(int i) = 0;
 
+	/**
+	 * Mark the quantities cached for computing the rate constants (binding
+	 * energies, reaction radii, diffusion factors) as out of date, they are
+	 * computed again the next time the temperature is set. It must be called
+	 * when a reactant property they depend on changes.
+	 */
+	virtual void invalidateRateTable() = 0;
+
+	/**
+	 * Set the shift applied to the binding energies of all the dissociations
+	 * at a grid point, a positive shift makes the clusters more stable.
+	 * It is used the next time the rate constants are computed.
+	 *
+	 * @param shift The shift in eV
+	 * @param i The location on the grid in the depth direction
+	 */
+	virtual void setBindingEnergyShift(double shift, int i) = 0;
+
+	/**
+	 * Set the threshold under which the dissociations are pruned: a
+	 * dissociation whose rate is smaller than this fraction of the biggest
+	 * production rate at all the grid points is skipped in the flux and
+	 * partial derivative computations. It is activated again as soon as its
+	 * rate becomes larger, when the temperature rises. 0 disables the pruning.
+	 *
+	 * @param threshold The relative rate
+	 */
+	virtual void setPruningThreshold(double threshold) = 0;
+
+	/**
+	 * Get the fraction of the dissociations that are active at the grid
+	 * points where the rate constants were computed, 1 without pruning.
+	 *
+	 * @return The fraction
+	 */
+	virtual double getActiveDissociationFraction() const = 0;
+
+	/**
+	 * Store the coefficients of the reactions once per node, in an MPI-3
+	 * shared memory window owned by the first process of the node, instead
+	 * of once per process. The rest of the network (reactants, reactions,
+	 * rates) stays private. It must be called by all the processes of the
+	 * communicator, once the network is built and before any dissociation
+	 * is pruned.
+	 *
+	 * @param comm The communicator of the processes sharing the network
+	 * @return The number of coefficients this process now reads from the
+	 * memory of another process
+	 */
+	virtual std::size_t shareCoefficients(MPI_Comm comm) = 0;
+
+	/**
+	 * Get the number of coefficients this process reads from the memory of
+	 * another process since shareCoefficients() was called.
+	 *
+	 * @return The number of shared coefficients
+	 */
+	virtual std::size_t getNumSharedCoefficients() const = 0;
+
+	/**
+	 * Account for the memory of the network in the memory trackers of the
+	 * performance handler registry: "network:reactions" for the reactions
+	 * and their maps, "network:coefficients" for the coefficients of the
+	 * reactions this process stores. It replaces the previous values so
+	 * it can be called again after the network changed.
+	 */
+	virtual void trackMemory() = 0;
+
 	/**
 	 * Add grid points to the vector of rates or remove them if the value is negative.
 	 *
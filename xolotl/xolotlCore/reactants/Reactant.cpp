@@ -73,6 +73,8 @@ void Reactant::setTemperature(double temp, int i) {
 void Reactant::setDiffusionFactor(const double factor) {
 	// Set the diffusion factor
 	diffusionFactor = factor;
+	// The diffusion coefficients depend on it
+	network.invalidateRateTable();
 
 	return;
 }
@@ -80,6 +82,8 @@ void Reactant::setDiffusionFactor(const double factor) {
 void Reactant::setMigrationEnergy(const double energy) {
 	// Set the migration energy
 	migrationEnergy = energy;
+	// The diffusion coefficients depend on it
+	network.invalidateRateTable();
 
 	return;
 }
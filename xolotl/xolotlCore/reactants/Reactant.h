@@ -669,6 +669,45 @@ public:
 	 */
 	void setTemperature(double temp, int i) override;
 
+	/**
+	 * This operation sets the temperature at which the reactant currently
+	 * exists with its diffusion coefficient.
+	 * \see IReactant.h
+	 */
+	void setTemperature(double temp, double diffCoef, int i) override {
+		temperature[i] = temp;
+		diffusionCoefficient[i] = diffCoef;
+	}
+
+	/**
+	 * This operation updates the pairs of active reactions.
+	 * \see IReactant.h
+	 *
+	 * Nothing to do here, the subclasses looping on dissociations
+	 * implement it.
+	 */
+	virtual void updateActiveReactions() override {
+		return;
+	}
+
+	/**
+	 * This operation returns the number of coefficients of the reactions.
+	 * \see IReactant.h
+	 *
+	 * None here, the subclasses storing coefficients implement it.
+	 */
+	virtual std::size_t getNumCoefficients() const override {
+		return 0;
+	}
+
+	/**
+	 * This operation uses the coefficients stored in shared memory.
+	 * \see IReactant.h
+	 */
+	virtual std::size_t useSharedCoefficients(double*, bool) override {
+		return 0;
+	}
+
 	/**
 	 * This operation returns the temperature at which the reactant currently exists.
 	 *
@@ -705,6 +744,8 @@ public:
 	 */
 	void setFormationEnergy(double energy) override {
 		formationEnergy = energy;
+		// The binding energies depend on it
+		network.invalidateRateTable();
 	}
 
 	/**
@@ -1,6 +1,7 @@
 #ifndef XCORE_REACTION_H
 #define XCORE_REACTION_H
 
+#include <vector>
 #include "IReactant.h"
 
 namespace xolotlCore {
@@ -39,6 +40,14 @@ public:
 	 */
 	std::vector<double> kConstant;
 
+	/**
+	 * Is the reaction taken into account in the fluxes and partial
+	 * derivatives? Only dissociations are ever deactivated, when their rates
+	 * are negligible at all the grid points (see
+	 * ReactionNetwork::setPruningThreshold()).
+	 */
+	bool isActive = true;
+
 	/**
 	 * First cluster in reaction pair.
 	 * Reactant concentration guaranteed to be <= that of second cluster.
@@ -111,6 +120,31 @@ public:
 	}
 };
 
+/**
+ * Move the pairs whose reaction is active first, keeping their order.
+ * The pairs only need a reaction member.
+ *
+ * @param pairs The pairs
+ * @return The number of active pairs
+ */
+template<typename TPair>
+std::size_t moveActivePairsFirst(std::vector<TPair>& pairs) {
+	std::vector<TPair> activeFirst;
+	activeFirst.reserve(pairs.size());
+	for (auto const& currPair : pairs) {
+		if (currPair.reaction.isActive)
+			activeFirst.push_back(currPair);
+	}
+	std::size_t nActive = activeFirst.size();
+	for (auto const& currPair : pairs) {
+		if (!currPair.reaction.isActive)
+			activeFirst.push_back(currPair);
+	}
+	pairs.swap(activeFirst);
+
+	return nActive;
+}
+
 }
 
 #endif /* XCORE_REACTION_H */
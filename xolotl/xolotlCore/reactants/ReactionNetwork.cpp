@@ -2,6 +2,9 @@
 #include <xolotlPerf.h>
 #include <iostream>
 #include <cassert>
+#include <algorithm>
+#include <cmath>
+#include <MathUtils.h>
 
 namespace xolotlCore {
 
@@ -11,7 +14,8 @@ ReactionNetwork::ReactionNetwork(
 		std::shared_ptr<xolotlPerf::IHandlerRegistry> _registry) :
 		knownReactantTypes(_knownReactantTypes), superClusterType(
 				_superClusterType), handlerRegistry(_registry), temperature(
-				0.0), dissociationsEnabled(true) {
+				0.0), pruningThreshold(0.0), coefWindow(MPI_WIN_NULL), nSharedCoefs(0), dissociationsEnabled(
+				true) {
 
 	// Ensure our per-type cluster map can store Reactants of the types
 	// we support.
@@ -25,6 +29,14 @@ ReactionNetwork::ReactionNetwork(
 	for (auto const& currType : knownReactantTypes) {
 		maxClusterSizeMap.insert( { currType, 0 });
 	}
+
+	// Only the types we support have a dense index
+	for (auto const& currType : knownReactantTypes) {
+		int typeIdx = static_cast<int>(currType);
+		if (typeIdx >= (int) compositionIndices.size())
+			compositionIndices.resize(typeIdx + 1, CompositionIndex(false));
+		compositionIndices[typeIdx] = CompositionIndex();
+	}
 	return;
 }
 
@@ -51,10 +63,13 @@ void ReactionNetwork::add(std::unique_ptr<IReactant> reactant) {
 				maxClusterSizeMap[reactant->getType()]);
 
 		// Note the reactant in our flat list of all reactants.
-		allReactants.emplace_back(*reactant);
+		IReactant& newReactant = *reactant;
+		allReactants.emplace_back(newReactant);
+		invalidateRateTable();
 
 		// Give reactant to the appropriate per-type map.
 		currTypeMap.emplace(composition, std::move(reactant));
+		indexReactant(newReactant);
 
 	} else {
 		std::stringstream errStream;
@@ -79,6 +94,13 @@ void ReactionNetwork::add(std::unique_ptr<IReactant> reactant) {
 IReactant * ReactionNetwork::get(ReactantType type,
 		const IReactant::Composition& comp) const {
 
+	// Use the dense index if there is one
+	int typeIdx = static_cast<int>(type);
+	if (typeIdx >= 0 && typeIdx < (int) compositionIndices.size()
+			&& compositionIndices[typeIdx].isDense) {
+		return compositionIndices[typeIdx].find(comp);
+	}
+
 	IReactant* ret = nullptr;
 
 	// Check if the reactant is in the map
@@ -91,21 +113,80 @@ IReactant * ReactionNetwork::get(ReactantType type,
 	return ret;
 }
 
-double ReactionNetwork::calculateReactionRateConstant(
-		const ProductionReaction& reaction, int i) const {
-	// Get the reaction radii
-	double r_first = reaction.first.getReactionRadius();
-	double r_second = reaction.second.getReactionRadius();
+void ReactionNetwork::indexReactant(IReactant& reactant) {
+	int typeIdx = static_cast<int>(reactant.getType());
+	if (typeIdx < 0 || typeIdx >= (int) compositionIndices.size())
+		return;
+	auto& index = compositionIndices[typeIdx];
+	if (!index.isDense)
+		return;
+
+	// Check if the composition is in the box
+	auto const& comp = reactant.getComposition();
+	auto extents = index.extents;
+	bool inside = true;
+	for (uint32_t i = 0; i < NumSpecies; i++) {
+		if (comp[i] >= extents[i]) {
+			// Double the size to grow it rarely
+			extents[i] = std::max(comp[i] + 1, 2 * extents[i]);
+			inside = false;
+		}
+	}
+
+	if (inside) {
+		std::size_t pos = 0;
+		for (uint32_t i = 0; i < NumSpecies; i++) {
+			pos += comp[i] * index.strides[i];
+		}
+		index.slots[pos] = &reactant;
+		return;
+	}
+
+	// Grow the box
+	std::size_t nSlots = 1;
+	for (uint32_t i = 0; i < NumSpecies; i++) {
+		index.strides[i] = nSlots;
+		nSlots *= extents[i];
+		if (nSlots > maxIndexSlots) {
+			// Too large, use the type map for this type
+			index = CompositionIndex(false);
+			return;
+		}
+	}
+	index.extents = extents;
+	index.slots.assign(nSlots, nullptr);
+
+	// Put back all the clusters of this type, including the new one
+	for (auto const& currMapItem : clusterTypeMap.at(reactant.getType())) {
+		auto const& currComp = currMapItem.second->getComposition();
+		std::size_t pos = 0;
+		for (uint32_t i = 0; i < NumSpecies; i++) {
+			pos += currComp[i] * index.strides[i];
+		}
+		index.slots[pos] = currMapItem.second.get();
+	}
 
-	// Get the diffusion coefficients
-	double firstDiffusion = reaction.first.getDiffusionCoefficient(i);
-	double secondDiffusion = reaction.second.getDiffusionCoefficient(i);
+	return;
+}
 
-	// Calculate and return
-	double k_plus = 4.0 * xolotlCore::pi * (r_first + r_second)
-			* (firstDiffusion + secondDiffusion);
+void ReactionNetwork::unindexReactant(const IReactant& reactant) {
+	int typeIdx = static_cast<int>(reactant.getType());
+	if (typeIdx < 0 || typeIdx >= (int) compositionIndices.size())
+		return;
+	auto& index = compositionIndices[typeIdx];
+	if (!index.isDense)
+		return;
+
+	auto const& comp = reactant.getComposition();
+	if (index.find(comp) != &reactant)
+		return;
+	std::size_t pos = 0;
+	for (uint32_t i = 0; i < NumSpecies; i++) {
+		pos += comp[i] * index.strides[i];
+	}
+	index.slots[pos] = nullptr;
 
-	return k_plus;
+	return;
 }
 
 void ReactionNetwork::fillConcentrationsArray(double * concentrations) {
@@ -135,14 +216,32 @@ void ReactionNetwork::setTemperature(double temp, int i) {
 	// Set the temperature
 	temperature = temp;
 
-	// Update the temperature for all of the clusters
-	std::for_each(allReactants.begin(), allReactants.end(),
-			[&temp,&i](IReactant& currReactant) {
+	// Make sure the rate table is up to date
+	if (!rateTable.isValid)
+		compileRateTable();
 
-				// This part will set the temperature in each reactant
-				// and recompute the diffusion coefficient
-				currReactant.setTemperature(temp, i);
-			});
+	// Compute the diffusion coefficients with the Arrhenius equation
+	auto& exponents = rateTable.exponents;
+	const int nDiffusing = rateTable.diffusingIndices.size();
+	double factor = -1.0 / (xolotlCore::kBoltzmann * temp);
+	for (int k = 0; k < nDiffusing; k++) {
+		exponents[k] = rateTable.migrationEnergies[k] * factor;
+	}
+	for (int k = 0; k < nDiffusing; k++) {
+		exponents[k] = exp(exponents[k]);
+	}
+	auto& diffusionCoefficients = rateTable.diffusionCoefficients;
+	for (int k = 0; k < nDiffusing; k++) {
+		diffusionCoefficients[rateTable.diffusingIndices[k]] =
+				rateTable.diffusionFactors[k] * exponents[k];
+	}
+
+	// Update the temperature and the diffusion coefficient of all the clusters
+	const int nReactants = rateTable.reactants.size();
+	for (int k = 0; k < nReactants; k++) {
+		rateTable.reactants[k]->setTemperature(temp, diffusionCoefficients[k],
+				i);
+	}
 
 	return;
 }
@@ -155,6 +254,8 @@ ProductionReaction& ReactionNetwork::add(
 	// whether it was added by this emplace() call.
 	auto key = reaction->descriptiveKey();
 	auto eret = productionReactionMap.emplace(key, std::move(reaction));
+	if (eret.second)
+		invalidateRateTable();
 	// Regardless of whether we added it in this emplace() call or not,
 	// the iter within eret refers to the desired reaction in the map.
 	return *(eret.first->second);
@@ -177,6 +278,7 @@ DissociationReaction& ReactionNetwork::add(
 
 	// Add the dissociation reaction to our set of known reactions.
 	auto eret = dissociationReactionMap.emplace(key, std::move(reaction));
+	invalidateRateTable();
 
 	// Since we checked earlier and the reaction wasn't in the map,
 	// our emplace() call should have added it.
@@ -218,6 +320,7 @@ void ReactionNetwork::removeReactants(
 	}
 
 	allReactants.erase(result, allReactants.end());
+	invalidateRateTable();
 
 	// ...Next, examine each type's collection of clusters and remove the
 	// doomed reactants.
@@ -227,6 +330,7 @@ void ReactionNetwork::removeReactants(
 		for (IReactant const& currDoomedReactant : doomedReactants) {
 			auto iter = clusters.find(currDoomedReactant.getComposition());
 			assert(iter != clusters.end());
+			unindexReactant(currDoomedReactant);
 			clusters.erase(iter);
 		}
 	}
@@ -234,46 +338,342 @@ void ReactionNetwork::removeReactants(
 	return;
 }
 
-void ReactionNetwork::computeRateConstants(int i) {
-	// Local declarations
-	double rate = 0.0;
-	// Initialize the value for the biggest production rate
-	double biggestProductionRate = 0.0;
+void ReactionNetwork::compileRateTable() {
+	// Were some reactions pruned with the previous table?
+	bool wasPruned = rateTable.nActiveDissociations
+			< (int) rateTable.dissociations.size();
+	rateTable = RateTable();
+
+	// The reactants, and the ones that diffuse
+	std::unordered_map<const IReactant*, int> reactantIndices;
+	for (IReactant& currReactant : allReactants) {
+		int index = rateTable.reactants.size();
+		reactantIndices.emplace(&currReactant, index);
+		rateTable.reactants.push_back(&currReactant);
+
+		// Same test as Reactant::recomputeDiffusionCoefficient()
+		double diffusionFactor = currReactant.getDiffusionFactor();
+		if (!xolotlCore::equal(diffusionFactor, 0.0)) {
+			rateTable.diffusingIndices.push_back(index);
+			rateTable.diffusionFactors.push_back(diffusionFactor);
+			rateTable.migrationEnergies.push_back(
+					currReactant.getMigrationEnergy());
+		}
+	}
+	rateTable.diffusionCoefficients.assign(rateTable.reactants.size(), 0.0);
 
-	// Loop on all the production reactions
+	// The production reactions
+	std::unordered_map<const ProductionReaction*, int> productionIndices;
 	for (auto& currReactionInfo : productionReactionMap) {
+		auto& currReaction = *(currReactionInfo.second);
+		productionIndices.emplace(&currReaction,
+				rateTable.productions.size());
+		rateTable.productions.push_back(&currReaction);
+		rateTable.firstIndices.push_back(
+				reactantIndices.at(&currReaction.first));
+		rateTable.secondIndices.push_back(
+				reactantIndices.at(&currReaction.second));
+		rateTable.radiiFactors.push_back(
+				4.0 * xolotlCore::pi
+						* (currReaction.first.getReactionRadius()
+								+ currReaction.second.getReactionRadius()));
+	}
+	rateTable.productionRates.assign(rateTable.productions.size() + 1, 0.0);
 
-		auto& currReaction = currReactionInfo.second;
+	// The dissociation reactions, their binding energies only depend
+	// on the formation energies
+	for (auto& currReactionInfo : dissociationReactionMap) {
+		auto& currReaction = *(currReactionInfo.second);
+		// A reverse reaction unknown to the network never gets a rate,
+		// it points to the last production rate that is always zero
+		auto iter = productionIndices.find(currReaction.reverseReaction);
+		rateTable.dissociations.push_back(&currReaction);
+		rateTable.reverseIndices.push_back(
+				(iter != productionIndices.end()) ?
+						iter->second : rateTable.productions.size());
+		rateTable.bindingEnergies.push_back(
+				computeBindingEnergy(currReaction));
+	}
+	rateTable.dissociationRates.assign(rateTable.dissociations.size(), 0.0);
 
-		// Compute the rate
-		rate = calculateReactionRateConstant(*currReaction, i);
-		// Set it in the reaction
-		currReaction->kConstant[i] = rate;
+	rateTable.exponents.assign(
+			std::max(rateTable.diffusingIndices.size(),
+					rateTable.dissociations.size()), 0.0);
 
-		// Check if the rate is the biggest one up to now
-		if (rate > biggestProductionRate)
-			biggestProductionRate = rate;
+	// Everything is active again until the rates are computed
+	for (auto currReaction : rateTable.dissociations) {
+		currReaction->isActive = true;
+	}
+	rateTable.nActivePoints.assign(rateTable.dissociations.size(), 0);
+	rateTable.nActiveDissociations = rateTable.dissociations.size();
+	if (wasPruned) {
+		for (IReactant& currReactant : allReactants) {
+			currReactant.updateActiveReactions();
+		}
 	}
 
-	// Loop on all the dissociation reactions
-	for (auto& currReactionInfo : dissociationReactionMap) {
+	rateTable.isValid = true;
 
-		auto& currReaction = currReactionInfo.second;
+	return;
+}
 
-		// Compute the rate
-		rate = calculateDissociationConstant(*currReaction, i);
+void ReactionNetwork::computeRateConstants(int i) {
+	// Make sure the rate table is up to date
+	if (!rateTable.isValid)
+		compileRateTable();
+
+	// Nothing to compute without reactants
+	const int nReactants = rateTable.reactants.size();
+	if (nReactants == 0) {
+		biggestRate = 0.0;
+		return;
+	}
 
-		// Set it in the reaction
-		currReaction->kConstant[i] = rate;
+	// The temperature and the diffusion coefficients at this grid point
+	double temp = rateTable.reactants[0]->getTemperature(i);
+	auto& diffusionCoefficients = rateTable.diffusionCoefficients;
+	for (int k = 0; k < nReactants; k++) {
+		diffusionCoefficients[k] =
+				rateTable.reactants[k]->getDiffusionCoefficient(i);
 	}
 
+	// The production rates, k+ = 4 pi (r_1 + r_2) (D_1 + D_2)
+	auto& productionRates = rateTable.productionRates;
+	const int nProductions = rateTable.productions.size();
+	for (int k = 0; k < nProductions; k++) {
+		productionRates[k] = rateTable.radiiFactors[k]
+				* (diffusionCoefficients[rateTable.firstIndices[k]]
+						+ diffusionCoefficients[rateTable.secondIndices[k]]);
+	}
+	// Initialize the value for the biggest production rate
+	double biggestProductionRate = 0.0;
+	for (int k = 0; k < nProductions; k++) {
+		rateTable.productions[k]->kConstant[i] = productionRates[k];
+		// Check if the rate is the biggest one up to now
+		if (productionRates[k] > biggestProductionRate)
+			biggestProductionRate = productionRates[k];
+	}
+
+	// The dissociation rates, k- = k+ / Omega exp(-(E_b + shift) / k_B T)
+	auto& exponents = rateTable.exponents;
+	auto& dissociationRates = rateTable.dissociationRates;
+	const int nDissociations = rateTable.dissociations.size();
+	double shift =
+			(i < (int) bindingEnergyShifts.size()) ?
+					bindingEnergyShifts[i] : 0.0;
+	double factor = -1.0 / (xolotlCore::kBoltzmann * temp);
+	// The rates are null if the dissociations are not allowed
+	double prefactor = dissociationsEnabled ? 1.0 / getAtomicVolume() : 0.0;
+	for (int k = 0; k < nDissociations; k++) {
+		exponents[k] = (rateTable.bindingEnergies[k] + shift) * factor;
+	}
+	for (int k = 0; k < nDissociations; k++) {
+		exponents[k] = exp(exponents[k]);
+	}
+	for (int k = 0; k < nDissociations; k++) {
+		dissociationRates[k] = prefactor
+				* productionRates[rateTable.reverseIndices[k]] * exponents[k];
+	}
+	for (int k = 0; k < nDissociations; k++) {
+		rateTable.dissociations[k]->kConstant[i] = dissociationRates[k];
+	}
+
+	// Skip the negligible dissociations
+	if (pruningThreshold > 0.0)
+		pruneDissociations(i, biggestProductionRate);
+
 	// Set the biggest rate
 	biggestRate = biggestProductionRate;
 
 	return;
 }
 
+void ReactionNetwork::pruneDissociations(int i,
+		double biggestProductionRate) {
+	auto& isActiveAt = rateTable.isActiveAt;
+	auto& nActivePoints = rateTable.nActivePoints;
+	const int nDissociations = rateTable.dissociations.size();
+
+	// A grid point seen for the first time starts with all the
+	// dissociations active, the ones never seen don't count
+	if (i >= (int) isActiveAt.size())
+		isActiveAt.resize(i + 1);
+	if (isActiveAt[i].empty()) {
+		isActiveAt[i].assign(nDissociations, true);
+		for (int k = 0; k < nDissociations; k++) {
+			nActivePoints[k]++;
+		}
+	}
+
+	double smallestRate = pruningThreshold * biggestProductionRate;
+	auto& dissociationRates = rateTable.dissociationRates;
+	auto& isActiveHere = isActiveAt[i];
+	bool hasChanged = false;
+	for (int k = 0; k < nDissociations; k++) {
+		bool isActive = (dissociationRates[k] >= smallestRate);
+		if (isActive == isActiveHere[k])
+			continue;
+		isActiveHere[k] = isActive;
+		nActivePoints[k] += isActive ? 1 : -1;
+
+		// The reaction is pruned only if it is negligible everywhere
+		auto& currReaction = *(rateTable.dissociations[k]);
+		if (currReaction.isActive != (nActivePoints[k] > 0)) {
+			currReaction.isActive = !currReaction.isActive;
+			rateTable.nActiveDissociations += currReaction.isActive ? 1 : -1;
+			hasChanged = true;
+		}
+	}
+
+	// Let the reactants update their pairs
+	if (hasChanged) {
+		for (IReactant& currReactant : allReactants) {
+			currReactant.updateActiveReactions();
+		}
+	}
+
+	return;
+}
+
+void ReactionNetwork::setBindingEnergyShift(double shift, int i) {
+	if (i >= (int) bindingEnergyShifts.size())
+		bindingEnergyShifts.resize(i + 1, 0.0);
+	bindingEnergyShifts[i] = shift;
+
+	return;
+}
+
+ReactionNetwork::~ReactionNetwork() {
+	// The reactants do not free the coefficients in shared memory, the
+	// window does, if MPI is still there
+	if (coefWindow != MPI_WIN_NULL) {
+		int finalized = 0;
+		MPI_Finalized(&finalized);
+		if (!finalized)
+			MPI_Win_free(&coefWindow);
+	}
+}
+
+void ReactionNetwork::setPruningThreshold(double threshold) {
+	pruningThreshold = threshold;
+	// Start again from all the reactions active
+	invalidateRateTable();
+
+	return;
+}
+
+double ReactionNetwork::getActiveDissociationFraction() const {
+	if (!rateTable.isValid || rateTable.dissociations.empty())
+		return 1.0;
+
+	return (double) rateTable.nActiveDissociations
+			/ (double) rateTable.dissociations.size();
+}
+
+std::size_t ReactionNetwork::shareCoefficients(MPI_Comm comm) {
+	// Already done
+	if (coefWindow != MPI_WIN_NULL)
+		return 0;
+
+	// The processes of this node
+	MPI_Comm nodeComm;
+	MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL,
+			&nodeComm);
+	int nodeRank = 0, nodeSize = 0;
+	MPI_Comm_rank(nodeComm, &nodeRank);
+	MPI_Comm_size(nodeComm, &nodeSize);
+
+	// Where the coefficients of each reactant are, one after the other
+	std::vector<std::size_t> offsets;
+	offsets.reserve(allReactants.size());
+	unsigned long long nCoefs = 0;
+	for (IReactant const& currReactant : allReactants) {
+		offsets.push_back(nCoefs);
+		nCoefs += currReactant.getNumCoefficients();
+	}
+
+	// The first process of the node stores them
+	unsigned long long nodeCoefs = nCoefs;
+	MPI_Bcast(&nodeCoefs, 1, MPI_UNSIGNED_LONG_LONG, 0, nodeComm);
+	if (nodeSize == 1 || nodeCoefs == 0) {
+		MPI_Comm_free(&nodeComm);
+		return 0;
+	}
+	MPI_Aint windowSize = (nodeRank == 0) ? nCoefs * sizeof(double) : 0;
+	double* shared = nullptr;
+	MPI_Win_allocate_shared(windowSize, sizeof(double), MPI_INFO_NULL,
+			nodeComm, &shared, &coefWindow);
+	if (nodeRank != 0) {
+		MPI_Aint size = 0;
+		int dispUnit = 0;
+		MPI_Win_shared_query(coefWindow, 0, &size, &dispUnit, &shared);
+	}
+
+	// The first process copies its coefficients
+	MPI_Win_fence(0, coefWindow);
+	if (nodeRank == 0) {
+		int i = 0;
+		for (IReactant& currReactant : allReactants) {
+			currReactant.useSharedCoefficients(shared + offsets[i], true);
+			i++;
+		}
+	}
+	MPI_Win_fence(0, coefWindow);
+
+	// The other ones use them instead of theirs, each reactant only keeps
+	// the ones that differ from its own (a network built differently)
+	std::size_t nShared = 0;
+	if (nodeRank != 0 && nCoefs == nodeCoefs) {
+		int i = 0;
+		for (IReactant& currReactant : allReactants) {
+			nShared += currReactant.useSharedCoefficients(
+					shared + offsets[i], false);
+			i++;
+		}
+	}
+
+	// The window keeps its own copy of the group
+	MPI_Comm_free(&nodeComm);
+	this->nSharedCoefs = nShared;
+
+	return nShared;
+}
+
+void ReactionNetwork::trackMemory() {
+	// Replace the previous value of a tracker
+	auto setTracker = [this](const std::string& name, std::size_t nBytes) {
+		auto tracker = handlerRegistry->getMemoryTracker(name);
+		tracker->remove(tracker->getCurrentValue());
+		tracker->add(nBytes);
+	};
+
+	// The reactions, their keys and the nodes of the maps
+	std::size_t nodeBytes = 2 * sizeof(void*);
+	setTracker("network:reactions",
+			productionReactionMap.size()
+					* (sizeof(ProductionReaction)
+							+ sizeof(ProductionReactionMap::value_type)
+							+ nodeBytes)
+					+ dissociationReactionMap.size()
+							* (sizeof(DissociationReaction)
+									+ sizeof(DissociationReactionMap::value_type)
+									+ nodeBytes));
+
+	// The coefficients, without the ones that are shared
+	std::size_t nCoefs = 0;
+	for (IReactant const& currReactant : allReactants) {
+		nCoefs += currReactant.getNumCoefficients();
+	}
+	setTracker("network:coefficients",
+			(nCoefs - std::min(nCoefs, nSharedCoefs)) * sizeof(double));
+
+	return;
+}
+
 void ReactionNetwork::addGridPoints(int i) {
+	// The grid points are shifted, the pruning starts again
+	invalidateRateTable();
+
 	// Add grid points to the diffusing clusters first
 	for (IReactant& currReactant : allReactants) {
 		currReactant.addGridPoints(i);
@@ -164,6 +164,30 @@ protected:
 	 */
 	double biggestRate;
 
+	/**
+	 * The dissociations whose rate is smaller than this fraction of the
+	 * biggest production rate at a grid point are pruned, 0 to never prune.
+	 */
+	double pruningThreshold;
+
+	/**
+	 * The shared memory window holding the coefficients of the reactions,
+	 * MPI_WIN_NULL while they are not shared.
+	 */
+	MPI_Win coefWindow;
+
+	/**
+	 * The number of coefficients this process reads from the shared memory
+	 * window instead of storing them.
+	 */
+	std::size_t nSharedCoefs;
+
+	/**
+	 * The shift of the binding energies at each grid point, empty if no
+	 * shift was set.
+	 */
+	std::vector<double> bindingEnergyShifts;
+
 	/**
 	 * Are dissociations enabled?
 	 */
@@ -190,37 +214,159 @@ protected:
 	 */
 	std::unordered_map<ReactantType, ReactantMap> clusterTypeMap;
 
+	/**
+	 * The dense index of the clusters of one type. Each cluster is stored at
+	 * the position of its composition in a box covering all the compositions
+	 * of this type, so a lookup is a few arithmetic operations instead of
+	 * hashing the composition.
+	 */
+	struct CompositionIndex {
+		//! The size of the box in each species.
+		std::array<IReactant::SizeType, NumSpecies> extents;
+
+		//! The stride of each species in the slots.
+		std::array<std::size_t, NumSpecies> strides;
+
+		//! The clusters in the box, nullptr where there is none.
+		std::vector<IReactant *> slots;
+
+		//! False if the box is too large, the type map is then used.
+		bool isDense;
+
+		//! The constructor
+		CompositionIndex(bool dense = true) :
+				isDense(dense) {
+			extents.fill(0);
+			strides.fill(0);
+		}
+
+		/**
+		 * Get the cluster with the given composition.
+		 *
+		 * @param comp The composition
+		 * @return The cluster, nullptr if it is not in the box
+		 */
+		IReactant * find(const IReactant::Composition& comp) const {
+			std::size_t pos = 0;
+			for (uint32_t i = 0; i < NumSpecies; i++) {
+				if (comp[i] >= extents[i])
+					return nullptr;
+				pos += comp[i] * strides[i];
+			}
+			return slots[pos];
+		}
+	};
+
+	//! The largest number of slots of a dense index.
+	static constexpr std::size_t maxIndexSlots = 1 << 22;
+
+	/**
+	 * The dense index of each reactant type, at the position of the type
+	 * value. The types we don't know about are not dense.
+	 */
+	std::vector<CompositionIndex> compositionIndices;
+
+	/**
+	 * Add a reactant that is already in the type map to the dense index
+	 * of its type, growing the box if needed.
+	 *
+	 * @param reactant The reactant
+	 */
+	void indexReactant(IReactant& reactant);
+
+	/**
+	 * Remove a reactant from the dense index of its type.
+	 *
+	 * @param reactant The reactant
+	 */
+	void unindexReactant(const IReactant& reactant);
+
 	/**
 	 * Type of super cluster known by our network.
 	 */
 	ReactantType superClusterType;
 
 	/**
-	 * Calculate the reaction constant dependent on the
-	 * reaction radii and the diffusion coefficients for the
-	 * ith and jth clusters, which itself depends on the current
-	 * temperature.
+	 * The rate table: everything the rate constants need that does not depend
+	 * on the temperature, computed once from the reactants and reactions and
+	 * stored in contiguous arrays. The rates at a grid point are then
+	 * evaluated with simple loops over these arrays.
+	 */
+	struct RateTable {
+		//! Is it up to date with the reactants and reactions of the network?
+		bool isValid = false;
+
+		//! All the reactants, in the order of allReactants.
+		std::vector<IReactant*> reactants;
+		//! The index in reactants of the ones with a diffusion factor.
+		std::vector<int> diffusingIndices;
+		//! Their diffusion factors.
+		std::vector<double> diffusionFactors;
+		//! Their migration energies.
+		std::vector<double> migrationEnergies;
+		//! The diffusion coefficients of all the reactants at a grid point.
+		std::vector<double> diffusionCoefficients;
+
+		//! The production reactions.
+		std::vector<ProductionReaction*> productions;
+		//! The indices in reactants of their first and second reactants.
+		std::vector<int> firstIndices, secondIndices;
+		//! 4 pi times the sum of their reaction radii.
+		std::vector<double> radiiFactors;
+		//! Their rates at a grid point, followed by a zero.
+		std::vector<double> productionRates;
+
+		//! The dissociation reactions.
+		std::vector<DissociationReaction*> dissociations;
+		//! The index in productions of their reverse reaction.
+		std::vector<int> reverseIndices;
+		//! Their binding energies.
+		std::vector<double> bindingEnergies;
+		//! Their rates at a grid point.
+		std::vector<double> dissociationRates;
+
+		//! The scratch array for the arguments of exp().
+		std::vector<double> exponents;
+
+		//! Is each dissociation active, by grid point then dissociation,
+		//! only filled when pruning.
+		std::vector<std::vector<bool> > isActiveAt;
+		//! The number of grid points where each dissociation is active.
+		std::vector<int> nActivePoints;
+		//! The number of dissociations active at one grid point at least.
+		int nActiveDissociations = 0;
+	};
+
+	/**
+	 * The rate table of the network.
+	 */
+	RateTable rateTable;
+
+	/**
+	 * Build the rate table from the current reactants and reactions.
+	 */
+	void compileRateTable();
+
+	/**
+	 * Activate the dissociations whose rate is not negligible at a grid
+	 * point and deactivate the ones that are negligible at all the grid
+	 * points, from the rates that were just computed. The reactants are
+	 * told when some reactions changed.
 	 *
-	 * @param reaction The reaction
-	 * @param i The location on the grid
-	 * @return The rate
+	 * @param i The location on the grid in the depth direction
+	 * @param biggestProductionRate The biggest production rate at this point
 	 */
-	double calculateReactionRateConstant(const ProductionReaction& reaction,
-			int i) const;
+	void pruneDissociations(int i, double biggestProductionRate);
 
 	/**
-	 * Calculate the dissociation constant of the first cluster with respect to
-	 * the single-species cluster of the same type based on the current clusters
-	 * atomic volume, reaction rate constant, and binding energies.
+	 * Get the atomic volume of the material, the dissociation rates are
+	 * the rates of the reverse reactions divided by it.
 	 *
-	 * Need to be overwritten by daughter classes because of the atomic volume.
+	 * Need to be overwritten by daughter classes.
 	 *
-	 * @param reaction The reaction
-	 * @param i The location on the grid in the depth direction
-	 * @return The dissociation constant
+	 * @return The atomic volume in nm^3
 	 */
-	virtual double calculateDissociationConstant(
-			const DissociationReaction& reaction, int i) const = 0;
+	virtual double getAtomicVolume() const = 0;
 
 	/**
 	 * Calculate the binding energy for the dissociation cluster to emit the single
@@ -287,12 +433,12 @@ public:
 	/**
 	 * The destructor.
 	 */
-	virtual ~ReactionNetwork() {
-	}
+	virtual ~ReactionNetwork();
 
 	/**
 	 * This operation sets the temperature at which the reactants currently
-	 * exists. It calls setTemperature() on each reactant.
+	 * exists. The diffusion coefficients are computed from the rate table
+	 * and given to each reactant with setTemperature().
 	 *
 	 * This is the simplest way to set the temperature for all reactants.
 	 *
@@ -405,6 +551,26 @@ public:
 		return 0;
 	}
 
+	/**
+	 * This operation returns the number of production reactions in the
+	 * network.
+	 *
+	 * @return The number of production reactions
+	 */
+	std::size_t getNumProductionReactions() const override {
+		return productionReactionMap.size();
+	}
+
+	/**
+	 * This operation returns the number of dissociation reactions in the
+	 * network.
+	 *
+	 * @return The number of dissociation reactions
+	 */
+	std::size_t getNumDissociationReactions() const override {
+		return dissociationReactionMap.size();
+	}
+
 	/**
 	 * This operation returns the size or number of reactants and momentums in the network.
 	 *
@@ -524,15 +690,61 @@ public:
 	}
 
 	/**
-	 * Calculate all the rate constants for the reactions and dissociations of the network.
+	 * Calculate all the rate constants for the reactions and dissociations of the network
+	 * from the rate table, at the temperature of the grid point.
 	 * Need to be called only when the temperature changes.
 	 *
-	 * Need to be overwritten by daughter classes.
-	 *
 	 * @param i The location on the grid in the depth direction
 	 */
 	virtual void computeRateConstants(int i) override;
 
+	/**
+	 * Mark the rate table as out of date.
+	 * \see IReactionNetwork.h
+	 */
+	void invalidateRateTable() override {
+		rateTable.isValid = false;
+	}
+
+	/**
+	 * Set the shift applied to the binding energies of all the dissociations
+	 * at a grid point.
+	 * \see IReactionNetwork.h
+	 */
+	virtual void setBindingEnergyShift(double shift, int i) override;
+
+	/**
+	 * Set the relative rate under which the dissociations are pruned.
+	 * \see IReactionNetwork.h
+	 */
+	void setPruningThreshold(double threshold) override;
+
+	/**
+	 * Get the fraction of the dissociations that are active.
+	 * \see IReactionNetwork.h
+	 */
+	double getActiveDissociationFraction() const override;
+
+	/**
+	 * Store the coefficients of the reactions once per node.
+	 * \see IReactionNetwork.h
+	 */
+	std::size_t shareCoefficients(MPI_Comm comm) override;
+
+	/**
+	 * Get the number of shared coefficients.
+	 * \see IReactionNetwork.h
+	 */
+	std::size_t getNumSharedCoefficients() const override {
+		return nSharedCoefs;
+	}
+
+	/**
+	 * Account for the memory of the network.
+	 * \see IReactionNetwork.h
+	 */
+	void trackMemory() override;
+
 	/**
 	 * Add grid points to the vector of rates or remove them if the value is negative.
 	 *
@@ -747,6 +747,16 @@ void FeCluster::updateFromNetwork() {
 	combiningReactants.clear();
 	dissociatingPairs.clear();
 	emissionPairs.clear();
+	hasPrunedPairs = false;
+
+	return;
+}
+
+void FeCluster::updateActiveReactions() {
+	nActiveDissociating = moveActivePairsFirst(dissociatingPairs);
+	nActiveEmission = moveActivePairsFirst(emissionPairs);
+	hasPrunedPairs = (nActiveDissociating < dissociatingPairs.size())
+			|| (nActiveEmission < emissionPairs.size());
 
 	return;
 }
@@ -755,7 +765,7 @@ double FeCluster::getDissociationFlux(int xi) const {
 
 	// Sum dissociation flux over all our dissociating clusters.
 	double flux = std::accumulate(dissociatingPairs.begin(),
-			dissociatingPairs.end(), 0.0,
+			activeDissociatingEnd(), 0.0,
 			[&xi](double running, const ClusterPair& currPair) {
 				auto const& dissCluster = currPair.first;
 				double l0A = dissCluster.getConcentration(0.0, 0.0);
@@ -777,7 +787,7 @@ double FeCluster::getDissociationFlux(int xi) const {
 double FeCluster::getEmissionFlux(int xi) const {
 
 	// Sum rate constants from all emission pair reactions.
-	double flux = std::accumulate(emissionPairs.begin(), emissionPairs.end(),
+	double flux = std::accumulate(emissionPairs.begin(), activeEmissionEnd(),
 			0.0, [&xi](double running, const ClusterPair& currPair) {
 				return running + currPair.reaction.kConstant[xi] * currPair.a00;
 			});
@@ -946,7 +956,7 @@ void FeCluster::getDissociationPartialDerivatives(
 	// F(C_B) = k-_(B,D)*C_A
 	// Thus, the partial derivatives
 	// dF(C_B)/dC_A = k-_(B,D)
-	std::for_each(dissociatingPairs.begin(), dissociatingPairs.end(),
+	std::for_each(dissociatingPairs.begin(), activeDissociatingEnd(),
 			[&partials,&xi](const ClusterPair& currPair) {
 				// Get the dissociating cluster
 				auto const& cluster = currPair.first;
@@ -969,7 +979,7 @@ void FeCluster::getEmissionPartialDerivatives(std::vector<double> & partials,
 	// Thus, the partial derivatives
 	// dF(C_A)/dC_A = - k-_(B,D)
 	double outgoingFlux = std::accumulate(emissionPairs.begin(),
-			emissionPairs.end(), 0.0,
+			activeEmissionEnd(), 0.0,
 			[xi](double running, const ClusterPair& currPair) {
 				return running + currPair.reaction.kConstant[xi] * currPair.a00;
 			});
@@ -990,7 +1000,7 @@ double FeCluster::getLeftSideRate(int i) const {
 
 	// Sum rate constants over all emission pair reactions.
 	double emissionRateTotal = std::accumulate(emissionPairs.begin(),
-			emissionPairs.end(), 0.0,
+			activeEmissionEnd(), 0.0,
 			[&i](double running, const ClusterPair& currPair) {
 				return running + currPair.reaction.kConstant[i] * currPair.a00;
 			});
@@ -219,6 +219,38 @@ public:
 	 */
 	std::vector<ClusterPair> emissionPairs;
 
+	/**
+	 * The number of pairs at the beginning of dissociatingPairs and
+	 * emissionPairs whose reaction is active, updateActiveReactions() moves
+	 * them there when some dissociations are pruned.
+	 */
+	std::size_t nActiveDissociating = 0;
+	std::size_t nActiveEmission = 0;
+
+	//! Are some of the dissociating or emission pairs inactive?
+	bool hasPrunedPairs = false;
+
+	/**
+	 * Get the end of the dissociating pairs whose reaction is active.
+	 *
+	 * @return The iterator past the last active pair
+	 */
+	std::vector<ClusterPair>::const_iterator activeDissociatingEnd() const {
+		return hasPrunedPairs ?
+				dissociatingPairs.begin() + nActiveDissociating :
+				dissociatingPairs.end();
+	}
+
+	/**
+	 * Get the end of the emission pairs whose reaction is active.
+	 *
+	 * @return The iterator past the last active pair
+	 */
+	std::vector<ClusterPair>::const_iterator activeEmissionEnd() const {
+		return hasPrunedPairs ?
+				emissionPairs.begin() + nActiveEmission : emissionPairs.end();
+	}
+
 	/**
 	 * Default constructor, deleted because we require info to construct.
 	 */
@@ -600,6 +632,14 @@ public:
 	 */
 	void resetConnectivities() override;
 
+	/**
+	 * This operation moves the dissociating and emission pairs whose
+	 * reaction is active first, the flux and partial derivative computations
+	 * only loop on them.
+	 * \see IReactant.h
+	 */
+	void updateActiveReactions() override;
+
 	/**
 	 * This operation returns the sum of combination rate and emission rate
 	 * (where this cluster is on the left side of the reaction) for this
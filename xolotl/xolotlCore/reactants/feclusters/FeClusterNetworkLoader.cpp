@@ -106,10 +106,10 @@ FeClusterNetworkLoader::FeClusterNetworkLoader(
 
 std::unique_ptr<IReactionNetwork> FeClusterNetworkLoader::load(
 		const IOptions& options) {
-	// Get the dataset from the HDF5 files
+	// Get the dataset from the HDF5 files, only the first process reads it
 	int normalSize = 0, superSize = 0;
-	XFile networkFile(fileName);
-	auto networkGroup = networkFile.getGroup<XFile::NetworkGroup>();
+	auto networkFile = XFile::stage(fileName);
+	auto networkGroup = networkFile->getGroup<XFile::NetworkGroup>();
 	assert(networkGroup);
 	networkGroup->readNetworkSize(normalSize, superSize);
 
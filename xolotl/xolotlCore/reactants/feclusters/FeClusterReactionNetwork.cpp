@@ -21,32 +21,15 @@ FeClusterReactionNetwork::FeClusterReactionNetwork(
 	return;
 }
 
-double FeClusterReactionNetwork::calculateDissociationConstant(
-		const DissociationReaction& reaction, int i) const {
-
-	// If the dissociations are not allowed
-	if (!dissociationsEnabled)
-		return 0.0;
-
+double FeClusterReactionNetwork::getAtomicVolume() const {
 	// The atomic volume is computed by considering the BCC structure of the
 	// iron. In a given lattice cell in iron there are iron atoms
 	// at each corner and a iron atom in the center. The iron atoms at
 	// the corners are shared across a total of eight cells. The fraction of
 	// the volume of the lattice cell that is filled with iron atoms is the
 	// atomic volume and is a_0^3/(8*1/8 + 1) = 0.5*a_0^3.
-	double atomicVolume = 0.5 * xolotlCore::ironLatticeConstant
+	return 0.5 * xolotlCore::ironLatticeConstant
 			* xolotlCore::ironLatticeConstant * xolotlCore::ironLatticeConstant;
-
-	// Get the rate constant from the reverse reaction
-	double kPlus = reaction.reverseReaction->kConstant[i];
-
-	// Calculate and return
-	double bindingEnergy = computeBindingEnergy(reaction);
-	double k_minus_exp = exp(
-			-1.0 * bindingEnergy / (xolotlCore::kBoltzmann * temperature));
-	double k_minus = (1.0 / atomicVolume) * kPlus * k_minus_exp;
-
-	return k_minus;
 }
 
 void FeClusterReactionNetwork::defineProductionReactions(IReactant& r1,
@@ -1140,16 +1123,7 @@ void FeClusterReactionNetwork::reinitializeNetwork() {
 		IReactant * FeClusterReactionNetwork::getSuperFromComp(
 				IReactant::SizeType nHe, IReactant::SizeType nV) {
 
-			// Requests for finding a particular supercluster have high locality.
-			// See if the last supercluster we were asked to find is the right
-			// one for this request.
-			static IReactant* lastRet = nullptr;
-			if (lastRet
-					and static_cast<FeSuperCluster*>(lastRet)->isIn(nHe, nV)) {
-				return lastRet;
-			}
-
-			// We didn't find the last supercluster in our cache, so do a full lookup.
+			// The lookup table is direct, no need to cache the last result
 			IReactant* ret = nullptr;
 
 			auto heBaseIdx = findBoundsIntervalBaseIdx(nHe);
@@ -1163,7 +1137,6 @@ void FeClusterReactionNetwork::reinitializeNetwork() {
 						!= clusterTypeMap.at(ReactantType::FeSuper).end()) {
 					ret = superIter->second.get();
 					assert(static_cast<FeSuperCluster*>(ret)->isIn(nHe, nV));
-					lastRet = ret;
 				}
 			}
 
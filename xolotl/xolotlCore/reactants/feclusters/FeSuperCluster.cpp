@@ -1308,6 +1308,9 @@ double FeSuperCluster::getDissociationFlux(int xi) {
 	std::for_each(effDissociatingList.begin(), effDissociatingList.end(),
 			[this,&flux,&xi](DissociationPairMap::value_type const& currMapItem) {
 				auto const& currPair = currMapItem.second;
+				// Skip the pruned dissociations
+				if (!currPair.reaction.isActive)
+					return;
 
 				// Get the dissociating clusters
 				auto const& dissociatingCluster = currPair.first;
@@ -1339,6 +1342,9 @@ double FeSuperCluster::getEmissionFlux(int xi) {
 	std::for_each(effEmissionList.begin(), effEmissionList.end(),
 			[this,&flux,&xi](DissociationPairMap::value_type const& currMapItem) {
 				auto const& currPair = currMapItem.second;
+				// Skip the pruned dissociations
+				if (!currPair.reaction.isActive)
+					return;
 
 				// Update the flux
 				auto value = currPair.reaction.kConstant[xi] / (double) nTot;
@@ -1621,6 +1627,9 @@ void FeSuperCluster::getDissociationPartialDerivatives(
 	std::for_each(effDissociatingList.begin(), effDissociatingList.end(),
 			[this,&partials,&xi](DissociationPairMap::value_type const& currMapItem) {
 				auto& currPair = currMapItem.second;
+				// Skip the pruned dissociations
+				if (!currPair.reaction.isActive)
+					return;
 
 				// Get the dissociating clusters
 				auto const& cluster = currPair.first;
@@ -1657,6 +1666,9 @@ void FeSuperCluster::getEmissionPartialDerivatives(
 	std::for_each(effEmissionList.begin(), effEmissionList.end(),
 			[this,&partials,&xi](DissociationPairMap::value_type const& currMapItem) {
 				auto& currPair = currMapItem.second;
+				// Skip the pruned dissociations
+				if (!currPair.reaction.isActive)
+					return;
 
 				// Compute the contribution from the dissociating cluster
 				auto value = currPair.reaction.kConstant[xi] / (double) nTot;
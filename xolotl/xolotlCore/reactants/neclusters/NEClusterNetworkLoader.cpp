@@ -1,5 +1,6 @@
 #include <fstream>
 #include <functional>
+#include <algorithm>
 #include <cassert>
 #include "NEClusterNetworkLoader.h"
 #include <NEClusterReactionNetwork.h>
@@ -76,6 +77,7 @@ NEClusterNetworkLoader::NEClusterNetworkLoader(
 	dummyReactions = false;
 	xeMin = 1000000;
 	sectionWidth = 1;
+	widthRatio = 1.0;
 
 	return;
 }
@@ -89,16 +91,17 @@ NEClusterNetworkLoader::NEClusterNetworkLoader(
 	dummyReactions = false;
 	xeMin = 1000000;
 	sectionWidth = 1;
+	widthRatio = 1.0;
 
 	return;
 }
 
 std::unique_ptr<IReactionNetwork> NEClusterNetworkLoader::load(
 		const IOptions& options) {
-	// Get the dataset from the HDF5 files
+	// Get the dataset from the HDF5 files, only the first process reads it
 	int normalSize = 0, superSize = 0;
-	XFile networkFile(fileName);
-	auto networkGroup = networkFile.getGroup<XFile::NetworkGroup>();
+	auto networkFile = XFile::stage(fileName);
+	auto networkGroup = networkFile->getGroup<XFile::NetworkGroup>();
 	assert(networkGroup);
 	networkGroup->readNetworkSize(normalSize, superSize);
 
@@ -261,6 +264,8 @@ void NEClusterNetworkLoader::applyGrouping(IReactionNetwork& network) const {
 	// Initialize variables for the loop
 	int count = 0, superCount = 0, width = sectionWidth;
 	double size = 0.0, radius = 0.0, energy = 0.0;
+	// The width before truncation, so that it grows even when it is small
+	double exactWidth = (double) sectionWidth;
 
 	// Map to know which cluster is in which group
 	std::map<int, int> clusterGroupMap;
@@ -322,7 +327,10 @@ void NEClusterNetworkLoader::applyGrouping(IReactionNetwork& network) const {
 		count = 0;
 		tempVector.clear();
 		superCount++;
-//		width = max(sectionWidth * (int) (superCount / 10), sectionWidth);
+
+		// Widen the next group
+		exactWidth *= widthRatio;
+		width = std::max((int) exactWidth, sectionWidth);
 	}
 
 	// Tell each reactant to update the pairs vector with super clusters
@@ -348,7 +356,7 @@ void NEClusterNetworkLoader::applyGrouping(IReactionNetwork& network) const {
 					// It has to be replaced by a super cluster
 					auto newCluster = superGroupMap[clusterGroupMap[nXe]];
 					react[l].first = newCluster;
-					react[l].firstDistance = newCluster->getDistance(size);
+					react[l].firstDistance = newCluster->getDistance(nXe);
 				}
 			}
 
@@ -43,11 +43,17 @@ protected:
 	 */
 	int sectionWidth;
 
+	/**
+	 * The ratio between the widths of two consecutive groups, 1 keeps all
+	 * the groups at sectionWidth.
+	 */
+	double widthRatio;
+
 	/**
 	 * Private nullary constructor.
 	 */
 	NEClusterNetworkLoader() :
-			xeMin(-1), sectionWidth(-1) {
+			xeMin(-1), sectionWidth(-1), widthRatio(1.0) {
 	}
 
 	/**
@@ -159,6 +165,17 @@ public:
 	void setWidth(int w) {
 		sectionWidth = w;
 	}
+
+	/**
+	 * This operation will set the ratio between the widths of two
+	 * consecutive groups. With a ratio r > 1 the widths grow geometrically
+	 * and the number of groups grows like the logarithm of the maximum size.
+	 *
+	 * @param r The value of the ratio
+	 */
+	void setWidthRatio(double r) {
+		widthRatio = r;
+	}
 };
 
 } /* namespace xolotlCore */
@@ -21,28 +21,11 @@ NEClusterReactionNetwork::NEClusterReactionNetwork(
 	return;
 }
 
-double NEClusterReactionNetwork::calculateDissociationConstant(
-		const DissociationReaction& reaction, int i) const {
-
-	// If the dissociations are not allowed
-	if (!dissociationsEnabled)
-		return 0.0;
-
+double NEClusterReactionNetwork::getAtomicVolume() const {
 	// Compute the atomic volume
-	double atomicVolume = 0.5 * xolotlCore::uraniumDioxydeLatticeConstant
+	return 0.5 * xolotlCore::uraniumDioxydeLatticeConstant
 			* xolotlCore::uraniumDioxydeLatticeConstant
 			* xolotlCore::uraniumDioxydeLatticeConstant;
-
-	// Get the rate constant from the reverse reaction
-	double kPlus = reaction.reverseReaction->kConstant[i];
-
-	// Calculate and return
-	double bindingEnergy = computeBindingEnergy(reaction);
-	double k_minus_exp = exp(
-			-1.0 * bindingEnergy / (xolotlCore::kBoltzmann * temperature));
-	double k_minus = (1.0 / atomicVolume) * kPlus * k_minus_exp;
-
-	return k_minus;
 }
 
 void NEClusterReactionNetwork::createReactionConnectivity() {
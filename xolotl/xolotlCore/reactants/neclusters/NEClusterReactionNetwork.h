@@ -32,16 +32,10 @@ class NEClusterReactionNetwork: public ReactionNetwork {
 private:
 
 	/**
-	 * Calculate the dissociation constant of the first cluster with respect to
-	 * the single-species cluster of the same type based on the current clusters
-	 * atomic volume, reaction rate constant, and binding energies.
-	 *
-	 * @param reaction The reaction
-	 * @param i The location on the grid in the depth direction
-	 * @return The dissociation constant
+	 * Get the atomic volume of the uranium dioxide.
+	 * \see ReactionNetwork.h
 	 */
-	double calculateDissociationConstant(const DissociationReaction& reaction,
-			int i) const override;
+	double getAtomicVolume() const override;
 
 	/**
 	 * Calculate the binding energy for the dissociation cluster to emit the single
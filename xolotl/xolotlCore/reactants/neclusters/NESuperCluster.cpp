@@ -19,8 +19,9 @@ NESuperCluster::NESuperCluster(double num, int nTot, int width, double radius,
 	// Set the cluster size
 	size = (int) numXe;
 
-	// Update the composition map
-	composition[toCompIdx(Species::Xe)] = (int) (numXe * (double) nTot);
+	// Update the composition map with the mean size, it is unique to each
+	// group and doesn't overflow for the wide groups of large clusters
+	composition[toCompIdx(Species::Xe)] = size;
 
 	// Set the width
 	sectionWidth = width;
@@ -247,12 +248,10 @@ void NESuperCluster::computeDispersion() {
 	if (sectionWidth == 1)
 		dispersion = 1.0;
 	else {
-		dispersion = 2.0
-				* (nXeSquare
-						- ((double) composition[toCompIdx(Species::Xe)]
-								* ((double) composition[toCompIdx(Species::Xe)]
-										/ (double) sectionWidth)))
-				/ ((double) (sectionWidth * (sectionWidth - 1)));
+		// The total number of xenon atoms in the group
+		double nXe = numXe * (double) nTot;
+		dispersion = 2.0 * (nXeSquare - (nXe * (nXe / (double) sectionWidth)))
+				/ ((double) sectionWidth * ((double) sectionWidth - 1.0));
 	}
 
 	return;
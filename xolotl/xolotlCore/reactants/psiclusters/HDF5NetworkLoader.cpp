@@ -11,10 +11,10 @@ namespace xolotlCore {
 
 std::unique_ptr<IReactionNetwork> HDF5NetworkLoader::load(
 		const IOptions& options) {
-	// Get the dataset from the HDF5 files
+	// Get the dataset from the HDF5 files, only the first process reads it
 	int normalSize = 0, superSize = 0;
-	XFile networkFile(fileName);
-	auto networkGroup = networkFile.getGroup<XFile::NetworkGroup>();
+	auto networkFile = XFile::stage(fileName);
+	auto networkGroup = networkFile->getGroup<XFile::NetworkGroup>();
 	assert(networkGroup);
 	auto list = networkGroup->readNetworkSize(normalSize, superSize);
 
@@ -759,15 +759,72 @@ void PSICluster::updateFromNetwork() {
 	combiningReactants.clear();
 	dissociatingPairs.clear();
 	emissionPairs.clear();
+	hasPrunedPairs = false;
 
 	return;
 }
 
+void PSICluster::updateActiveReactions() {
+	nActiveDissociating = moveActivePairsFirst(dissociatingPairs);
+	nActiveEmission = moveActivePairsFirst(emissionPairs);
+	hasPrunedPairs = (nActiveDissociating < dissociatingPairs.size())
+			|| (nActiveEmission < emissionPairs.size());
+
+	return;
+}
+
+/**
+ * Make pairs use their coefficients stored in shared memory.
+ *
+ * @param pairs The pairs
+ * @param shared Where the coefficients of the first pair are, the next
+ * ones follow
+ * @param copy Whether to copy the coefficients there first
+ * @param nShared Incremented by the number of coefficients now used from
+ * the shared memory
+ * @return Where the coefficients after the ones of the pairs are
+ */
+template<typename TPair>
+static double* useSharedPairCoefs(std::vector<TPair>& pairs, double* shared,
+		bool copy, std::size_t& nShared) {
+	for (auto& currPair : pairs) {
+		if (currPair.useSharedCoefs(shared, copy))
+			nShared += currPair.getNumCoefs();
+		shared += currPair.getNumCoefs();
+	}
+
+	return shared;
+}
+
+std::size_t PSICluster::getNumCoefficients() const {
+	std::size_t nCoefs = 0;
+	for (auto const& currPair : reactingPairs)
+		nCoefs += currPair.getNumCoefs();
+	for (auto const& currComb : combiningReactants)
+		nCoefs += currComb.getNumCoefs();
+	for (auto const& currPair : dissociatingPairs)
+		nCoefs += currPair.getNumCoefs();
+	for (auto const& currPair : emissionPairs)
+		nCoefs += currPair.getNumCoefs();
+
+	return nCoefs;
+}
+
+std::size_t PSICluster::useSharedCoefficients(double* shared, bool copy) {
+	std::size_t nShared = 0;
+	shared = useSharedPairCoefs(reactingPairs, shared, copy, nShared);
+	shared = useSharedPairCoefs(combiningReactants, shared, copy, nShared);
+	shared = useSharedPairCoefs(dissociatingPairs, shared, copy, nShared);
+	useSharedPairCoefs(emissionPairs, shared, copy, nShared);
+
+	return nShared;
+}
+
 double PSICluster::getDissociationFlux(int xi) const {
 
 	// Sum dissociation flux over all our dissociating clusters.
 	double flux = std::accumulate(dissociatingPairs.begin(),
-			dissociatingPairs.end(), 0.0,
+			activeDissociatingEnd(), 0.0,
 			[this,&xi](double running, const ClusterPair& currPair) {
 				auto const& dissCluster = currPair.first;
 				double lA[5] = {};
@@ -794,7 +851,7 @@ double PSICluster::getEmissionFlux(int xi) const {
 
 	// Sum rate constants from all emission pair reactions.
 	double flux =
-			std::accumulate(emissionPairs.begin(), emissionPairs.end(), 0.0,
+			std::accumulate(emissionPairs.begin(), activeEmissionEnd(), 0.0,
 					[&xi](double running, const ClusterPair& currPair) {
 						return running + (currPair.reaction.kConstant[xi] * currPair.coefs[0][0]);
 					});
@@ -980,7 +1037,7 @@ void PSICluster::getDissociationPartialDerivatives(
 	// F(C_B) = k-_(B,D)*C_A
 	// Thus, the partial derivatives
 	// dF(C_B)/dC_A = k-_(B,D)
-	std::for_each(dissociatingPairs.begin(), dissociatingPairs.end(),
+	std::for_each(dissociatingPairs.begin(), activeDissociatingEnd(),
 			[&partials,this,&xi](const ClusterPair& currPair) {
 				// Get the dissociating cluster
 				auto const& cluster = currPair.first;
@@ -1004,7 +1061,7 @@ void PSICluster::getEmissionPartialDerivatives(std::vector<double> & partials,
 	// Thus, the partial derivatives
 	// dF(C_A)/dC_A = - k-_(B,D)
 	double outgoingFlux =
-			std::accumulate(emissionPairs.begin(), emissionPairs.end(), 0.0,
+			std::accumulate(emissionPairs.begin(), activeEmissionEnd(), 0.0,
 					[&xi](double running, const ClusterPair& currPair) {
 						return running + (currPair.reaction.kConstant[xi] * currPair.coefs[0][0]);
 					});
@@ -1026,7 +1083,7 @@ double PSICluster::getLeftSideRate(int i) const {
 
 	// Sum rate constants over all emission pair reactions.
 	double emissionRateTotal =
-			std::accumulate(emissionPairs.begin(), emissionPairs.end(), 0.0,
+			std::accumulate(emissionPairs.begin(), activeEmissionEnd(), 0.0,
 					[&i](double running, const ClusterPair& currPair) {
 						return running + (currPair.reaction.kConstant[i] * currPair.coefs[0][0]);
 					});
@@ -2,6 +2,7 @@
 #define PSICLUSTER_H
 
 // Includes
+#include <algorithm>
 #include <Reactant.h>
 #include "IntegerRange.h"
 
@@ -75,17 +76,19 @@ protected:
 		//! The dimension, needed to be able to use the copy constructor
 		int dim = 0;
 
+		//! Whether the coefficients are in the shared memory of the network
+		bool sharedCoefs = false;
+
 		//! The constructor
 		ClusterPair(Reaction& _reaction, PSICluster& _first,
 				PSICluster& _second, const int _dim) :
 				first(_first), second(_second), reaction(_reaction), dim(_dim) {
-			// Create the array of the right dimension
+			// Create the array of the right dimension, the coefficients
+			// are contiguous
 			coefs = new double*[dim];
-			for (int i = 0; i < dim; i++) {
-				coefs[i] = new double[dim];
-				for (int j = 0; j < dim; j++) {
-					coefs[i][j] = 0.0;
-				}
+			coefs[0] = new double[dim * dim]();
+			for (int i = 1; i < dim; i++) {
+				coefs[i] = coefs[0] + i * dim;
 			}
 		}
 
@@ -98,21 +101,63 @@ protected:
 		// copy ctor is needed.
 		ClusterPair(const ClusterPair& other) :
 				dim(other.dim), first(other.first), second(other.second), reaction(
-						other.reaction) {
-			// Create the array of the right dimension
+						other.reaction), sharedCoefs(other.sharedCoefs) {
+			// Create the array of the right dimension, the shared
+			// coefficients are not copied
 			coefs = new double*[dim];
-			for (int i = 0; i < dim; i++) {
-				coefs[i] = new double[dim];
-				for (int j = 0; j < dim; j++) {
-					coefs[i][j] = other.coefs[i][j];
-				}
+			if (sharedCoefs) {
+				coefs[0] = other.coefs[0];
+			} else {
+				coefs[0] = new double[dim * dim];
+				std::copy(other.coefs[0], other.coefs[0] + dim * dim,
+						coefs[0]);
+			}
+			for (int i = 1; i < dim; i++) {
+				coefs[i] = coefs[0] + i * dim;
 			}
 		}
 
 		//! The destructor
 		~ClusterPair() {
+			if (!sharedCoefs)
+				delete[] coefs[0];
 			delete[] coefs;
 		}
+
+		//! The number of coefficients
+		std::size_t getNumCoefs() const {
+			return dim * dim;
+		}
+
+		//! The contiguous coefficients
+		const double* getCoefs() const {
+			return coefs[0];
+		}
+
+		/**
+		 * Use the coefficients stored in the shared memory of the network,
+		 * only if they are exactly ours.
+		 *
+		 * @param target Where they are
+		 * @param copy Whether to copy ours there first
+		 * @return True if they are used
+		 */
+		bool useSharedCoefs(double* target, bool copy) {
+			const double* values = getCoefs();
+			if (copy)
+				std::copy(values, values + getNumCoefs(), target);
+			else if (!std::equal(values, values + getNumCoefs(), target))
+				return false;
+
+			if (!sharedCoefs)
+				delete[] coefs[0];
+			for (int i = 0; i < dim; i++) {
+				coefs[i] = target + i * dim;
+			}
+			sharedCoefs = true;
+
+			return true;
+		}
 	};
 
 	/**
@@ -151,6 +196,9 @@ protected:
 		//! The dimension, needed to be able to use the copy constructor
 		int dim = 0;
 
+		//! Whether the coefficients are in the shared memory of the network
+		bool sharedCoefs = false;
+
 		//! The constructor
 		CombiningCluster(Reaction& _reaction, PSICluster& _comb, const int _dim) :
 				combining(_comb), reaction(_reaction), dim(_dim) {
@@ -170,7 +218,12 @@ protected:
 		// copy ctor is needed.
 		CombiningCluster(const CombiningCluster& other) :
 				dim(other.dim), combining(other.combining), reaction(
-						other.reaction) {
+						other.reaction), sharedCoefs(other.sharedCoefs) {
+			// The shared coefficients are not copied
+			if (sharedCoefs) {
+				coefs = other.coefs;
+				return;
+			}
 			// Create the array of the right dimension
 			coefs = new double[dim];
 			for (int j = 0; j < dim; j++) {
@@ -180,7 +233,41 @@ protected:
 
 		//! The destructor
 		~CombiningCluster() {
-			delete[] coefs;
+			if (!sharedCoefs)
+				delete[] coefs;
+		}
+
+		//! The number of coefficients
+		std::size_t getNumCoefs() const {
+			return dim;
+		}
+
+		//! The contiguous coefficients
+		const double* getCoefs() const {
+			return coefs;
+		}
+
+		/**
+		 * Use the coefficients stored in the shared memory of the network,
+		 * only if they are exactly ours.
+		 *
+		 * @param target Where they are
+		 * @param copy Whether to copy ours there first
+		 * @return True if they are used
+		 */
+		bool useSharedCoefs(double* target, bool copy) {
+			const double* values = getCoefs();
+			if (copy)
+				std::copy(values, values + getNumCoefs(), target);
+			else if (!std::equal(values, values + getNumCoefs(), target))
+				return false;
+
+			if (!sharedCoefs)
+				delete[] coefs;
+			coefs = target;
+			sharedCoefs = true;
+
+			return true;
 		}
 	};
 
@@ -262,6 +349,38 @@ public:
 	 */
 	std::vector<ClusterPair> emissionPairs;
 
+	/**
+	 * The number of pairs at the beginning of dissociatingPairs and
+	 * emissionPairs whose reaction is active, updateActiveReactions() moves
+	 * them there when some dissociations are pruned.
+	 */
+	std::size_t nActiveDissociating = 0;
+	std::size_t nActiveEmission = 0;
+
+	//! Are some of the dissociating or emission pairs inactive?
+	bool hasPrunedPairs = false;
+
+	/**
+	 * Get the end of the dissociating pairs whose reaction is active.
+	 *
+	 * @return The iterator past the last active pair
+	 */
+	std::vector<ClusterPair>::const_iterator activeDissociatingEnd() const {
+		return hasPrunedPairs ?
+				dissociatingPairs.begin() + nActiveDissociating :
+				dissociatingPairs.end();
+	}
+
+	/**
+	 * Get the end of the emission pairs whose reaction is active.
+	 *
+	 * @return The iterator past the last active pair
+	 */
+	std::vector<ClusterPair>::const_iterator activeEmissionEnd() const {
+		return hasPrunedPairs ?
+				emissionPairs.begin() + nActiveEmission : emissionPairs.end();
+	}
+
 	/**
 	 * Default constructor, deleted because we require info to construct.
 	 */
@@ -642,6 +761,28 @@ public:
 	 */
 	void resetConnectivities() override;
 
+	/**
+	 * This operation moves the dissociating and emission pairs whose
+	 * reaction is active first, the flux and partial derivative computations
+	 * only loop on them.
+	 * \see IReactant.h
+	 */
+	void updateActiveReactions() override;
+
+	/**
+	 * This operation returns the number of coefficients of the reacting,
+	 * combining, dissociating, and emission pairs.
+	 * \see IReactant.h
+	 */
+	std::size_t getNumCoefficients() const override;
+
+	/**
+	 * This operation makes the pairs use their coefficients stored in
+	 * shared memory, in the order of the vectors.
+	 * \see IReactant.h
+	 */
+	std::size_t useSharedCoefficients(double* shared, bool copy) override;
+
 	/**
 	 * This operation returns the sum of combination rate and emission rate
 	 * (where this cluster is on the left side of the reaction) for this
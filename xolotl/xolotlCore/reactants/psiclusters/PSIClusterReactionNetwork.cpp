@@ -1,5 +1,6 @@
 #include <cassert>
 #include <iterator>
+#include <set>
 #include "PSIClusterReactionNetwork.h"
 #include "PSICluster.h"
 #include "PSISuperCluster.h"
@@ -28,37 +29,16 @@ PSIClusterReactionNetwork::PSIClusterReactionNetwork(
 	return;
 }
 
-double PSIClusterReactionNetwork::calculateDissociationConstant(
-		const DissociationReaction& reaction, int i) const {
-
-	// If the dissociations are not allowed
-	if (!dissociationsEnabled)
-		return 0.0;
-
+double PSIClusterReactionNetwork::getAtomicVolume() const {
 	// The atomic volume is computed by considering the BCC structure of the
 	// tungsten. In a given lattice cell in tungsten there are tungsten atoms
 	// at each corner and a tungsten atom in the center. The tungsten atoms at
 	// the corners are shared across a total of eight cells. The fraction of
 	// the volume of the lattice cell that is filled with tungsten atoms is the
 	// atomic volume and is a_0^3/(8*1/8 + 1) = 0.5*a_0^3.
-	double atomicVolume = 0.5 * xolotlCore::tungstenLatticeConstant
+	return 0.5 * xolotlCore::tungstenLatticeConstant
 			* xolotlCore::tungstenLatticeConstant
 			* xolotlCore::tungstenLatticeConstant;
-
-	// Get the rate constant from the reverse reaction
-	double kPlus = reaction.reverseReaction->kConstant[i];
-
-	// Calculate and return
-	double bindingEnergy = computeBindingEnergy(reaction);
-	double k_minus_exp = exp(
-			-1.0 * bindingEnergy
-					/ (xolotlCore::kBoltzmann
-							* temperature)); // We can use the network temperature
-											// because this method is called only
-											// when the temperature is updated
-	double k_minus = (1.0 / atomicVolume) * kPlus * k_minus_exp;
-
-	return k_minus;
 }
 
 void PSIClusterReactionNetwork::defineProductionReactions(IReactant& r1,
@@ -2710,33 +2690,126 @@ double PSIClusterReactionNetwork::computeBindingEnergy(
 	return max(bindingEnergy, -5.0);
 }
 
+void PSIClusterReactionNetwork::buildSuperClusterIndex() {
+	auto const& superClusters = getAll(ReactantType::PSISuper);
+	superClusterIndex = SuperClusterIndex();
+	superClusterIndex.nSupers = superClusters.size();
+
+	// The bounds of the super clusters along each axis
+	std::array<std::set<IReactant::SizeType>, 4> axisBounds;
+	for (auto const& superMapItem : superClusters) {
+		auto const& cluster =
+				static_cast<PSISuperCluster&>(*(superMapItem.second));
+		for (int axis = 0; axis < 4; axis++) {
+			auto const& bounds = cluster.getBounds(axis);
+			axisBounds[axis].insert(*(bounds.begin()));
+			axisBounds[axis].insert(*(bounds.end()));
+		}
+	}
+	if (superClusters.empty())
+		return;
+
+	// The interval of each value along each axis
+	std::size_t nCells = 1;
+	for (int axis = 0; axis < 4; axis++) {
+		std::vector<IReactant::SizeType> bounds(axisBounds[axis].begin(),
+				axisBounds[axis].end());
+		auto& intervals = superClusterIndex.intervals[axis];
+		intervals.assign(bounds.back(), -1);
+		for (int n = 0; n + 1 < (int) bounds.size(); n++) {
+			for (auto value = bounds[n]; value < bounds[n + 1]; value++) {
+				intervals[value] = n;
+			}
+		}
+		superClusterIndex.strides[axis] = nCells;
+		nCells *= bounds.size() - 1;
+		// Too many cells, the super clusters will be scanned
+		if (nCells > maxSuperIndexCells)
+			return;
+	}
+
+	// Give each cell to its super cluster
+	superClusterIndex.cells.assign(nCells, nullptr);
+	for (auto const& superMapItem : superClusters) {
+		auto const& cluster =
+				static_cast<PSISuperCluster&>(*(superMapItem.second));
+		std::array<int, 4> first, last;
+		bool isEmpty = false;
+		for (int axis = 0; axis < 4; axis++) {
+			auto const& bounds = cluster.getBounds(axis);
+			auto const& intervals = superClusterIndex.intervals[axis];
+			if (*(bounds.begin()) == *(bounds.end())) {
+				isEmpty = true;
+				break;
+			}
+			first[axis] = intervals[*(bounds.begin())];
+			last[axis] = intervals[*(bounds.end()) - 1];
+		}
+		if (isEmpty)
+			continue;
+
+		for (int l = first[3]; l <= last[3]; l++)
+			for (int k = first[2]; k <= last[2]; k++)
+				for (int j = first[1]; j <= last[1]; j++)
+					for (int i = first[0]; i <= last[0]; i++) {
+						auto& cell = superClusterIndex.cells[i
+								* superClusterIndex.strides[0]
+								+ j * superClusterIndex.strides[1]
+								+ k * superClusterIndex.strides[2]
+								+ l * superClusterIndex.strides[3]];
+						// Overlapping groups, the super clusters will
+						// be scanned
+						if (cell) {
+							superClusterIndex.cells.clear();
+							return;
+						}
+						cell = superMapItem.second.get();
+					}
+	}
+
+	superClusterIndex.isValid = true;
+
+	return;
+}
+
 IReactant * PSIClusterReactionNetwork::getSuperFromComp(IReactant::SizeType nHe,
 		IReactant::SizeType nD, IReactant::SizeType nT,
 		IReactant::SizeType nV) {
 
-	// Requests for finding a particular supercluster have high locality.
-	// See if the last supercluster we were asked to find is the right
-	// one for this request.
-	static IReactant* lastRet;
-	if (lastRet
-			and static_cast<PSISuperCluster*>(lastRet)->isIn(nHe, nD, nT, nV)) {
-		return lastRet;
-	}
+	// Build the index if the super clusters changed
+	auto const& superClusters = getAll(ReactantType::PSISuper);
+	if (superClusterIndex.nSupers != superClusters.size())
+		buildSuperClusterIndex();
+
+	if (superClusterIndex.isValid) {
+		std::array<IReactant::SizeType, 4> coords = { nHe, nD, nT, nV };
+		std::size_t pos = 0;
+		for (int axis = 0; axis < 4; axis++) {
+			auto const& intervals = superClusterIndex.intervals[axis];
+			if (coords[axis] >= intervals.size()
+					or intervals[coords[axis]] < 0)
+				return nullptr;
+			pos += intervals[coords[axis]] * superClusterIndex.strides[axis];
+		}
 
-	// We didn't find the last supercluster in our cache, so do a full lookup.
-	IReactant* ret = nullptr;
+		// The groups at the border of the phase space may not be full
+		auto ret = superClusterIndex.cells[pos];
+		if (ret and static_cast<PSISuperCluster*>(ret)->isIn(nHe, nD, nT, nV))
+			return ret;
+		return nullptr;
+	}
 
-	for (auto const& superMapItem : getAll(ReactantType::PSISuper)) {
+	// Without index, do a full lookup.
+	for (auto const& superMapItem : superClusters) {
 
 		auto const& reactant =
 				static_cast<PSISuperCluster&>(*(superMapItem.second));
 		if (reactant.isIn(nHe, nD, nT, nV)) {
-			lastRet = superMapItem.second.get();
 			return superMapItem.second.get();
 		}
 	}
 
-	return ret;
+	return nullptr;
 }
 
 } // namespace xolotlCore
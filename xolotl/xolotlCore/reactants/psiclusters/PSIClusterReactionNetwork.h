@@ -32,27 +32,44 @@ class PSIClusterReactionNetwork: public ReactionNetwork {
 
 private:
 	/**
-	 * Concise name for map supporting quick lookup of supercluster containing
-	 * specifc number of He and V.
+	 * Index supporting quick lookup of the super cluster containing a
+	 * specific number of He, D, T, and V.
 	 *
-	 * We could use a map, but because we expect it to be dense (i.e.,
-	 * most pairs of He and V counts will have a valid super cluster),
-	 * a 2D matrix indexed by nHe and nV gives better performance for
-	 * lookups without costing too much more (if any) in terms of memory.
-	 * We use a vector of vectors instead of array of arrays because
-	 * we don't know the dimensions at compile time.  We use a vector of
-	 * vectors instead of a single vector with more complex indexing
-	 * to simplify indexing.  It may be worthwhile to compare performance
-	 * with a single vector implementation to see if the single
-	 * memory allocation ends up giving better performance.
+	 * The bounds of the super clusters cut each axis in intervals, and the
+	 * phase space in cells that belong to at most one super cluster. We
+	 * expect it to be dense, so the cells are stored in a single vector
+	 * and a lookup is four table reads.
 	 */
-	using HeVToSuperClusterMap = std::vector<std::vector<ReactantMap::const_iterator> >;
+	struct SuperClusterIndex {
+		//! The number of super clusters when the index was built.
+		std::size_t nSupers = 0;
+
+		//! The interval of each value along each axis, -1 outside.
+		std::array<std::vector<int>, 4> intervals;
+
+		//! The stride of each axis in the cells.
+		std::array<std::size_t, 4> strides;
+
+		//! The super cluster of each cell, nullptr where there is none.
+		std::vector<IReactant *> cells;
+
+		//! False if the super clusters must be scanned instead.
+		bool isValid = false;
+	};
+
+	//! The largest number of cells of the super cluster index.
+	static constexpr std::size_t maxSuperIndexCells = 1 << 22;
 
 	/**
-	 * Map supporting quick identification of super cluster containing
-	 * given number of He and V.
+	 * The index of the super clusters, it is built the first time a super
+	 * cluster is looked for after they changed.
 	 */
-	HeVToSuperClusterMap superClusterLookupMap;
+	SuperClusterIndex superClusterIndex;
+
+	/**
+	 * Build the index of the super clusters.
+	 */
+	void buildSuperClusterIndex();
 
 	//! The dimension of the phase space
 	int psDim = 0;
@@ -61,16 +78,10 @@ private:
 	Array<int, 5> indexList;
 
 	/**
-	 * Calculate the dissociation constant of the first cluster with respect to
-	 * the single-species cluster of the same type based on the current clusters
-	 * atomic volume, reaction rate constant, and binding energies.
-	 *
-	 * @param reaction The reaction
-	 * @param i The location on the grid in the depth direction
-	 * @return The dissociation constant
+	 * Get the atomic volume of the tungsten.
+	 * \see ReactionNetwork.h
 	 */
-	double calculateDissociationConstant(
-			const DissociationReaction& reaction, int i) const override;
+	double getAtomicVolume() const override;
 
 	/**
 	 * Calculate the binding energy for the dissociation cluster to emit the single
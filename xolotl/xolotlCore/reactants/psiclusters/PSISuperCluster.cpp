@@ -1,5 +1,6 @@
 // Includes
 #include <iterator>
+#include <algorithm>
 #include "PSISuperCluster.h"
 #include "PSIClusterReactionNetwork.h"
 #include <xolotlPerf.h>
@@ -1340,6 +1341,78 @@ void PSISuperCluster::resetConnectivities() {
 	return;
 }
 
+/**
+ * Get the ids of the reactants of a key of the maps of effective pairs,
+ * they give the same order on all the processes, unlike their addresses.
+ */
+static std::pair<int, int> getKeyIds(const ReactantAddrPair& key) {
+	return std::make_pair(key.first->getId(), key.second->getId());
+}
+static std::pair<int, int> getKeyIds(const IReactant* key) {
+	return std::make_pair(key->getId(), 0);
+}
+
+/**
+ * Make the effective pairs of a map use their coefficients stored in
+ * shared memory, in the order of the ids of their keys.
+ *
+ * @param pairMap The map of effective pairs
+ * @param shared Where the coefficients of the first pair are, the next
+ * ones follow
+ * @param copy Whether to copy the coefficients there first
+ * @param nShared Incremented by the number of coefficients now used from
+ * the shared memory
+ * @return Where the coefficients after the ones of the pairs are
+ */
+template<typename TMap>
+static double* useSharedMapCoefs(TMap& pairMap, double* shared, bool copy,
+		std::size_t& nShared) {
+	std::vector<typename TMap::value_type*> sortedItems;
+	sortedItems.reserve(pairMap.size());
+	for (auto& currMapItem : pairMap)
+		sortedItems.push_back(&currMapItem);
+	std::sort(sortedItems.begin(), sortedItems.end(),
+			[](const typename TMap::value_type* a,
+					const typename TMap::value_type* b) {
+				return getKeyIds(a->first) < getKeyIds(b->first);
+			});
+
+	for (auto currMapItem : sortedItems) {
+		auto& currPair = currMapItem->second;
+		if (currPair.useSharedCoefs(shared, copy))
+			nShared += currPair.getNumCoefs();
+		shared += currPair.getNumCoefs();
+	}
+
+	return shared;
+}
+
+std::size_t PSISuperCluster::getNumCoefficients() const {
+	std::size_t nCoefs = PSICluster::getNumCoefficients();
+	for (auto const& currMapItem : effReactingList)
+		nCoefs += currMapItem.second.getNumCoefs();
+	for (auto const& currMapItem : effCombiningList)
+		nCoefs += currMapItem.second.getNumCoefs();
+	for (auto const& currMapItem : effDissociatingList)
+		nCoefs += currMapItem.second.getNumCoefs();
+	for (auto const& currMapItem : effEmissionList)
+		nCoefs += currMapItem.second.getNumCoefs();
+
+	return nCoefs;
+}
+
+std::size_t PSISuperCluster::useSharedCoefficients(double* shared,
+		bool copy) {
+	std::size_t nShared = PSICluster::useSharedCoefficients(shared, copy);
+	shared += PSICluster::getNumCoefficients();
+	shared = useSharedMapCoefs(effReactingList, shared, copy, nShared);
+	shared = useSharedMapCoefs(effCombiningList, shared, copy, nShared);
+	shared = useSharedMapCoefs(effDissociatingList, shared, copy, nShared);
+	useSharedMapCoefs(effEmissionList, shared, copy, nShared);
+
+	return nShared;
+}
+
 double PSISuperCluster::getDissociationFlux(int xi) {
 	// Initial declarations
 	double flux = 0.0;
@@ -1351,6 +1424,9 @@ double PSISuperCluster::getDissociationFlux(int xi) {
 	std::for_each(effDissociatingList.begin(), effDissociatingList.end(),
 			[this,&flux,&xi](DissociationPairMap::value_type const& currMapItem) {
 				auto const& currPair = currMapItem.second;
+				// Skip the pruned dissociations
+				if (!currPair.reaction.isActive)
+					return;
 
 				// Get the dissociating clusters
 				auto const& dissociatingCluster = currPair.first;
@@ -1390,6 +1466,9 @@ double PSISuperCluster::getEmissionFlux(int xi) {
 	std::for_each(effEmissionList.begin(), effEmissionList.end(),
 			[this,&flux,&xi](DissociationPairMap::value_type const& currMapItem) {
 				auto const& currPair = currMapItem.second;
+				// Skip the pruned dissociations
+				if (!currPair.reaction.isActive)
+					return;
 				double lA[5] = {};
 				lA[0] = l0;
 				for (int i = 1; i < psDim; i++) {
@@ -1650,6 +1729,9 @@ void PSISuperCluster::computeDissociationPartialDerivatives(double* partials[5],
 			[this,
 			&partials, &partialsIdxMap,&xi](DissociationPairMap::value_type const& currMapItem) {
 				auto& currPair = currMapItem.second;
+				// Skip the pruned dissociations
+				if (!currPair.reaction.isActive)
+					return;
 
 				// Get the dissociating clusters
 				auto const& cluster = currPair.first;
@@ -1689,6 +1771,9 @@ void PSISuperCluster::computeEmissionPartialDerivatives(double* partials[5],
 			[this,
 			&partials, &partialsIdxMap,&xi](DissociationPairMap::value_type const& currMapItem) {
 				auto& currPair = currMapItem.second;
+				// Skip the pruned dissociations
+				if (!currPair.reaction.isActive)
+					return;
 
 				// Compute the contribution from the dissociating cluster
 				auto value = currPair.reaction.kConstant[xi] / (double) nTot;
@@ -96,22 +96,25 @@ protected:
 		 */
 		double ***coefs;
 
+		//! The dimension
+		int dim;
+
+		//! Whether the coefficients are in the shared memory of the network
+		bool sharedCoefs = false;
+
 		//! The constructor, disallowed
 		ProductionCoefficientBase() = delete;
 
 		//! The constructor to use
-		ProductionCoefficientBase(const int dim) {
-			// Create the array of the right dimension
+		ProductionCoefficientBase(const int _dim) :
+				dim(_dim) {
+			// Create the array of the right dimension, the coefficients
+			// are contiguous
 			coefs = new double**[dim];
 			for (int i = 0; i < dim; i++) {
 				coefs[i] = new double*[dim];
-				for (int j = 0; j < dim; j++) {
-					coefs[i][j] = new double[dim];
-					for (int k = 0; k < dim; k++) {
-						coefs[i][j][k] = 0.0;
-					}
-				}
 			}
+			setCoefs(new double[dim * dim * dim]());
 		}
 
 		/**
@@ -121,8 +124,56 @@ protected:
 
 		//! The destructor
 		~ProductionCoefficientBase() {
+			if (!sharedCoefs)
+				delete[] coefs[0][0];
+			for (int i = 0; i < dim; i++) {
+				delete[] coefs[i];
+			}
 			delete[] coefs;
 		}
+
+		//! The number of coefficients
+		std::size_t getNumCoefs() const {
+			return dim * dim * dim;
+		}
+
+		//! The contiguous coefficients
+		const double* getCoefs() const {
+			return coefs[0][0];
+		}
+
+		/**
+		 * Use the coefficients stored in the shared memory of the network,
+		 * only if they are exactly ours.
+		 *
+		 * @param target Where they are
+		 * @param copy Whether to copy ours there first
+		 * @return True if they are used
+		 */
+		bool useSharedCoefs(double* target, bool copy) {
+			const double* values = getCoefs();
+			if (copy)
+				std::copy(values, values + getNumCoefs(), target);
+			else if (!std::equal(values, values + getNumCoefs(), target))
+				return false;
+
+			if (!sharedCoefs)
+				delete[] coefs[0][0];
+			setCoefs(target);
+			sharedCoefs = true;
+
+			return true;
+		}
+
+	private:
+		//! Point the arrays to the contiguous coefficients.
+		void setCoefs(double* values) {
+			for (int i = 0; i < dim; i++) {
+				for (int j = 0; j < dim; j++) {
+					coefs[i][j] = values + (i * dim + j) * dim;
+				}
+			}
+		}
 	};
 
 	/**
@@ -225,17 +276,22 @@ protected:
 		 */
 		double **coefs;
 
+		//! The dimension
+		int dim;
+
+		//! Whether the coefficients are in the shared memory of the network
+		bool sharedCoefs = false;
+
 		//! The constructor
 		SuperClusterDissociationPair(Reaction& _reaction, PSICluster& _first,
-				PSICluster& _second, int dim) :
-				ReactingPairBase(_reaction, _first, _second) {
-			// Create the array of the right dimension
+				PSICluster& _second, int _dim) :
+				ReactingPairBase(_reaction, _first, _second), dim(_dim) {
+			// Create the array of the right dimension, the coefficients
+			// are contiguous
 			coefs = new double*[dim];
-			for (int i = 0; i < dim; i++) {
-				coefs[i] = new double[dim];
-				for (int j = 0; j < dim; j++) {
-					coefs[i][j] = 0.0;
-				}
+			coefs[0] = new double[dim * dim]();
+			for (int i = 1; i < dim; i++) {
+				coefs[i] = coefs[0] + i * dim;
 			}
 		}
 
@@ -247,8 +303,45 @@ protected:
 
 		//! The destructor
 		~SuperClusterDissociationPair() {
+			if (!sharedCoefs)
+				delete[] coefs[0];
 			delete[] coefs;
 		}
+
+		//! The number of coefficients
+		std::size_t getNumCoefs() const {
+			return dim * dim;
+		}
+
+		//! The contiguous coefficients
+		const double* getCoefs() const {
+			return coefs[0];
+		}
+
+		/**
+		 * Use the coefficients stored in the shared memory of the network,
+		 * only if they are exactly ours.
+		 *
+		 * @param target Where they are
+		 * @param copy Whether to copy ours there first
+		 * @return True if they are used
+		 */
+		bool useSharedCoefs(double* target, bool copy) {
+			const double* values = getCoefs();
+			if (copy)
+				std::copy(values, values + getNumCoefs(), target);
+			else if (!std::equal(values, values + getNumCoefs(), target))
+				return false;
+
+			if (!sharedCoefs)
+				delete[] coefs[0];
+			for (int i = 0; i < dim; i++) {
+				coefs[i] = target + i * dim;
+			}
+			sharedCoefs = true;
+
+			return true;
+		}
 	};
 
 	/**
@@ -664,6 +757,21 @@ public:
 	 */
 	void resetConnectivities() override;
 
+	/**
+	 * This operation returns the number of coefficients of the pairs,
+	 * including the effective ones of the super cluster.
+	 * \see IReactant.h
+	 */
+	std::size_t getNumCoefficients() const override;
+
+	/**
+	 * This operation makes the pairs use their coefficients stored in
+	 * shared memory, the effective ones in the order of the ids of their
+	 * clusters.
+	 * \see IReactant.h
+	 */
+	std::size_t useSharedCoefficients(double* shared, bool copy) override;
+
 	/**
 	 * This operation returns the total flux of this cluster in the
 	 * current network.
@@ -50,13 +50,81 @@ private:
 	 */
 	double heatConductivity;
 
+	/**
+	 * Is the heat equation solved on its own between the time steps
+	 * of the clusters?
+	 */
+	bool operatorSplit;
+
+	/**
+	 * Add the flux due to the heat equation at a grid point.
+	 *
+	 * @param tempVector The pointer to the pointer of arrays at middle/
+	 * left/right grid points
+	 * @param updatedOffset The pointer to the array of the new values at the grid point
+	 * @param index The index of the temperature in the arrays
+	 * @param hxLeft The step size on the left side of the point in the x direction
+	 * @param hxRight The step size on the right side of the point in the x direction
+	 * @param ix The position on the x grid
+	 */
+	void addHeatFlux(double **tempVector, double *updatedOffset, int index,
+			double hxLeft, double hxRight, int xi) const {
+		// Get the initial temperatures
+		double oldConc = tempVector[0][index];
+		double oldLeftConc = tempVector[1][index];
+		double oldRightConc = tempVector[2][index];
+
+		// Boundary condition with heat flux
+		if (xi == surfacePosition) {
+			// Include the flux boundary condition
+			updatedOffset[index] += (2.0 * heatCoef / hxLeft)
+					* ((heatFlux / heatConductivity)
+							+ (oldRightConc - oldConc) / hxRight);
+
+			return;
+		}
+
+		// Use a simple midpoint stencil to compute the concentration
+		updatedOffset[index] += heatCoef * 2.0
+				* (oldLeftConc + (hxLeft / hxRight) * oldRightConc
+						- (1.0 + (hxLeft / hxRight)) * oldConc)
+				/ (hxLeft * (hxLeft + hxRight));
+
+		return;
+	}
+
+	/**
+	 * Compute the partials due to the heat equation at a grid point.
+	 *
+	 * @param val The pointer to the array that will contain the values of partials
+	 * @param hxLeft The step size on the left side of the point in the x direction
+	 * @param hxRight The step size on the right side of the point in the x direction
+	 * @param ix The position on the x grid
+	 */
+	void getHeatPartials(double *val, double hxLeft, double hxRight,
+			int xi) const {
+		// Compute the partial derivatives for diffusion of this cluster
+		// for the middle, left, and right grid point
+		val[0] = -2.0 * heatCoef / (hxLeft * hxRight); // middle
+		val[1] = heatCoef * 2.0 / (hxLeft * (hxLeft + hxRight)); // left
+		val[2] = heatCoef * 2.0 / (hxRight * (hxLeft + hxRight)); // right
+
+		if (xi == surfacePosition) {
+			val[1] = 0.0;
+			val[2] = 2.0 * heatCoef / (hxLeft * hxRight);
+		}
+
+		return;
+	}
+
 	/**
 	 * The default constructor is private because the TemperatureHandler
 	 * must be initialized with a temperature
 	 */
 	HeatEquationHandler() :
 			heatFlux(0.0), bulkTemperature(0.0), localTemperature(0.0), dof(0), surfacePosition(
-					0.0), heatCoef(0.0), heatConductivity(0.0) {
+					0.0), heatCoef(0.0), heatConductivity(0.0), operatorSplit(
+					false) {
 	}
 
 public:
@@ -70,7 +138,7 @@ public:
 	HeatEquationHandler(double flux, double bulkTemp) :
 			heatFlux(flux), bulkTemperature(bulkTemp), localTemperature(0.0), dof(
 					0), surfacePosition(0.0), heatCoef(0.0), heatConductivity(
-					0.0) {
+					0.0), operatorSplit(false) {
 	}
 
 	/**
@@ -151,34 +219,17 @@ public:
 	/**
 	 * Compute the flux due to the heat equation.
 	 * This method is called by the RHSFunction from the PetscSolver.
+	 * Don't do anything when the heat equation is solved on its own.
 	 *
 	 * \see ITemperatureHandler.h
 	 */
 	virtual void computeTemperature(double **concVector,
 			double *updatedConcOffset, double hxLeft, double hxRight, int xi) {
-		// Initial declaration
-		int index = dof - 1;
-
-		// Get the initial concentrations
-		double oldConc = concVector[0][index];
-		double oldLeftConc = concVector[1][index];
-		double oldRightConc = concVector[2][index];
-
-		// Boundary condition with heat flux
-		if (xi == surfacePosition) {
-			// Include the flux boundary condition
-			updatedConcOffset[index] += (2.0 * heatCoef / hxLeft)
-					* ((heatFlux / heatConductivity)
-							+ (oldRightConc - oldConc) / hxRight);
-
+		if (operatorSplit)
 			return;
-		}
 
-		// Use a simple midpoint stencil to compute the concentration
-		updatedConcOffset[index] += heatCoef * 2.0
-				* (oldLeftConc + (hxLeft / hxRight) * oldRightConc
-						- (1.0 + (hxLeft / hxRight)) * oldConc)
-				/ (hxLeft * (hxLeft + hxRight));
+		addHeatFlux(concVector, updatedConcOffset, dof - 1, hxLeft, hxRight,
+				xi);
 
 		return;
 	}
@@ -186,6 +237,7 @@ public:
 	/**
 	 * Compute the partials due to the heat equation.
 	 * This method is called by the RHSJacobian from the PetscSolver.
+	 * The partials are null when the heat equation is solved on its own.
 	 *
 	 * \see ITemperatureHandler.h
 	 */
@@ -195,17 +247,58 @@ public:
 		// the row and column indices for the Jacobian
 		indices[0] = dof - 1;
 
-		// Compute the partial derivatives for diffusion of this cluster
-		// for the middle, left, and right grid point
-		val[0] = -2.0 * heatCoef / (hxLeft * hxRight); // middle
-		val[1] = heatCoef * 2.0 / (hxLeft * (hxLeft + hxRight)); // left
-		val[2] = heatCoef * 2.0 / (hxRight * (hxLeft + hxRight)); // right
+		if (operatorSplit) {
+			val[0] = 0.0; // middle
+			val[1] = 0.0; // left
+			val[2] = 0.0; // right
 
-		if (xi == surfacePosition) {
-			val[1] = 0.0;
-			val[2] = 2.0 * heatCoef / (hxLeft * hxRight);
+			return;
 		}
 
+		getHeatPartials(val, hxLeft, hxRight, xi);
+
+		return;
+	}
+
+	/**
+	 * This operation sets whether the heat equation is solved on its own.
+	 *
+	 * \see ITemperatureHandler.h
+	 */
+	virtual void setOperatorSplit(bool split) {
+		operatorSplit = split;
+	}
+
+	/**
+	 * This operation returns whether the heat equation is solved on its own.
+	 *
+	 * \see ITemperatureHandler.h
+	 */
+	virtual bool isOperatorSplit() const {
+		return operatorSplit;
+	}
+
+	/**
+	 * Compute the flux due to the heat equation for its own solve.
+	 *
+	 * \see ITemperatureHandler.h
+	 */
+	virtual void computeSplitTemperature(double **tempVector,
+			double *updatedTemp, double hxLeft, double hxRight, int xi) {
+		addHeatFlux(tempVector, updatedTemp, 0, hxLeft, hxRight, xi);
+
+		return;
+	}
+
+	/**
+	 * Compute the partials due to the heat equation for its own solve.
+	 *
+	 * \see ITemperatureHandler.h
+	 */
+	virtual void computeSplitPartialsForTemperature(double *val, double hxLeft,
+			double hxRight, int xi) {
+		getHeatPartials(val, hxLeft, hxRight, xi);
+
 		return;
 	}
 
@@ -102,6 +102,52 @@ public:
 	virtual void computePartialsForTemperature(double *val, int *indices,
 			double hxLeft, double hxRight, int xi) = 0;
 
+	/**
+	 * This operation sets whether the heat equation is solved on its own
+	 * between the time steps of the clusters (operator splitting) instead of
+	 * with them. The temperature is then frozen during each time step of the
+	 * clusters, computeTemperature() and computePartialsForTemperature() do
+	 * not contribute anymore. It is only read when the RHS function and
+	 * Jacobian are computed, so it can be set at any time before the solve.
+	 *
+	 * @param split True to solve the heat equation on its own
+	 */
+	virtual void setOperatorSplit(bool split) = 0;
+
+	/**
+	 * This operation returns whether the heat equation is solved on its own.
+	 *
+	 * @return True if the heat equation is solved on its own
+	 */
+	virtual bool isOperatorSplit() const = 0;
+
+	/**
+	 * Compute the flux due to the heat equation for its own solve, where
+	 * the temperature is the only degree of freedom at each grid point.
+	 *
+	 * @param tempVector The pointer to the pointer of the temperature at middle/
+	 * left/right grid points
+	 * @param updatedTemp The pointer to the new temperature at the grid point
+	 * where the heat equation is computed
+	 * @param hxLeft The step size on the left side of the point in the x direction
+	 * @param hxRight The step size on the right side of the point in the x direction
+	 * @param ix The position on the x grid
+	 */
+	virtual void computeSplitTemperature(double **tempVector,
+			double *updatedTemp, double hxLeft, double hxRight, int xi) = 0;
+
+	/**
+	 * Compute the partials due to the heat equation for its own solve.
+	 *
+	 * @param val The pointer to the array that will contain the values of partials
+	 * with respect to the middle, left, and right temperatures
+	 * @param hxLeft The step size on the left side of the point in the x direction
+	 * @param hxRight The step size on the right side of the point in the x direction
+	 * @param ix The position on the x grid
+	 */
+	virtual void computeSplitPartialsForTemperature(double *val, double hxLeft,
+			double hxRight, int xi) = 0;
+
 };
 //end class ITemperatureHandler
 
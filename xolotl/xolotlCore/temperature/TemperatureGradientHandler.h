@@ -164,6 +164,51 @@ public:
 		return;
 	}
 
+	/**
+	 * This operation sets whether the heat equation is solved on its own.
+	 * Don't do anything, there is no heat equation.
+	 *
+	 * \see ITemperatureHandler.h
+	 */
+	virtual void setOperatorSplit(bool split) {
+		return;
+	}
+
+	/**
+	 * This operation returns whether the heat equation is solved on its own.
+	 *
+	 * \see ITemperatureHandler.h
+	 */
+	virtual bool isOperatorSplit() const {
+		return false;
+	}
+
+	/**
+	 * Compute the flux due to the heat equation for its own solve.
+	 * Don't do anything.
+	 *
+	 * \see ITemperatureHandler.h
+	 */
+	virtual void computeSplitTemperature(double **tempVector,
+			double *updatedTemp, double hxLeft, double hxRight, int xi) {
+		return;
+	}
+
+	/**
+	 * Compute the partials due to the heat equation for its own solve.
+	 * Don't do anything.
+	 *
+	 * \see ITemperatureHandler.h
+	 */
+	virtual void computeSplitPartialsForTemperature(double *val, double hxLeft,
+			double hxRight, int xi) {
+		val[0] = 0.0; // middle
+		val[1] = 0.0; // left
+		val[2] = 0.0; // right
+
+		return;
+	}
+
 };
 //end class TemperatureGradientHandler
 
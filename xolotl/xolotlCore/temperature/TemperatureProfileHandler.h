@@ -5,6 +5,7 @@
 #include <string>
 #include <iostream>
 #include <fstream>
+#include <MPIUtils.h>
 
 namespace xolotlCore {
 
@@ -84,12 +85,15 @@ public:
 		// Add the temperature to dfill
         dfillMap[(dof - 1)].emplace_back(dof - 1);
 
-		// Open file dataFile.dat containing the time and temperature
-		std::ifstream inputFile(tempFile.c_str());
+		// Open file dataFile.dat containing the time and temperature,
+		// only the first process reads it
+		auto inputFile = MPIUtils::broadcastFile(tempFile);
+		if (!inputFile)
+			return;
 		std::string line;
 
 		// Read the file and store the values in the two vectors
-		while (getline(inputFile, line)) {
+		while (getline(*inputFile, line)) {
 			if (!line.length() || line[0] == '#')
 				continue;
 			double xtemp = 0.0, ytemp = 0.0;
@@ -213,6 +217,51 @@ public:
 		return;
 	}
 
+	/**
+	 * This operation sets whether the heat equation is solved on its own.
+	 * Don't do anything, there is no heat equation.
+	 *
+	 * \see ITemperatureHandler.h
+	 */
+	virtual void setOperatorSplit(bool split) {
+		return;
+	}
+
+	/**
+	 * This operation returns whether the heat equation is solved on its own.
+	 *
+	 * \see ITemperatureHandler.h
+	 */
+	virtual bool isOperatorSplit() const {
+		return false;
+	}
+
+	/**
+	 * Compute the flux due to the heat equation for its own solve.
+	 * Don't do anything.
+	 *
+	 * \see ITemperatureHandler.h
+	 */
+	virtual void computeSplitTemperature(double **tempVector,
+			double *updatedTemp, double hxLeft, double hxRight, int xi) {
+		return;
+	}
+
+	/**
+	 * Compute the partials due to the heat equation for its own solve.
+	 * Don't do anything.
+	 *
+	 * \see ITemperatureHandler.h
+	 */
+	virtual void computeSplitPartialsForTemperature(double *val, double hxLeft,
+			double hxRight, int xi) {
+		val[0] = 0.0; // middle
+		val[1] = 0.0; // left
+		val[2] = 0.0; // right
+
+		return;
+	}
+
 };
 //end class TemperatureProfileHandler
 
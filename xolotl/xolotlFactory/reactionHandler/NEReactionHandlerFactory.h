@@ -54,6 +54,7 @@ public:
 		// Set the options for the grouping scheme
 		tempNetworkLoader->setXeMin(options.getGroupingMin());
 		tempNetworkLoader->setWidth(options.getGroupingWidthA());
+		tempNetworkLoader->setWidthRatio(options.getGroupingRatio());
 		theNetworkLoaderHandler = tempNetworkLoader;
 
 		// Check if we want dummy reactions
@@ -13,13 +13,14 @@ namespace xolotlFactory {
 static std::shared_ptr<xolotlViz::IVizHandlerRegistry> theHandlerRegistry;
 
 // Create the desired type of handler registry.
-bool initializeVizHandler(bool useStdRegistry) {
+bool initializeVizHandler(bool useStdRegistry, bool useAsync) {
 	bool ret = true;
 
 	if (useStdRegistry) {
 #if defined(HAVE_VIZLIB_STD)
 		// we are to use a standard handler registry
-		theHandlerRegistry = std::make_shared<xolotlViz::StandardHandlerRegistry>();
+		theHandlerRegistry = std::make_shared<xolotlViz::StandardHandlerRegistry>(
+				useAsync);
 #else
 		// Get the current process ID
 		int procId;
@@ -51,4 +52,10 @@ std::shared_ptr<xolotlViz::IVizHandlerRegistry> getVizHandlerRegistry(void) {
 	return theHandlerRegistry;
 }
 
+// Finish the rendering of the plots.
+void finalizeVizHandler() {
+	if (theHandlerRegistry)
+		theHandlerRegistry->finalize();
+}
+
 } // end namespace xolotlFactory
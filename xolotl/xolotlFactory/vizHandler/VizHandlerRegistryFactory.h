@@ -11,9 +11,11 @@ namespace xolotlFactory
 
 /**
  * Build the desired type of handler registry.
+ * @param useStdRegistry Whether to use the standard handlers.
+ * @param useAsync Whether the standard plots are rendered on a background thread.
  * @return True iff the handler registry was created successfully.
  */
-bool initializeVizHandler(bool useStdRegistry);
+bool initializeVizHandler(bool useStdRegistry, bool useAsync = false);
 
 /**
  * Access the handler registry.
@@ -21,6 +23,12 @@ bool initializeVizHandler(bool useStdRegistry);
  */
 std::shared_ptr<xolotlViz::IVizHandlerRegistry> getVizHandlerRegistry();
 
+/**
+ * Finish the rendering of the plots, it does nothing if the handler
+ * registry was not created. It must be called before MPI is finalized.
+ */
+void finalizeVizHandler();
+
 } // end namespace xolotlFactory
 
 #endif // VIZHANDLERREGISTRYFACTORY_H
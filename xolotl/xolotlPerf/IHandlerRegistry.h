@@ -8,6 +8,7 @@
 #include "ITimer.h"
 #include "IEventCounter.h"
 #include "IHardwareCounter.h"
+#include "IMemoryTracker.h"
 #include "PerfObjStatistics.h"
 
 namespace xolotlPerf {
@@ -52,6 +53,12 @@ public:
 			const std::string& name,
 			const IHardwareCounter::SpecType& ctrSpec) = 0;
 
+	/**
+	 * This operation returns the IMemoryTracker specified by the parameter.
+	 */
+	virtual std::shared_ptr<IMemoryTracker> getMemoryTracker(
+			const std::string& name) = 0;
+
 	/**
 	 * Collect statistics about any performance data collected by
 	 * processes of the program.
@@ -59,11 +66,13 @@ public:
 	 * @param timerStats Map of timer statistics, keyed by timer name.
 	 * @param counterStats Map of counter statistics, keyed by counter name.
 	 * @param hwCounterStats Map of hardware counter statistics, keyed by IHardwareCounter name + ':' + hardware counter name.
+	 * @param memStats Map of memory statistics, keyed by memory tracker name.
 	 *
 	 */
 	virtual void collectStatistics(PerfObjStatsMap<ITimer::ValType>& timerStats,
 			PerfObjStatsMap<IEventCounter::ValType>& counterStats,
-			PerfObjStatsMap<IHardwareCounter::CounterType>& hwCounterStats) = 0;
+			PerfObjStatsMap<IHardwareCounter::CounterType>& hwCounterStats,
+			PerfObjStatsMap<IMemoryTracker::ValType>& memStats) = 0;
 
 	/**
 	 * Report performance data statistics to the given stream.
@@ -72,12 +81,14 @@ public:
 	 * @param timerStats Map of timer statistics, keyed by timer name.
 	 * @param counterStats Map of counter statistics, keyed by counter name.
 	 * @param hwCounterStats Map of hardware counter statistics, keyed by IHardwareCounter name + ':' + hardware counter name.
+	 * @param memStats Map of memory statistics, keyed by memory tracker name.
 	 *
 	 */
 	virtual void reportStatistics(std::ostream& os,
 			const PerfObjStatsMap<ITimer::ValType>& timerStats,
 			const PerfObjStatsMap<IEventCounter::ValType>& counterStats,
-			const PerfObjStatsMap<IHardwareCounter::CounterType>& hwCounterStats) const = 0;
+			const PerfObjStatsMap<IHardwareCounter::CounterType>& hwCounterStats,
+			const PerfObjStatsMap<IMemoryTracker::ValType>& memStats) const = 0;
 
 };
 
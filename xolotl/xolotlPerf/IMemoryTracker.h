@@ -0,0 +1,84 @@
+#ifndef IMEMORYTRACKER_H
+#define IMEMORYTRACKER_H
+
+#include "mpi.h"
+#include <limits.h>
+#include "../xolotlCore/IIdentifiable.h"
+
+namespace xolotlPerf {
+
+/**
+ * Realizations of this interface are responsible for the collection
+ * of memory usage data, in bytes.
+ *
+ * A tracker is used in one of two ways: either the allocations of a kind
+ * of data structure are accounted with add() and remove(), or the resident
+ * set size of the process is sampled with sample() when a region of code
+ * is entered and left.  In both cases the value that is aggregated
+ * across the processes is the peak.
+ */
+class IMemoryTracker: public virtual xolotlCore::IIdentifiable {
+
+public:
+	/**
+	 * Type of the tracked value, a number of bytes.
+	 */
+	typedef unsigned long ValType;
+
+	/**
+	 * MPI type used when transmitting a ValType.
+	 */
+	static const MPI_Datatype MPIValType;
+
+	/**
+	 * The minimum value possible.
+	 */
+	static const ValType MinValue = 0;
+
+	/**
+	 * The maximum value possible.
+	 */
+	static const ValType MaxValue = ULONG_MAX;
+
+	/**
+	 * The destructor
+	 */
+	virtual ~IMemoryTracker() {
+	}
+
+	/**
+	 * This operation returns the peak number of bytes.
+	 */
+	virtual ValType getValue() const = 0;
+
+	/**
+	 * This operation returns the current number of bytes.
+	 */
+	virtual ValType getCurrentValue() const = 0;
+
+	/**
+	 * This operation accounts for an allocation.
+	 *
+	 * @param bytes The size of the allocation
+	 */
+	virtual void add(ValType bytes) = 0;
+
+	/**
+	 * This operation accounts for a deallocation.
+	 *
+	 * @param bytes The size of the deallocation
+	 */
+	virtual void remove(ValType bytes) = 0;
+
+	/**
+	 * This operation sets the current value to the resident set size
+	 * of the process.
+	 */
+	virtual void sample() = 0;
+
+};
+//end class IMemoryTracker
+
+}//end namespace xolotlPerf
+
+#endif
@@ -30,10 +30,17 @@ std::shared_ptr<IHardwareCounter> DummyHandlerRegistry::getHardwareCounter(
 	return std::make_shared < DummyHardwareCounter > (name, ctrSpec);
 }
 
+// Obtain a MemoryTracker by name.
+std::shared_ptr<IMemoryTracker> DummyHandlerRegistry::getMemoryTracker(
+		const std::string& name) {
+	return std::make_shared < DummyMemoryTracker > (name);
+}
+
 void DummyHandlerRegistry::collectStatistics(
 		PerfObjStatsMap<ITimer::ValType>&,
 		PerfObjStatsMap<IEventCounter::ValType>&,
-		PerfObjStatsMap<IHardwareCounter::CounterType>&) {
+		PerfObjStatsMap<IHardwareCounter::CounterType>&,
+		PerfObjStatsMap<IMemoryTracker::ValType>&) {
 	// do nothing
 	return;
 }
@@ -41,7 +48,8 @@ void DummyHandlerRegistry::collectStatistics(
 void DummyHandlerRegistry::reportStatistics(std::ostream&,
 		const PerfObjStatsMap<ITimer::ValType>&,
 		const PerfObjStatsMap<IEventCounter::ValType>&,
-		const PerfObjStatsMap<IHardwareCounter::CounterType>&) const {
+		const PerfObjStatsMap<IHardwareCounter::CounterType>&,
+		const PerfObjStatsMap<IMemoryTracker::ValType>&) const {
 	// do nothing
 	return;
 }
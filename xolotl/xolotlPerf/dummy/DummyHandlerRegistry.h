@@ -5,6 +5,7 @@
 #include "xolotlPerf/dummy/DummyTimer.h" //Dependency Generated Source:DummyHandlerRegistry Target:DummyTimer
 #include "xolotlPerf/dummy/DummyEventCounter.h" //Dependency Generated Source:DummyHandlerRegistry Target:DummyEventCounter
 #include "xolotlPerf/dummy/DummyHardwareCounter.h" //Dependency Generated Source:DummyHandlerRegistry Target:DummyHardwareCounter
+#include "xolotlPerf/dummy/DummyMemoryTracker.h"
 
 namespace xolotlPerf {
 
@@ -34,6 +35,10 @@ public:
 	virtual std::shared_ptr<IHardwareCounter> getHardwareCounter(
 			const std::string& name, const IHardwareCounter::SpecType& ctrSpec);
 
+	// Obtain a MemoryTracker by name.
+	virtual std::shared_ptr<IMemoryTracker> getMemoryTracker(
+			const std::string& name);
+
 	/**
 	 * Collect statistics about any performance data collected by
 	 * processes of the program.
@@ -42,11 +47,13 @@ public:
 	 * @param timerStats Map of timer statistics, keyed by timer name.
 	 * @param counterStats Map of counter statistics, keyed by counter name.
 	 * @param hwCounterStats Map of hardware counter statistics, keyed by IHardwareCounter name + ':' + hardware counter name.
+	 * @param memStats Map of memory statistics, keyed by memory tracker name.
 	 *
 	 */
 	virtual void collectStatistics(PerfObjStatsMap<ITimer::ValType>& timerStats,
 			PerfObjStatsMap<IEventCounter::ValType>& counterStats,
-			PerfObjStatsMap<IHardwareCounter::CounterType>& hwCounterStats);
+			PerfObjStatsMap<IHardwareCounter::CounterType>& hwCounterStats,
+			PerfObjStatsMap<IMemoryTracker::ValType>& memStats);
 
 	/**
 	 * Report performance data statistics to the given stream.
@@ -56,12 +63,14 @@ public:
 	 * @param timerStats Map of timer statistics, keyed by timer name.
 	 * @param counterStats Map of counter statistics, keyed by counter name.
 	 * @param hwCounterStats Map of hardware counter statistics, keyed by IHardwareCounter name + ':' + hardware counter name.
+	 * @param memStats Map of memory statistics, keyed by memory tracker name.
 	 *
 	 */
 	virtual void reportStatistics(std::ostream& os,
 			const PerfObjStatsMap<ITimer::ValType>& timerStats,
 			const PerfObjStatsMap<IEventCounter::ValType>& counterStats,
-			const PerfObjStatsMap<IHardwareCounter::CounterType>& hwCounterStats) const;
+			const PerfObjStatsMap<IHardwareCounter::CounterType>& hwCounterStats,
+			const PerfObjStatsMap<IMemoryTracker::ValType>& memStats) const;
 };
 
 } //end namespace xolotlPerf
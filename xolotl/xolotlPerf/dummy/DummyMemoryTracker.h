@@ -0,0 +1,81 @@
+#ifndef DUMMYMEMORYTRACKER_H
+#define DUMMYMEMORYTRACKER_H
+
+#include <string>
+#include "xolotlCore/Identifiable.h"
+#include "xolotlPerf/IMemoryTracker.h"
+
+namespace xolotlPerf {
+
+/**
+ * The DummyMemoryTracker class is instantiated by the DummyHandlerRegistry
+ * class and realizes the IMemoryTracker interface without reading the
+ * memory of the process.
+ */
+class DummyMemoryTracker: public IMemoryTracker,
+		public xolotlCore::Identifiable {
+
+private:
+
+	/**
+	 * The default constructor is declared private since all MemoryTrackers
+	 *  must be initialized with a name.
+	 */
+	DummyMemoryTracker(void) :
+			xolotlCore::Identifiable("unused") {
+	}
+
+public:
+
+	/**
+	 * DummyMemoryTracker constructor that takes the argument name but
+	 * doesn't do anything with it
+	 */
+	DummyMemoryTracker(const std::string& name) :
+			xolotlCore::Identifiable("unused") {
+	}
+
+	/**
+	 * The destructor
+	 */
+	virtual ~DummyMemoryTracker() {
+	}
+
+	/**
+	 * This operation returns the peak number of bytes.
+	 */
+	virtual IMemoryTracker::ValType getValue() const {
+		return 0;
+	}
+
+	/**
+	 * This operation returns the current number of bytes.
+	 */
+	virtual IMemoryTracker::ValType getCurrentValue() const {
+		return 0;
+	}
+
+	/**
+	 * This operation accounts for an allocation.
+	 */
+	virtual void add(IMemoryTracker::ValType) {
+	}
+
+	/**
+	 * This operation accounts for a deallocation.
+	 */
+	virtual void remove(IMemoryTracker::ValType) {
+	}
+
+	/**
+	 * This operation samples the resident set size.
+	 */
+	virtual void sample() {
+	}
+
+};
+//end class DummyMemoryTracker
+
+}//end namespace xolotlPerf
+
+#endif
@@ -0,0 +1,33 @@
+#include <fstream>
+#include <unistd.h>
+#include <sys/resource.h>
+#include "xolotlPerf/standard/MemoryTracker.h"
+
+namespace xolotlPerf {
+
+IMemoryTracker::ValType MemoryTracker::getResidentSetSize(void) {
+	// The second field of statm is the number of resident pages (Linux)
+	std::ifstream statm("/proc/self/statm");
+	IMemoryTracker::ValType size = 0, resident = 0;
+	if (!(statm >> size >> resident))
+		return 0;
+
+	return resident * (IMemoryTracker::ValType) sysconf(_SC_PAGESIZE);
+}
+
+IMemoryTracker::ValType MemoryTracker::getPeakResidentSetSize(void) {
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		return 0;
+
+#if defined(__APPLE__)
+	// In bytes on macOS
+	return (IMemoryTracker::ValType) usage.ru_maxrss;
+#else
+	// In kilobytes on Linux
+	return (IMemoryTracker::ValType) usage.ru_maxrss * 1024;
+#endif
+}
+
+} // namespace xolotlPerf
+
@@ -0,0 +1,116 @@
+#ifndef MEMORYTRACKER_H
+#define MEMORYTRACKER_H
+
+#include <algorithm>
+#include "xolotlCore/Identifiable.h"
+#include "xolotlPerf/IMemoryTracker.h"
+
+namespace xolotlPerf {
+
+/**
+ * A MemoryTracker keeps the current and the peak number of bytes of a
+ * kind of data structure, or of the resident set size of the process
+ * when it is sampled.
+ */
+class MemoryTracker: public IMemoryTracker, public xolotlCore::Identifiable {
+private:
+
+	/**
+	 * The current number of bytes.
+	 */
+	IMemoryTracker::ValType current;
+
+	/**
+	 * The peak number of bytes.
+	 */
+	IMemoryTracker::ValType peak;
+
+	/**
+	 * We declare a private default constructor to force
+	 * client code to provide a name when creating MemoryTrackers.
+	 */
+	MemoryTracker(void) :
+			xolotlCore::Identifiable("unused"), current(0), peak(0) {
+	}
+
+public:
+
+	/**
+	 * MemoryTracker constructor that takes the argument name
+	 *
+	 * @param name The MemoryTracker's name
+	 */
+	MemoryTracker(const std::string& name) :
+			xolotlCore::Identifiable(name), current(0), peak(0) {
+	}
+
+	/**
+	 * The destructor
+	 */
+	virtual ~MemoryTracker() {
+	}
+
+	/**
+	 * This operation returns the peak number of bytes.
+	 */
+	IMemoryTracker::ValType getValue() const override {
+		return peak;
+	}
+
+	/**
+	 * This operation returns the current number of bytes.
+	 */
+	IMemoryTracker::ValType getCurrentValue() const override {
+		return current;
+	}
+
+	/**
+	 * This operation accounts for an allocation.
+	 *
+	 * @param bytes The size of the allocation
+	 */
+	void add(IMemoryTracker::ValType bytes) override {
+		current += bytes;
+		peak = std::max(peak, current);
+	}
+
+	/**
+	 * This operation accounts for a deallocation, the current value
+	 * cannot go below zero.
+	 *
+	 * @param bytes The size of the deallocation
+	 */
+	void remove(IMemoryTracker::ValType bytes) override {
+		current -= std::min(current, bytes);
+	}
+
+	/**
+	 * This operation sets the current value to the resident set size
+	 * of the process.
+	 */
+	void sample() override {
+		current = getResidentSetSize();
+		peak = std::max(peak, current);
+	}
+
+	/**
+	 * Get the resident set size of the process.
+	 *
+	 * @return The number of bytes, 0 if it cannot be read
+	 */
+	static IMemoryTracker::ValType getResidentSetSize(void);
+
+	/**
+	 * Get the largest resident set size of the process since it started,
+	 * as recorded by the operating system.
+	 *
+	 * @return The number of bytes, 0 if it cannot be read
+	 */
+	static IMemoryTracker::ValType getPeakResidentSetSize(void);
+
+};
+//end class MemoryTracker
+
+}//end namespace xolotlPerf
+
+#endif
@@ -9,6 +9,7 @@
 #include <string.h>
 #include "xolotlPerf/standard/StdHandlerRegistry.h"
 #include "xolotlPerf/standard/EventCounter.h"
+#include "xolotlPerf/standard/MemoryTracker.h"
 
 namespace xolotlPerf {
 
@@ -23,6 +24,7 @@ StdHandlerRegistry::~StdHandlerRegistry(void) {
 	allTimers.clear();
 	allEventCounters.clear();
 	allHWCounterSets.clear();
+	allMemoryTrackers.clear();
 }
 
 // We can create the EventCounters, since they don't depend on
@@ -47,6 +49,23 @@ std::shared_ptr<IEventCounter> StdHandlerRegistry::getEventCounter(
 	return ret;
 }
 
+// As the EventCounters, the MemoryTrackers do not depend on our subclasses.
+std::shared_ptr<IMemoryTracker> StdHandlerRegistry::getMemoryTracker(
+		const std::string& name) {
+	std::shared_ptr<IMemoryTracker> ret;
+
+	// Check if we have already created a memory tracker with this name.
+	auto iter = allMemoryTrackers.find(name);
+	if (iter != allMemoryTrackers.end()) {
+		ret = iter->second;
+	} else {
+		// Build one and keep track of it.
+		ret = std::make_shared<MemoryTracker>(name);
+		allMemoryTrackers[name] = ret;
+	}
+	return ret;
+}
+
 template<typename T, typename V>
 void StdHandlerRegistry::CollectAllObjectNames(int myRank,
 		const std::map<std::string, std::shared_ptr<T> >& myObjs,
@@ -306,10 +325,18 @@ void StdHandlerRegistry::AggregateStatistics(int myRank,
 void StdHandlerRegistry::collectStatistics(
 		PerfObjStatsMap<ITimer::ValType>& timerStats,
 		PerfObjStatsMap<IEventCounter::ValType>& counterStats,
-		PerfObjStatsMap<IHardwareCounter::CounterType>& hwCounterStats) {
+		PerfObjStatsMap<IHardwareCounter::CounterType>& hwCounterStats,
+		PerfObjStatsMap<IMemoryTracker::ValType>& memStats) {
 	int myRank;
 	MPI_Comm_rank(MPI_COMM_WORLD, &myRank);
 
+	// Sample the memory of this process, the peak recorded by the
+	// operating system replacing the previous one
+	getMemoryTracker("process:residentSetSize")->sample();
+	auto peakTracker = getMemoryTracker("process:peakResidentSetSize");
+	peakTracker->remove(peakTracker->getCurrentValue());
+	peakTracker->add(MemoryTracker::getPeakResidentSetSize());
+
 	// Aggregate statistics about counters in all processes.
 	// First, timers...
 	AggregateStatistics<ITimer, ITimer::ValType>(myRank, allTimers, timerStats);
@@ -318,15 +345,20 @@ void StdHandlerRegistry::collectStatistics(
 	AggregateStatistics<IEventCounter, IEventCounter::ValType>(myRank,
 			allEventCounters, counterStats);
 
-	// ...finally hardware counters.
+	// ...then hardware counters...
 	AggregateStatistics<IHardwareCounter, IHardwareCounter::CounterType>(myRank,
 			allHWCounterSets, hwCounterStats);
+
+	// ...finally memory trackers.
+	AggregateStatistics<IMemoryTracker, IMemoryTracker::ValType>(myRank,
+			allMemoryTrackers, memStats);
 }
 
 void StdHandlerRegistry::reportStatistics(std::ostream& os,
 		const PerfObjStatsMap<ITimer::ValType>& timerStats,
 		const PerfObjStatsMap<IEventCounter::ValType>& counterStats,
-		const PerfObjStatsMap<IHardwareCounter::CounterType>& hwCounterStats) const {
+		const PerfObjStatsMap<IHardwareCounter::CounterType>& hwCounterStats,
+		const PerfObjStatsMap<IMemoryTracker::ValType>& memStats) const {
 	os << "\nTimers:\n";
 	for (auto iter = timerStats.begin(); iter != timerStats.end(); ++iter) {
 		iter->second.outputTo(os);
@@ -342,6 +374,11 @@ void StdHandlerRegistry::reportStatistics(std::ostream& os,
 			++iter) {
 		iter->second.outputTo(os);
 	}
+
+	os << "\nMemory (peak bytes):\n";
+	for (auto iter = memStats.begin(); iter != memStats.end(); ++iter) {
+		iter->second.outputTo(os);
+	}
 }
 
 } // namespace xolotlPerf
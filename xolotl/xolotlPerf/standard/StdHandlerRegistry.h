@@ -97,6 +97,11 @@ protected:
 	 */
 	std::map<std::string, std::shared_ptr<IHardwareCounter> > allHWCounterSets;
 
+	/**
+	 * Collection of the MemoryTrackers we created, keyed by name.
+	 */
+	std::map<std::string, std::shared_ptr<IMemoryTracker> > allMemoryTrackers;
+
 public:
 
 	/**
@@ -119,18 +124,33 @@ public:
 	std::shared_ptr<IEventCounter> getEventCounter(
 			const std::string& name) override;
 
+	/**
+	 * Look up and return a named memory tracker.
+	 * Create the tracker if it does not already exist.
+	 *
+	 * @param name The object's name.
+	 * @return The object with the given name.
+	 */
+	std::shared_ptr<IMemoryTracker> getMemoryTracker(
+			const std::string& name) override;
+
 	/**
 	 * Collect statistics about any performance data collected by
 	 * processes of the program.
+	 * The resident set size of each process, current and peak, is
+	 * sampled first into the "process:residentSetSize" and
+	 * "process:peakResidentSetSize" memory trackers.
 	 *
 	 * @param timerStats Map of timer statistics, keyed by timer name.
 	 * @param counterStats Map of counter statistics, keyed by counter name.
 	 * @param hwCounterStats Map of hardware counter statistics, keyed by IHardwareCounter name + ':' + hardware counter name.
+	 * @param memStats Map of memory statistics, keyed by memory tracker name.
 	 *
 	 */
 	void collectStatistics(PerfObjStatsMap<ITimer::ValType>& timerStats,
             PerfObjStatsMap<IEventCounter::ValType>& counterStats,
-            PerfObjStatsMap<IHardwareCounter::CounterType>& hwStats) override;
+            PerfObjStatsMap<IHardwareCounter::CounterType>& hwStats,
+            PerfObjStatsMap<IMemoryTracker::ValType>& memStats) override;
 
 	/**
 	 * Report performance data statistics to the given stream.
@@ -139,11 +159,13 @@ public:
 	 * @param timerStats Map of timer statistics, keyed by timer name.
 	 * @param counterStats Map of counter statistics, keyed by counter name.
 	 * @param hwCounterStats Map of hardware counter statistics, keyed by IHardwareCounter name + ':' + hardware counter name.
+	 * @param memStats Map of memory statistics, keyed by memory tracker name.
 	 */
 	void reportStatistics(std::ostream& os,
         const PerfObjStatsMap<ITimer::ValType>& timerStats,
         const PerfObjStatsMap<IEventCounter::ValType>& counterStats,
-        const PerfObjStatsMap<IHardwareCounter::CounterType>& hwStats) const override;
+        const PerfObjStatsMap<IHardwareCounter::CounterType>& hwStats,
+        const PerfObjStatsMap<IMemoryTracker::ValType>& memStats) const override;
 
 };
 
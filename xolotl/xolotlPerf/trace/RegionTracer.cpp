@@ -0,0 +1,139 @@
+#include <iostream>
+#include <memory>
+#include <algorithm>
+#include "xolotlPerf/trace/RegionTracer.h"
+
+namespace xolotlPerf {
+
+static std::unique_ptr<RegionTracer> theRegionTracer;
+
+/**
+ * Escape the characters that are not allowed in a JSON string.
+ */
+static std::string toJSONString(const std::string& str) {
+	std::string ret = "\"";
+	for (auto c : str) {
+		if (c == '"' || c == '\\')
+			ret += '\\';
+		ret += c;
+	}
+	ret += '"';
+	return ret;
+}
+
+RegionTracer::RegionTracer(int _maxEventDepth, std::size_t _maxEvents) :
+		maxEventDepth(_maxEventDepth), maxEvents(_maxEvents), origin(
+				Clock::now()), nDropped(0) {
+}
+
+std::vector<std::string>& RegionTracer::regionNames(void) {
+	static std::vector<std::string> names;
+	return names;
+}
+
+int RegionTracer::getRegionId(const std::string& name) {
+	auto& names = regionNames();
+	auto iter = std::find(names.begin(), names.end(), name);
+	if (iter != names.end())
+		return iter - names.begin();
+
+	names.push_back(name);
+	return names.size() - 1;
+}
+
+const std::string& RegionTracer::getRegionName(int id) {
+	return regionNames().at(id);
+}
+
+void RegionTracer::begin(int id) {
+	openRegions.emplace_back(id, Clock::now());
+}
+
+void RegionTracer::end(void) {
+	// This is called from destructors, the mismatch is only reported
+	if (openRegions.empty()) {
+		std::cerr << "Warning: RegionTracer: attempting to leave a region "
+				"when none is open, ignored." << std::endl;
+		return;
+	}
+
+	auto endTime = Clock::now();
+	auto const& region = openRegions.back();
+	double start = toMicroseconds(region.second);
+	double duration = toMicroseconds(endTime) - start;
+
+	// Add to the total of the time step
+	std::size_t id = region.first;
+	if (id >= stepTotals.size())
+		stepTotals.resize(id + 1, 0.0);
+	stepTotals[id] += duration;
+
+	// Record the event if it is not nested too deep
+	if ((int) openRegions.size() <= maxEventDepth) {
+		if (events.size() < maxEvents)
+			events.push_back(Event { region.first, start, duration });
+		else
+			nDropped++;
+	}
+
+	openRegions.pop_back();
+}
+
+void RegionTracer::sampleTimeStep(int step, double time) {
+	samples.push_back(
+			Sample { step, time, toMicroseconds(Clock::now()), stepTotals });
+	std::fill(stepTotals.begin(), stepTotals.end(), 0.0);
+}
+
+double RegionTracer::getStepTotal(int id) const {
+	if (id < 0 || (std::size_t) id >= stepTotals.size())
+		return 0.0;
+	return stepTotals[id] * 1.0e-6;
+}
+
+void RegionTracer::write(std::ostream& os, int pid) const {
+	os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[" << std::endl;
+
+	// Name the process after its rank
+	os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid
+			<< ",\"args\":{\"name\":\"rank " << pid << "\"}}";
+
+	// The regions
+	for (auto const& event : events) {
+		os << "," << std::endl << "{\"name\":"
+				<< toJSONString(getRegionName(event.id))
+				<< ",\"ph\":\"X\",\"pid\":" << pid << ",\"tid\":0,\"ts\":"
+				<< event.start << ",\"dur\":" << event.duration << "}";
+	}
+
+	// The time steps and the time spent in each region during them
+	for (auto const& sample : samples) {
+		os << "," << std::endl
+				<< "{\"name\":\"timestep\",\"ph\":\"i\",\"s\":\"p\",\"pid\":"
+				<< pid << ",\"tid\":0,\"ts\":" << sample.timestamp
+				<< ",\"args\":{\"step\":" << sample.step << ",\"time\":"
+				<< sample.time << "}}";
+		os << "," << std::endl
+				<< "{\"name\":\"time per step (ms)\",\"ph\":\"C\",\"pid\":"
+				<< pid << ",\"ts\":" << sample.timestamp << ",\"args\":{";
+		for (std::size_t id = 0; id < sample.totals.size(); id++) {
+			if (id > 0)
+				os << ",";
+			os << toJSONString(getRegionName(id)) << ":"
+					<< sample.totals[id] * 1.0e-3;
+		}
+		os << "}}";
+	}
+
+	os << std::endl << "]}" << std::endl;
+}
+
+void enableRegionTracing(int maxEventDepth) {
+	theRegionTracer.reset(new RegionTracer(maxEventDepth));
+}
+
+RegionTracer* getRegionTracer(void) {
+	return theRegionTracer.get();
+}
+
+} // end namespace xolotlPerf
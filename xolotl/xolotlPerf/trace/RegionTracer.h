@@ -0,0 +1,244 @@
+#ifndef REGIONTRACER_H
+#define REGIONTRACER_H
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace xolotlPerf {
+
+/**
+ * A RegionTracer records the nested regions of code executed by one
+ * process, to be opened in a trace viewer (chrome://tracing or Perfetto).
+ *
+ * Each region is identified by an integer obtained once from its name with
+ * getRegionId(). The regions that are not nested deeper than the maximum
+ * event depth are recorded as individual events. All the regions, including
+ * the deeper ones that run once per grid point, add their duration to a
+ * total that is saved and reset at each time step with sampleTimeStep().
+ * These totals appear as counters in the trace.
+ *
+ * A RegionTracer is meant to be used by a single thread.
+ */
+class RegionTracer {
+private:
+
+	/// Concise name for type of our time source.
+	using Clock = std::chrono::steady_clock;
+
+	/// Concise name for type of a timestamp.
+	using Timestamp = std::chrono::time_point<Clock>;
+
+	/**
+	 * A region that was recorded as an individual event.
+	 */
+	struct Event {
+		//! The id of the region.
+		int id;
+
+		//! When it started, in microseconds since the creation of the tracer.
+		double start;
+
+		//! How long it lasted, in microseconds.
+		double duration;
+	};
+
+	/**
+	 * The totals of all the regions over one time step.
+	 */
+	struct Sample {
+		//! The time step number.
+		int step;
+
+		//! The physical time at the end of the time step.
+		double time;
+
+		//! When the sample was taken, in microseconds.
+		double timestamp;
+
+		//! The total duration of each region during the time step, in microseconds.
+		std::vector<double> totals;
+	};
+
+	//! The regions nested deeper than this are not recorded as events.
+	int maxEventDepth;
+
+	//! The maximum number of events kept in memory.
+	std::size_t maxEvents;
+
+	//! The origin of the timestamps.
+	Timestamp origin;
+
+	//! The regions that are currently open, with their start time.
+	std::vector<std::pair<int, Timestamp> > openRegions;
+
+	//! The recorded events.
+	std::vector<Event> events;
+
+	//! The number of events that were not recorded because of maxEvents.
+	std::size_t nDropped;
+
+	//! The total duration of each region since the last sample, in microseconds.
+	std::vector<double> stepTotals;
+
+	//! The samples taken at each time step.
+	std::vector<Sample> samples;
+
+	/**
+	 * Get the number of microseconds since the creation of the tracer.
+	 *
+	 * @param t The timestamp
+	 * @return The number of microseconds
+	 */
+	double toMicroseconds(const Timestamp& t) const {
+		return std::chrono::duration<double, std::micro>(t - origin).count();
+	}
+
+	/**
+	 * Access the names of the regions, shared by all the tracers.
+	 *
+	 * @return The names indexed by region id
+	 */
+	static std::vector<std::string>& regionNames(void);
+
+public:
+
+	/**
+	 * Construct a RegionTracer.
+	 *
+	 * @param _maxEventDepth The regions nested deeper than this are only
+	 * accounted in the per time step totals
+	 * @param _maxEvents The maximum number of events kept in memory
+	 */
+	RegionTracer(int _maxEventDepth = 1, std::size_t _maxEvents = 1000000);
+
+	/**
+	 * Get the id of a region, registering its name the first time.
+	 *
+	 * @param name The name of the region
+	 * @return The id of the region
+	 */
+	static int getRegionId(const std::string& name);
+
+	/**
+	 * Get the name of a region.
+	 *
+	 * @param id The id of the region
+	 * @return The name of the region
+	 */
+	static const std::string& getRegionName(int id);
+
+	/**
+	 * Enter a region, nested in the ones that are currently open.
+	 *
+	 * @param id The id of the region
+	 */
+	void begin(int id);
+
+	/**
+	 * Leave the last region that was entered.
+	 * A warning is printed and nothing is recorded if no region is open.
+	 */
+	void end(void);
+
+	/**
+	 * Save the totals of the regions for a time step and reset them.
+	 *
+	 * @param step The time step number
+	 * @param time The physical time
+	 */
+	void sampleTimeStep(int step, double time);
+
+	/**
+	 * Get the total duration of a region since the last sample.
+	 *
+	 * @param id The id of the region
+	 * @return The duration in seconds
+	 */
+	double getStepTotal(int id) const;
+
+	/**
+	 * Get the number of recorded events.
+	 *
+	 * @return The number of events
+	 */
+	std::size_t getNumberOfEvents(void) const {
+		return events.size();
+	}
+
+	/**
+	 * Get the number of events that were not recorded because there were
+	 * already too many.
+	 *
+	 * @return The number of dropped events
+	 */
+	std::size_t getNumberOfDroppedEvents(void) const {
+		return nDropped;
+	}
+
+	/**
+	 * Get the number of time step samples.
+	 *
+	 * @return The number of samples
+	 */
+	std::size_t getNumberOfSamples(void) const {
+		return samples.size();
+	}
+
+	/**
+	 * Write everything that was recorded in the Chrome trace event format.
+	 *
+	 * @param os The stream to write to
+	 * @param pid The id of the process, the MPI rank
+	 */
+	void write(std::ostream& os, int pid) const;
+};
+
+/**
+ * Start recording the regions of this process.
+ *
+ * @param maxEventDepth The regions nested deeper than this are only
+ * accounted in the per time step totals
+ */
+void enableRegionTracing(int maxEventDepth);
+
+/**
+ * Access the region tracer of this process.
+ *
+ * @return The tracer, or nullptr if enableRegionTracing was not called
+ */
+RegionTracer* getRegionTracer(void);
+
+/**
+ * A class for managing the lifetime of a region by code scope, it does
+ * nothing if the tracing is not enabled.
+ */
+struct ScopedRegion {
+	/// The tracer recording the region.
+	RegionTracer* tracer;
+
+	ScopedRegion(int id) :
+			tracer(getRegionTracer()) {
+		if (tracer)
+			tracer->begin(id);
+	}
+
+	/**
+	 * The tracer is given to avoid looking it up in loops, it can be null.
+	 */
+	ScopedRegion(RegionTracer* _tracer, int id) :
+			tracer(_tracer) {
+		if (tracer)
+			tracer->begin(id);
+	}
+
+	~ScopedRegion(void) {
+		if (tracer)
+			tracer->end();
+	}
+};
+
+} // end namespace xolotlPerf
+
+#endif // REGIONTRACER_H
@@ -60,6 +60,7 @@ std::shared_ptr<IHandlerRegistry> getHandlerRegistry(void) {
 const MPI_Datatype ITimer::MPIValType = MPI_DOUBLE;
 const MPI_Datatype IEventCounter::MPIValType = MPI_UNSIGNED_LONG;
 const MPI_Datatype IHardwareCounter::MPIValType = MPI_LONG_LONG_INT;
+const MPI_Datatype IMemoryTracker::MPIValType = MPI_UNSIGNED_LONG;
 
 } // end namespace xolotlPerf
 
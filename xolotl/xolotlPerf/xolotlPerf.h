@@ -6,6 +6,7 @@
 #include "IHandlerRegistry.h"
 #include "ITimer.h"
 #include "RuntimeError.h"
+#include "trace/RegionTracer.h"
 
 namespace xolotlPerf {
 
@@ -81,6 +82,25 @@ struct ScopedTimer {
     }
 };
 
+/**
+ * A class for sampling the resident set size of the process when a scope
+ * is entered and left, the tracker keeping the peak of these samples.
+ */
+struct ScopedMemorySample {
+    /// The tracker sampled in the struct's scope.
+    std::shared_ptr<IMemoryTracker> tracker;
+
+    ScopedMemorySample(std::shared_ptr<IMemoryTracker> _tracker)
+      : tracker(_tracker) {
+
+          tracker->sample();
+    }
+
+    ~ScopedMemorySample(void) {
+        tracker->sample();
+    }
+};
+
 } // end namespace xolotlPerf
 
 #endif // XOLOTLPERF_H
@@ -1,5 +1,6 @@
 // Includes
 #include <cassert>
+#include <array>
 #include <PetscSolver.h>
 #include <fstream>
 #include <iostream>
@@ -32,6 +33,29 @@ std::shared_ptr<xolotlPerf::ITimer> RHSFunctionTimer;
 ////Timer for RHSJacobian()
 std::shared_ptr<xolotlPerf::ITimer> RHSJacobianTimer;
 
+//! Timer for the ghost exchanges of RHSFunction() and RHSJacobian()
+std::shared_ptr<xolotlPerf::ITimer> ghostExchangeTimer;
+
+//! Timer for the local computation of RHSFunction()
+std::shared_ptr<xolotlPerf::ITimer> RHSComputeTimer;
+
+//! Timer for the computation and assembly of the Jacobian
+std::shared_ptr<xolotlPerf::ITimer> JacobianAssemblyTimer;
+
+//! The memory of the Jacobian matrix, accounted again when it is re-created
+static std::shared_ptr<xolotlPerf::IMemoryTracker> matrixMemory;
+//! The id of the matrix accounted in matrixMemory, 0 if none
+static PetscObjectId trackedMatrixId = 0;
+
+//! The profiling regions of RHSFunction() and RHSJacobian()
+static const int rhsRegion = xolotlPerf::RegionTracer::getRegionId("RHS");
+static const int jacobianRegion = xolotlPerf::RegionTracer::getRegionId(
+		"Jacobian");
+static const int offDiagonalRegion = xolotlPerf::RegionTracer::getRegionId(
+		"Jacobian:offDiagonal");
+static const int diagonalRegion = xolotlPerf::RegionTracer::getRegionId(
+		"Jacobian:diagonal");
+
 //! Help message
 static char help[] =
 		"Solves C_t =  -D*C_xx + A*C_x + F(C) + R(C) + D(C) from Brian Wirth's SciDAC project.\n";
@@ -41,6 +65,16 @@ extern PetscErrorCode setupPetsc0DMonitor(TS);
 extern PetscErrorCode setupPetsc1DMonitor(TS, std::shared_ptr<xolotlPerf::IHandlerRegistry>);
 extern PetscErrorCode setupPetsc2DMonitor(TS);
 extern PetscErrorCode setupPetsc3DMonitor(TS);
+extern PetscErrorCode setupBlockPreconditioner(TS, int,
+		std::shared_ptr<xolotlPerf::IHandlerRegistry>);
+extern PetscErrorCode setupImbalanceStart(TS);
+extern PetscErrorCode setupImbalanceReport(TS, int,
+		std::shared_ptr<xolotlPerf::IHandlerRegistry>);
+extern PetscErrorCode setupPruning(TS);
+extern PetscErrorCode setupHeatSplit(TS);
+extern PetscErrorCode destroyHeatSplit();
+extern PetscErrorCode monitorMemory(TS, PetscInt, PetscReal, Vec, void *);
+extern PetscErrorCode reportDryRun(TS, Vec);
 
 void PetscSolver::setupInitialConditions(DM da, Vec C) {
 	// Initialize the concentrations in the solution vector
@@ -70,6 +104,7 @@ void PetscSolver::setupInitialConditions(DM da, Vec C) {
 PetscErrorCode RHSFunction(TS ts, PetscReal ftime, Vec C, Vec F, void *) {
 	// Start the RHSFunction Timer
 	RHSFunctionTimer->start();
+	xolotlPerf::ScopedRegion region(rhsRegion);
 
 	PetscErrorCode ierr;
 
@@ -86,10 +121,12 @@ PetscErrorCode RHSFunction(TS ts, PetscReal ftime, Vec C, Vec F, void *) {
 	// DMGlobalToLocalBegin(),DMGlobalToLocalEnd().
 	// By placing code between these two statements, computations can be
 	// done while messages are in transition.
+	ghostExchangeTimer->start();
 	ierr = DMGlobalToLocalBegin(da, C, INSERT_VALUES, localC);
 	CHKERRQ(ierr);
 	ierr = DMGlobalToLocalEnd(da, C, INSERT_VALUES, localC);
 	CHKERRQ(ierr);
+	ghostExchangeTimer->stop();
 
 	// Set the initial values of F
 	ierr = VecSet(F, 0.0);
@@ -97,7 +134,9 @@ PetscErrorCode RHSFunction(TS ts, PetscReal ftime, Vec C, Vec F, void *) {
 
 	// Compute the new concentrations
 	auto& solverHandler = Solver::getSolverHandler();
+	RHSComputeTimer->start();
 	solverHandler.updateConcentration(ts, localC, F, ftime);
+	RHSComputeTimer->stop();
 
 	// Stop the RHSFunction Timer
 	RHSFunctionTimer->stop();
@@ -114,6 +153,8 @@ PetscErrorCode RHSJacobian(TS ts, PetscReal ftime, Vec C, Mat A, Mat J,
 		void *) {
 	// Start the RHSJacobian timer
 	RHSJacobianTimer->start();
+	auto tracer = xolotlPerf::getRegionTracer();
+	xolotlPerf::ScopedRegion region(tracer, jacobianRegion);
 
 	PetscErrorCode ierr;
 
@@ -129,29 +170,38 @@ PetscErrorCode RHSJacobian(TS ts, PetscReal ftime, Vec C, Mat A, Mat J,
 	CHKERRQ(ierr);
 
 	// Get the complete data array
+	ghostExchangeTimer->start();
 	ierr = DMGlobalToLocalBegin(da, C, INSERT_VALUES, localC);
 	CHKERRQ(ierr);
 	ierr = DMGlobalToLocalEnd(da, C, INSERT_VALUES, localC);
 	CHKERRQ(ierr);
+	ghostExchangeTimer->stop();
 
 	// Get the solver handler
 	auto& solverHandler = Solver::getSolverHandler();
+	JacobianAssemblyTimer->start();
 
 	/* ----- Compute the off-diagonal part of the Jacobian ----- */
-	solverHandler.computeOffDiagonalJacobian(ts, localC, J, ftime);
+	{
+		xolotlPerf::ScopedRegion offDiagonal(tracer, offDiagonalRegion);
+		solverHandler.computeOffDiagonalJacobian(ts, localC, J, ftime);
 
-	ierr = MatAssemblyBegin(J, MAT_FINAL_ASSEMBLY);
-	CHKERRQ(ierr);
-	ierr = MatAssemblyEnd(J, MAT_FINAL_ASSEMBLY);
-	CHKERRQ(ierr);
+		ierr = MatAssemblyBegin(J, MAT_FINAL_ASSEMBLY);
+		CHKERRQ(ierr);
+		ierr = MatAssemblyEnd(J, MAT_FINAL_ASSEMBLY);
+		CHKERRQ(ierr);
+	}
 
 	/* ----- Compute the partial derivatives for the reaction term ----- */
-	solverHandler.computeDiagonalJacobian(ts, localC, J, ftime);
+	{
+		xolotlPerf::ScopedRegion diagonal(tracer, diagonalRegion);
+		solverHandler.computeDiagonalJacobian(ts, localC, J, ftime);
 
-	ierr = MatAssemblyBegin(J, MAT_FINAL_ASSEMBLY);
-	CHKERRQ(ierr);
-	ierr = MatAssemblyEnd(J, MAT_FINAL_ASSEMBLY);
-	CHKERRQ(ierr);
+		ierr = MatAssemblyBegin(J, MAT_FINAL_ASSEMBLY);
+		CHKERRQ(ierr);
+		ierr = MatAssemblyEnd(J, MAT_FINAL_ASSEMBLY);
+		CHKERRQ(ierr);
+	}
 
 	if (A != J) {
 		ierr = MatAssemblyBegin(A, MAT_FINAL_ASSEMBLY);
@@ -159,6 +209,20 @@ PetscErrorCode RHSJacobian(TS ts, PetscReal ftime, Vec C, Mat A, Mat J,
 		ierr = MatAssemblyEnd(A, MAT_FINAL_ASSEMBLY);
 		CHKERRQ(ierr);
 	}
+	JacobianAssemblyTimer->stop();
+
+	// The matrix is allocated by now, account for it if it is a new one
+	PetscObjectId matrixId;
+	ierr = PetscObjectGetId((PetscObject) J, &matrixId);
+	CHKERRQ(ierr);
+	if (matrixId != trackedMatrixId) {
+		MatInfo matInfo;
+		ierr = MatGetInfo(J, MAT_LOCAL, &matInfo);
+		CHKERRQ(ierr);
+		matrixMemory->remove(matrixMemory->getCurrentValue());
+		matrixMemory->add((xolotlPerf::IMemoryTracker::ValType) matInfo.memory);
+		trackedMatrixId = matrixId;
+	}
 
 //	ierr = MatView(J, PETSC_VIEWER_STDOUT_WORLD);
 
@@ -173,6 +237,10 @@ PetscSolver::PetscSolver(ISolverHandler& _solverHandler,
 		Solver(_solverHandler, registry) {
 	RHSFunctionTimer = handlerRegistry->getTimer("RHSFunctionTimer");
 	RHSJacobianTimer = handlerRegistry->getTimer("RHSJacobianTimer");
+	ghostExchangeTimer = handlerRegistry->getTimer("ghostExchange");
+	RHSComputeTimer = handlerRegistry->getTimer("RHSCompute");
+	JacobianAssemblyTimer = handlerRegistry->getTimer("JacobianAssembly");
+	matrixMemory = handlerRegistry->getMemoryTracker("petsc:Mat");
 }
 
 PetscSolver::~PetscSolver() {
@@ -196,6 +264,15 @@ void PetscSolver::initialize() {
 void PetscSolver::solve() {
 	PetscErrorCode ierr;
 
+	// Check the option -split_heat, the heat equation is then solved on its
+	// own and the temperature is frozen during each time step of the clusters
+	PetscBool flagHeatSplit;
+	ierr = PetscOptionsHasName(NULL, NULL, "-split_heat", &flagHeatSplit);
+	checkPetscError(ierr,
+			"PetscSolver::solve: PetscOptionsHasName (-split_heat) failed.");
+	auto temperatureHandler = getSolverHandler().getTemperatureHandler();
+	temperatureHandler->setOperatorSplit(flagHeatSplit);
+
 	// Create the solver context
 	DM da;
 	getSolverHandler().createSolverContext(da);
@@ -237,14 +314,21 @@ void PetscSolver::solve() {
 	auto fileName = getSolverHandler().getNetworkName();
 	double time = 0.0, deltaTime = 1.0e-12;
 	if (!fileName.empty()) {
-
-        XFile xfile(fileName);
-        auto concGroup = xfile.getGroup<XFile::ConcentrationGroup>();
-        if(concGroup and concGroup->hasTimesteps()) {
-            auto tsGroup = concGroup->getLastTimestepGroup();
-            assert(tsGroup);
-            std::tie(time, deltaTime) = tsGroup->readTimes();
-        }
+		// Only the master process opens the file
+		int procId;
+		MPI_Comm_rank(PETSC_COMM_WORLD, &procId);
+		std::array<double, 2> times = { time, deltaTime };
+		if (procId == 0) {
+			XFile xfile(fileName, MPI_COMM_SELF);
+			auto concGroup = xfile.getGroup<XFile::ConcentrationGroup>();
+			if (concGroup and concGroup->hasTimesteps()) {
+				auto tsGroup = concGroup->getLastTimestepGroup();
+				assert(tsGroup);
+				std::tie(times[0], times[1]) = tsGroup->readTimes();
+			}
+		}
+		MPI_Bcast(times.data(), 2, MPI_DOUBLE, 0, PETSC_COMM_WORLD);
+		time = times[0], deltaTime = times[1];
 	}
 
 	ierr = TSSetTime(ts, time);
@@ -254,36 +338,130 @@ void PetscSolver::solve() {
 	ierr = TSSetFromOptions(ts);
 	checkPetscError(ierr, "PetscSolver::solve: TSSetFromOptions failed.");
 
-	// Switch on the number of dimensions to set the monitors
+	// Use the reaction block-Jacobi preconditioner if it was asked for
+	ierr = setupBlockPreconditioner(ts,
+			getSolverHandler().getNetwork().getDOF(), handlerRegistry);
+	checkPetscError(ierr,
+			"PetscSolver::solve: setupBlockPreconditioner failed.");
+
+	// Check the option -imbalance_report
+	PetscBool flagImbalance;
+	ierr = PetscOptionsHasName(NULL, NULL, "-imbalance_report", &flagImbalance);
+	checkPetscError(ierr,
+			"PetscSolver::solve: PetscOptionsHasName (-imbalance_report) failed.");
+	// The imbalance report times the other monitors, it has to be set first
+	if (flagImbalance) {
+		ierr = setupImbalanceStart(ts);
+		checkPetscError(ierr, "PetscSolver::solve: setupImbalanceStart failed.");
+	}
+
+	// The temperature has to be advanced before the other monitors use it
+	if (temperatureHandler->isOperatorSplit()) {
+		ierr = setupHeatSplit(ts);
+		checkPetscError(ierr, "PetscSolver::solve: setupHeatSplit failed.");
+	}
+
+	// Only the statistics of the problem are written in a dry run, without
+	// the monitors that would empty the output files of a previous run
+	PetscBool flagDryRun;
+	ierr = PetscOptionsHasName(NULL, NULL, "-dry_run", &flagDryRun);
+	checkPetscError(ierr,
+			"PetscSolver::solve: PetscOptionsHasName (-dry_run) failed.");
+
 	int dim = getSolverHandler().getDimension();
-	switch (dim) {
-	case 0:
-		// One dimension
-		ierr = setupPetsc0DMonitor(ts);
-		checkPetscError(ierr,
-				"PetscSolver::solve: setupPetsc0DMonitor failed.");
-		break;
-	case 1:
-		// One dimension
-		ierr = setupPetsc1DMonitor(ts, handlerRegistry);
-		checkPetscError(ierr,
-				"PetscSolver::solve: setupPetsc1DMonitor failed.");
-		break;
-	case 2:
-		// Two dimensions
-		ierr = setupPetsc2DMonitor(ts);
-		checkPetscError(ierr,
-				"PetscSolver::solve: setupPetsc2DMonitor failed.");
-		break;
-	case 3:
-		// Three dimensions
-		ierr = setupPetsc3DMonitor(ts);
+	if (!flagDryRun) {
+		// Switch on the number of dimensions to set the monitors
+		switch (dim) {
+		case 0:
+			// One dimension
+			ierr = setupPetsc0DMonitor(ts);
+			checkPetscError(ierr,
+					"PetscSolver::solve: setupPetsc0DMonitor failed.");
+			break;
+		case 1:
+			// One dimension
+			ierr = setupPetsc1DMonitor(ts, handlerRegistry);
+			checkPetscError(ierr,
+					"PetscSolver::solve: setupPetsc1DMonitor failed.");
+			break;
+		case 2:
+			// Two dimensions
+			ierr = setupPetsc2DMonitor(ts);
+			checkPetscError(ierr,
+					"PetscSolver::solve: setupPetsc2DMonitor failed.");
+			break;
+		case 3:
+			// Three dimensions
+			ierr = setupPetsc3DMonitor(ts);
+			checkPetscError(ierr,
+					"PetscSolver::solve: setupPetsc3DMonitor failed.");
+			break;
+		default:
+			throw std::string("PetscSolver Exception: Wrong number of dimensions "
+					"to set the monitors.");
+		}
+	}
+
+	// Store the coefficients of the reactions once per node if it was
+	// asked for, before any pruning reorders them
+	PetscBool flagShare;
+	ierr = PetscOptionsHasName(NULL, NULL, "-share_network", &flagShare);
+	checkPetscError(ierr,
+			"PetscSolver::solve: PetscOptionsHasName (-share_network) failed.");
+	if (flagShare) {
+		unsigned long long nShared =
+				getSolverHandler().getNetwork().shareCoefficients(
+						PETSC_COMM_WORLD);
+		unsigned long long nTotal = 0;
+		MPI_Reduce(&nShared, &nTotal, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, 0,
+				PETSC_COMM_WORLD);
+		int procId;
+		MPI_Comm_rank(PETSC_COMM_WORLD, &procId);
+		if (procId == 0) {
+			std::cout << "Shared network: "
+					<< (double) (nTotal * sizeof(double)) / 1.0e6
+					<< " MB of reaction coefficients are no longer duplicated."
+					<< std::endl;
+		}
+	}
+
+	// Prune the negligible dissociations if it was asked for
+	ierr = setupPruning(ts);
+	checkPetscError(ierr, "PetscSolver::solve: setupPruning failed.");
+
+	// Account for the memory of the network, of the partial derivatives
+	// of the reactions and of the solution vector on this process,
+	// replacing the values of a previous solve
+	auto setTracker = [this](const std::string& name, std::size_t nBytes) {
+		auto tracker = handlerRegistry->getMemoryTracker(name);
+		tracker->remove(tracker->getCurrentValue());
+		tracker->add(nBytes);
+	};
+	auto& network = getSolverHandler().getNetwork();
+	network.trackMemory();
+	std::vector<int> partialsSizes(network.getDOF());
+	std::vector<size_t> partialsStartingIdx(network.getDOF());
+	auto nPartials = network.initPartialsSizes(partialsSizes,
+			partialsStartingIdx);
+	setTracker("network:partials",
+			nPartials * (sizeof(PetscInt) + sizeof(PetscScalar))
+					+ partialsSizes.size()
+							* (sizeof(PetscInt) + sizeof(size_t)));
+	PetscInt localSize;
+	ierr = VecGetLocalSize(C, &localSize);
+	checkPetscError(ierr, "PetscSolver::solve: VecGetLocalSize failed.");
+	setTracker("petsc:Vec", localSize * sizeof(PetscScalar));
+
+	// Sample the resident set size once per time step
+	ierr = TSMonitorSet(ts, monitorMemory, NULL, NULL);
+	checkPetscError(ierr,
+			"PetscSolver::solve: TSMonitorSet (monitorMemory) failed.");
+
+	// And last
+	if (flagImbalance) {
+		ierr = setupImbalanceReport(ts, dim, handlerRegistry);
 		checkPetscError(ierr,
-				"PetscSolver::solve: setupPetsc3DMonitor failed.");
-		break;
-	default:
-		throw std::string("PetscSolver Exception: Wrong number of dimensions "
-				"to set the monitors.");
+				"PetscSolver::solve: setupImbalanceReport failed.");
 	}
 
 	/* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -297,10 +475,38 @@ void PetscSolver::solve() {
 	/* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 	 Solve the ODE system
 	 - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
-	if (ts != NULL && C != NULL) {
+	if (ts != NULL && C != NULL && flagDryRun) {
+		// Report the statistics and the cost of the problem instead
+		ierr = reportDryRun(ts, C);
+		checkPetscError(ierr, "PetscSolver::solve: reportDryRun failed.");
+	} else if (ts != NULL && C != NULL) {
+		// Check the option -trace
+		PetscBool flagTrace;
+		ierr = PetscOptionsHasName(NULL, NULL, "-trace", &flagTrace);
+		checkPetscError(ierr,
+				"PetscSolver::solve: PetscOptionsHasName (-trace) failed.");
+		if (flagTrace) {
+			// Only the regions up to this depth are recorded as events
+			PetscInt traceDepth = 1;
+			ierr = PetscOptionsGetInt(NULL, NULL, "-trace_depth", &traceDepth,
+			NULL);
+			checkPetscError(ierr,
+					"PetscSolver::solve: PetscOptionsGetInt (-trace_depth) failed.");
+			xolotlPerf::enableRegionTracing(traceDepth);
+		}
+
 		ierr = TSSolve(ts, C);
 		checkPetscError(ierr, "PetscSolver::solve: TSSolve failed.");
 
+		// Write the trace of this process
+		if (auto tracer = xolotlPerf::getRegionTracer()) {
+			int procId;
+			MPI_Comm_rank(PETSC_COMM_WORLD, &procId);
+			std::ofstream traceFile(
+					"xolotlTrace_" + std::to_string(procId) + ".json");
+			tracer->write(traceFile, procId);
+		}
+
 		/* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 		 Write in a file if everything went well or not.
 		 - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
@@ -339,6 +545,10 @@ void PetscSolver::solve() {
 	/* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 	 Free work space.
 	 - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+	if (temperatureHandler->isOperatorSplit()) {
+		ierr = destroyHeatSplit();
+		checkPetscError(ierr, "PetscSolver::solve: destroyHeatSplit failed.");
+	}
 	ierr = VecDestroy(&C);
 	checkPetscError(ierr, "PetscSolver::solve: VecDestroy failed.");
 	ierr = TSDestroy(&ts);
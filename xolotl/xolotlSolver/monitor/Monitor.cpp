@@ -25,10 +25,31 @@ double previousTime = 0.0;
 //! The variable to store the threshold on time step defined by the user.
 double timeStepThreshold = 0.0;
 
+//! The number of checkpoints between two full ones.
+static PetscInt checkpointKeyframe = 1;
+//! The relative change under which a concentration is not saved again.
+static PetscReal checkpointDeltaTol = 1.0e-6;
+//! The number of checkpoints written so far.
+static int nCheckpoints = 0;
+//! The time step of the last checkpoint.
+static int lastCheckpointStep = -1;
+//! The concentrations of the points we own as they are in the checkpoint file.
+static xolotlCore::XFile::TimestepGroup::Concs1DType savedConcs;
+
+/**
+ * Set the memory of savedConcs, it is kept between the checkpoints.
+ */
+static void trackSavedConcs();
+
+// Declaration of the post step of the heat equation in MonitorHeat.cpp
+extern PetscErrorCode advanceHeatSplit(TS ts);
+
 #undef __FUNCT__
 #define __FUNCT__ Actual__FUNCT__("xolotlSolver", "checkTimeStep")
 /**
- * This is a method that decides when to extend the network
+ * This is a method that decides when to extend the network. It is the only
+ * post step so it also advances the heat equation when it is solved on
+ * its own.
  */
 PetscErrorCode checkTimeStep(TS ts) {
 	// Initial declarations
@@ -36,6 +57,13 @@ PetscErrorCode checkTimeStep(TS ts) {
 
 	PetscFunctionBeginUser;
 
+	// Advance the heat equation
+	auto& solverHandler = PetscSolver::getSolverHandler();
+	if (solverHandler.getTemperatureHandler()->isOperatorSplit()) {
+		ierr = advanceHeatSplit(ts);
+		CHKERRQ(ierr);
+	}
+
 	// Get the time step from ts
 	PetscReal timestep;
 	ierr = TSGetTimeStep(ts, &timestep);
@@ -57,12 +85,32 @@ PetscErrorCode checkTimeStep(TS ts) {
  * because multiple monitors need the previous time value from the previous timestep.
  * This monitor must be called last when needed.
  */
-PetscErrorCode monitorTime(TS, PetscInt, PetscReal time, Vec, void *) {
+PetscErrorCode monitorTime(TS, PetscInt timestep, PetscReal time, Vec,
+		void *) {
 	PetscFunctionBeginUser;
 
 	// Set the previous time to the current time for the next timestep
 	previousTime = time;
 
+	// Close the time step in the trace
+	if (auto tracer = xolotlPerf::getRegionTracer())
+		tracer->sampleTimeStep(timestep, time);
+
+	PetscFunctionReturn(0);
+}
+
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "monitorMemory")
+/**
+ * This is a monitoring method that samples the resident set size of the
+ * process after each time step, the peak is reported with the timers.
+ */
+PetscErrorCode monitorMemory(TS, PetscInt, PetscReal, Vec, void *) {
+	PetscFunctionBeginUser;
+
+	xolotlPerf::getHandlerRegistry()->getMemoryTracker(
+			"timeStep:residentSetSize")->sample();
+
 	PetscFunctionReturn(0);
 }
 
@@ -234,5 +282,180 @@ void writeNetwork(MPI_Comm _comm, std::string srcFileName,
 	}
 }
 
+void setupIncrementalCheckpoints() {
+	PetscErrorCode ierr;
+
+	ierr = PetscOptionsGetInt(NULL, NULL, "-checkpoint_keyframe",
+			&checkpointKeyframe, NULL);
+	checkPetscError(ierr, "setupIncrementalCheckpoints: "
+			"PetscOptionsGetInt (-checkpoint_keyframe) failed.");
+	if (checkpointKeyframe < 1)
+		checkpointKeyframe = 1;
+	ierr = PetscOptionsGetReal(NULL, NULL, "-checkpoint_delta_tol",
+			&checkpointDeltaTol, NULL);
+	checkPetscError(ierr, "setupIncrementalCheckpoints: "
+			"PetscOptionsGetReal (-checkpoint_delta_tol) failed.");
+
+	// The first checkpoint is always a full one
+	nCheckpoints = 0;
+	lastCheckpointStep = -1;
+	savedConcs.clear();
+	trackSavedConcs();
+}
+
+std::unique_ptr<xolotlCore::TimeSeries> createTimeSeries(
+		const std::string& baseName, const std::vector<std::string>& columns) {
+	// Only the master process writes
+	int procId;
+	MPI_Comm_rank(PETSC_COMM_WORLD, &procId);
+	if (procId != 0)
+		return nullptr;
+
+	PetscErrorCode ierr;
+
+	auto format = xolotlCore::TimeSeries::Format::Text;
+	char formatName[PETSC_MAX_PATH_LEN];
+	PetscBool flagFormat;
+	ierr = PetscOptionsGetString(NULL, NULL, "-timeseries_format", formatName,
+			sizeof(formatName), &flagFormat);
+	checkPetscError(ierr, "createTimeSeries: "
+			"PetscOptionsGetString (-timeseries_format) failed.");
+	if (flagFormat)
+		format = xolotlCore::TimeSeries::toFormat(formatName);
+
+	PetscInt flushInterval = 100;
+	ierr = PetscOptionsGetInt(NULL, NULL, "-timeseries_flush", &flushInterval,
+			NULL);
+	checkPetscError(ierr, "createTimeSeries: "
+			"PetscOptionsGetInt (-timeseries_flush) failed.");
+	if (flushInterval < 1)
+		flushInterval = 1;
+
+	// The rows kept in memory
+	auto memoryTracker = xolotlPerf::getHandlerRegistry()->getMemoryTracker(
+			"io:timeSeriesBuffers");
+	memoryTracker->add(flushInterval * columns.size() * sizeof(double));
+
+	return std::unique_ptr<xolotlCore::TimeSeries>(
+			new xolotlCore::TimeSeries(baseName, columns, format,
+					flushInterval));
+}
+
+/**
+ * Decide if this checkpoint is a full one and, if it is not, compute the
+ * changes to save. It keeps the concentrations as they will be
+ * reconstructed from the file.
+ *
+ * @param concs Concentrations associated with the grid points we own.
+ * @param deltaConcs The changes to save.
+ * @return True if only the changes have to be saved
+ */
+static bool computeCheckpointDelta(
+		const xolotlCore::XFile::TimestepGroup::Concs1DType& concs,
+		xolotlCore::XFile::TimestepGroup::Concs1DType& deltaConcs) {
+
+	// Every process has to take the same decision
+	int needKeyframe = (nCheckpoints % checkpointKeyframe == 0
+			or savedConcs.size() != concs.size()) ? 1 : 0;
+	MPI_Allreduce(MPI_IN_PLACE, &needKeyframe, 1, MPI_INT, MPI_MAX,
+			PETSC_COMM_WORLD);
+	nCheckpoints++;
+
+	if (needKeyframe) {
+		// Nothing to keep if all the checkpoints are full ones
+		if (checkpointKeyframe > 1) {
+			savedConcs = concs;
+			trackSavedConcs();
+		}
+		return false;
+	}
+
+	deltaConcs.resize(concs.size());
+	for (std::size_t i = 0; i < concs.size(); ++i) {
+		deltaConcs[i] = xolotlCore::XFile::TimestepGroup::computeDelta(
+				savedConcs[i], concs[i], checkpointDeltaTol);
+		xolotlCore::XFile::TimestepGroup::applyDelta(savedConcs[i],
+				deltaConcs[i]);
+	}
+	trackSavedConcs();
+	return true;
+}
+
+/**
+ * Get the number of bytes of the concentrations of a checkpoint.
+ *
+ * @param concs The concentrations
+ * @return The number of bytes
+ */
+static std::size_t getConcsBytes(
+		const xolotlCore::XFile::TimestepGroup::Concs1DType& concs) {
+	std::size_t nBytes = concs.capacity() * sizeof(concs[0]);
+	for (auto const& pointConcs : concs)
+		nBytes += pointConcs.capacity()
+				* sizeof(xolotlCore::XFile::TimestepGroup::ConcType);
+	return nBytes;
+}
+
+static void trackSavedConcs() {
+	auto memoryTracker = xolotlPerf::getHandlerRegistry()->getMemoryTracker(
+			"hdf5:savedCheckpoint");
+	memoryTracker->remove(memoryTracker->getCurrentValue());
+	memoryTracker->add(getConcsBytes(savedConcs));
+}
+
+void writeCheckpointConcentrations(const xolotlCore::XFile& checkpointFile,
+		const xolotlCore::XFile::TimestepGroup& tsGroup, int timeStep,
+		int baseX, const xolotlCore::XFile::TimestepGroup::Concs1DType& concs) {
+
+	xolotlCore::XFile::TimestepGroup::Concs1DType deltaConcs;
+	bool isDelta = computeCheckpointDelta(concs, deltaConcs);
+
+	// Account for the buffers while the checkpoint is written
+	auto memoryTracker = xolotlPerf::getHandlerRegistry()->getMemoryTracker(
+			"hdf5:checkpointBuffers");
+	auto nBytes = getConcsBytes(concs) + getConcsBytes(deltaConcs);
+	memoryTracker->add(nBytes);
+
+	if (isDelta)
+		tsGroup.writeDeltaConcentrations(checkpointFile, baseX, deltaConcs,
+				lastCheckpointStep);
+	else
+		tsGroup.writeConcentrations(checkpointFile, baseX, concs);
+	lastCheckpointStep = timeStep;
+
+	memoryTracker->remove(nBytes);
+
+	// The time series are written up to the checkpoint
+	xolotlCore::TimeSeries::flushAll();
+}
+
+void writeCheckpointConcentrations(const xolotlCore::XFile& checkpointFile,
+		const xolotlCore::XFile::TimestepGroup& tsGroup, int timeStep,
+		int nPoints, const std::vector<int>& gridPoints,
+		const xolotlCore::XFile::TimestepGroup::Concs1DType& concs) {
+
+	xolotlCore::XFile::TimestepGroup::Concs1DType deltaConcs;
+	bool isDelta = computeCheckpointDelta(concs, deltaConcs);
+
+	// Account for the buffers while the checkpoint is written
+	auto memoryTracker = xolotlPerf::getHandlerRegistry()->getMemoryTracker(
+			"hdf5:checkpointBuffers");
+	auto nBytes = getConcsBytes(concs) + getConcsBytes(deltaConcs);
+	memoryTracker->add(nBytes);
+
+	if (isDelta)
+		tsGroup.writeDeltaConcentrations(checkpointFile, nPoints, gridPoints,
+				deltaConcs, lastCheckpointStep);
+	else
+		tsGroup.writeConcentrations(checkpointFile, nPoints, gridPoints,
+				concs);
+	lastCheckpointStep = timeStep;
+
+	memoryTracker->remove(nBytes);
+
+	// The time series are written up to the checkpoint
+	xolotlCore::TimeSeries::flushAll();
+}
+
 }
 /* end namespace xolotlSolver */
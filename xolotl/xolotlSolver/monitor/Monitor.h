@@ -3,6 +3,9 @@
 
 // Includes
 #include <IReactionNetwork.h>
+#include <memory>
+#include "xolotlCore/io/XFile.h"
+#include "xolotlCore/io/TimeSeries.h"
 
 namespace xolotlSolver {
 
@@ -22,6 +25,60 @@ namespace xolotlSolver {
 void writeNetwork(MPI_Comm _comm, std::string srcFileName,
 		std::string targetFileName, IReactionNetwork& network);
 
+/**
+ * Read the options of the incremental checkpoints.  Every
+ * -checkpoint_keyframe checkpoints (1 by default) the concentrations are
+ * saved in full, the checkpoints in between only save the ones that
+ * changed by more than the relative tolerance -checkpoint_delta_tol
+ * (1.0e-6 by default) since the previous checkpoint.
+ */
+void setupIncrementalCheckpoints();
+
+/**
+ * Save the concentrations of the grid points we own in a 1D problem,
+ * in full or as changes from the previous checkpoint, and flush the time
+ * series.
+ *
+ * @param checkpointFile The checkpoint file.
+ * @param tsGroup The time step group of the checkpoint.
+ * @param timeStep The time step of the checkpoint.
+ * @param baseX Index of first grid point we own.
+ * @param concs Concentrations associated with the grid points we own.
+ */
+void writeCheckpointConcentrations(const xolotlCore::XFile& checkpointFile,
+		const xolotlCore::XFile::TimestepGroup& tsGroup, int timeStep,
+		int baseX, const xolotlCore::XFile::TimestepGroup::Concs1DType& concs);
+
+/**
+ * Save the concentrations of the grid points we own in a 2D or 3D problem,
+ * in full or as changes from the previous checkpoint, and flush the time
+ * series.
+ *
+ * @param checkpointFile The checkpoint file.
+ * @param tsGroup The time step group of the checkpoint.
+ * @param timeStep The time step of the checkpoint.
+ * @param nPoints The total number of grid points.
+ * @param gridPoints The linear indices of the points we own.
+ * @param concs Concentrations associated with the points we own.
+ */
+void writeCheckpointConcentrations(const xolotlCore::XFile& checkpointFile,
+		const xolotlCore::XFile::TimestepGroup& tsGroup, int timeStep,
+		int nPoints, const std::vector<int>& gridPoints,
+		const xolotlCore::XFile::TimestepGroup::Concs1DType& concs);
+
+/**
+ * Create a time series written by the master process, in the format given
+ * by the option -timeseries_format (text by default, or hdf5) and flushed
+ * every -timeseries_flush rows (100 by default) and at each checkpoint. If
+ * the run crashes, the rows since the last flush are lost.
+ *
+ * @param baseName The name of the file without its extension.
+ * @param columns The names of the columns.
+ * @return The time series on the master process, nullptr on the others.
+ */
+std::unique_ptr<xolotlCore::TimeSeries> createTimeSeries(
+		const std::string& baseName, const std::vector<std::string>& columns);
+
 } // namespace xolotlSolver
 
 #endif // XSOLVER_MONITOR_H
@@ -48,6 +48,8 @@ PetscReal hdf5Stride0D = 0.0;
 PetscInt hdf5Previous0D = 0;
 //! HDF5 output file name
 std::string hdf5OutputName0D = "xolotlStop.h5";
+//! The name of the file where the results of an ensemble run are written
+std::string ensembleOutputName0D = "ensemble.txt";
 
 #undef __FUNCT__
 #define __FUNCT__ Actual__FUNCT__("xolotlSolver", "startStop0D")
@@ -56,6 +58,11 @@ std::string hdf5OutputName0D = "xolotlStop.h5";
  */
 PetscErrorCode startStop0D(TS ts, PetscInt timestep, PetscReal time,
 		Vec solution, void *) {
+	// Time the checkpoint
+	static auto startStopTimer = xolotlPerf::getHandlerRegistry()->getTimer(
+			"monitor0D:startStop");
+	xolotlPerf::ScopedTimer myTimer(startStopTimer);
+
 	// Initial declaration
 	PetscErrorCode ierr;
 	const double **solutionArray, *gridPointSolution;
@@ -331,6 +338,94 @@ PetscErrorCode monitorBubble0D(TS ts, PetscInt timestep, PetscReal time,
 	PetscFunctionReturn(0);
 }
 
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "monitorEnsemble0D")
+/**
+ * This is a monitoring method that writes the temperature and the total
+ * concentrations of each system of an ensemble run in a text file, once the
+ * solver stopped.
+ */
+PetscErrorCode monitorEnsemble0D(TS ts, PetscInt timestep, PetscReal time,
+		Vec solution, void *) {
+	// Initial declaration
+	PetscErrorCode ierr;
+	double **solutionArray, *gridPointSolution;
+
+	PetscFunctionBeginUser;
+
+	// Don't do anything before the end
+	TSConvergedReason reason;
+	ierr = TSGetConvergedReason(ts, &reason);
+	CHKERRQ(ierr);
+	if (reason == TS_CONVERGED_ITERATING)
+		PetscFunctionReturn(0);
+
+	// Get the da from ts
+	DM da;
+	ierr = TSGetDM(ts, &da);
+	CHKERRQ(ierr);
+
+	// Get the number of systems and the local ones
+	PetscInt Mx, xs, xm;
+	ierr = DMDAGetInfo(da, PETSC_IGNORE, &Mx, PETSC_IGNORE, PETSC_IGNORE,
+	PETSC_IGNORE, PETSC_IGNORE, PETSC_IGNORE, PETSC_IGNORE, PETSC_IGNORE,
+	PETSC_IGNORE, PETSC_IGNORE, PETSC_IGNORE, PETSC_IGNORE);
+	CHKERRQ(ierr);
+	ierr = DMDAGetCorners(da, &xs, NULL, NULL, &xm, NULL, NULL);
+	CHKERRQ(ierr);
+
+	// Get the solutionArray
+	ierr = DMDAVecGetArrayDOFRead(da, solution, &solutionArray);
+	CHKERRQ(ierr);
+
+	// Get the network
+	auto& solverHandler = PetscSolver::getSolverHandler();
+	auto& network = solverHandler.getNetwork();
+	const int dof = network.getDOF();
+
+	// The temperature, atom, vacancy, and interstitial concentrations
+	// of each system
+	std::vector<double> localValues(4 * Mx, 0.0), values(4 * Mx, 0.0);
+	for (PetscInt xi = xs; xi < xs + xm; xi++) {
+		// Get the pointer to the beginning of the solution data for this system
+		gridPointSolution = solutionArray[xi];
+
+		// Update the concentration in the network
+		network.updateConcentrationsFromArray(gridPointSolution);
+
+		localValues[4 * xi] = gridPointSolution[dof - 1];
+		localValues[4 * xi + 1] = network.getTotalAtomConcentration();
+		localValues[4 * xi + 2] = network.getTotalVConcentration();
+		localValues[4 * xi + 3] = network.getTotalIConcentration();
+	}
+
+	// Restore the solutionArray
+	ierr = DMDAVecRestoreArrayDOFRead(da, solution, &solutionArray);
+	CHKERRQ(ierr);
+
+	// Gather everything on the master process
+	MPI_Reduce(localValues.data(), values.data(), 4 * Mx, MPI_DOUBLE, MPI_SUM,
+			0, PETSC_COMM_WORLD);
+
+	// Master process writes the file
+	int procId;
+	MPI_Comm_rank(PETSC_COMM_WORLD, &procId);
+	if (procId == 0) {
+		std::ofstream outputFile;
+		outputFile.open(ensembleOutputName0D);
+		outputFile << "#system temperature atoms vacancies interstitials"
+				<< std::endl;
+		for (PetscInt xi = 0; xi < Mx; xi++) {
+			outputFile << xi << " " << values[4 * xi] << " "
+					<< values[4 * xi + 1] << " " << values[4 * xi + 2] << " "
+					<< values[4 * xi + 3] << std::endl;
+		}
+		outputFile.close();
+	}
+
+	PetscFunctionReturn(0);
+}
+
 /**
  * This operation sets up different monitors
  *  depending on the options.
@@ -371,6 +466,22 @@ PetscErrorCode setupPetsc0DMonitor(TS ts) {
 	checkPetscError(ierr,
 			"setupPetsc0DMonitor: PetscOptionsHasName (-bubble) failed.");
 
+	// Check the option -ensemble
+	PetscBool flagEnsemble;
+	ierr = PetscOptionsHasName(NULL, NULL, "-ensemble", &flagEnsemble);
+	checkPetscError(ierr,
+			"setupPetsc0DMonitor: PetscOptionsHasName (-ensemble) failed.");
+
+	// The other monitors only look at the first system
+	if (flagEnsemble && (flagStatus || flag1DPlot || flagBubble)) {
+		std::cout << "Ensemble run: -start_stop, -plot_1d, and -bubble "
+				"are ignored, the results are written in "
+				<< ensembleOutputName0D << "." << std::endl;
+		flagStatus = PETSC_FALSE;
+		flag1DPlot = PETSC_FALSE;
+		flagBubble = PETSC_FALSE;
+	}
+
 	// Get the solver handler
 	auto& solverHandler = PetscSolver::getSolverHandler();
 
@@ -553,6 +664,14 @@ PetscErrorCode setupPetsc0DMonitor(TS ts) {
 				"setupPetsc0DMonitor: TSMonitorSet (monitorBubble0D) failed.");
 	}
 
+	// Set the monitor to write the results of all the systems
+	if (flagEnsemble) {
+		// monitorEnsemble0D will be called at each timestep
+		ierr = TSMonitorSet(ts, monitorEnsemble0D, NULL, NULL);
+		checkPetscError(ierr,
+				"setupPetsc0DMonitor: TSMonitorSet (monitorEnsemble0D) failed.");
+	}
+
 	// Set the monitor to simply change the previous time to the new time
 	// monitorTime will be called at each timestep
 	ierr = TSMonitorSet(ts, monitorTime, NULL, NULL);
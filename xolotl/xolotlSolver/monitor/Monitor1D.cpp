@@ -24,6 +24,7 @@
 #include <MathUtils.h>
 #include "RandomNumberGenerator.h"
 #include "xolotlCore/io/XFile.h"
+#include "xolotlCore/io/AnalysisOutput.h"
 #include "xolotlSolver/monitor/Monitor.h"
 
 namespace xolotlSolver {
@@ -76,6 +77,13 @@ PetscReal negStride1D = 0.0;
 PetscInt negPrevious1D = 0;
 //! HDF5 output file name
 std::string hdf5OutputName1D = "xolotlStop.h5";
+//! The precision of the analysis outputs (TRIDYN profiles)
+xolotlCore::AnalysisOutput::Precision analysisPrecision1D =
+		xolotlCore::AnalysisOutput::Precision::Double;
+//! The retention written at each time step (master process only)
+std::unique_ptr<xolotlCore::TimeSeries> retentionSeries1D;
+//! The surface positions (master process only)
+std::unique_ptr<xolotlCore::TimeSeries> surfaceSeries1D;
 // Declare the vector that will store the Id of the helium clusters
 std::vector<int> indices1D;
 // Declare the vector that will store the weight of the helium clusters
@@ -245,19 +253,12 @@ PetscErrorCode computeTRIDYN1D(TS ts, PetscInt timestep, PetscReal time,
 			xolotlCore::HDF5File::AccessMode::CreateOrTruncateIfExists,
 			PETSC_COMM_WORLD, true);
 
-	// Define a dataset for concentrations.
-	// Everyone must create the dataset with the same shape.
+	// Define the shape of the dataset for concentrations.
 	constexpr auto numConcSpecies = 5;
 	constexpr auto numValsPerGridpoint = numConcSpecies + 1;
 	const auto firstIdxToWrite = (surfacePos + 1);
 	const auto numGridpointsWithConcs = (Mx - firstIdxToWrite);
-	xolotlCore::HDF5File::SimpleDataSpace<2>::Dimensions concsDsetDims = {
-			(hsize_t) numGridpointsWithConcs, numValsPerGridpoint };
-	xolotlCore::HDF5File::SimpleDataSpace<2> concsDsetSpace(concsDsetDims);
-
 	const std::string concsDsetName = "concs";
-	xolotlCore::HDF5File::DataSet<double> concsDset(tdFile, concsDsetName,
-			concsDsetSpace);
 
 	// Specify the concentrations we will write.
 	// We only consider our own grid points.
@@ -292,10 +293,12 @@ PetscErrorCode computeTRIDYN1D(TS ts, PetscInt timestep, PetscReal time,
 		}
 	}
 
-	// Write the concs dataset in parallel.
+	// Write the concs dataset in parallel, with the precision asked for
+	// the analysis outputs.
 	// (We write only our part.)
-	concsDset.parWrite2D<numValsPerGridpoint>(PETSC_COMM_WORLD,
-			myFirstIdxToWrite - firstIdxToWrite, myConcs);
+	xolotlCore::AnalysisOutput::writeDataset2D<numValsPerGridpoint>(tdFile,
+			PETSC_COMM_WORLD, concsDsetName, numGridpointsWithConcs,
+			myFirstIdxToWrite - firstIdxToWrite, myConcs, analysisPrecision1D);
 
 	// Restore the solutionArray
 	ierr = DMDAVecRestoreArrayDOFRead(da, solution, &solutionArray);
@@ -311,6 +314,9 @@ PetscErrorCode computeTRIDYN1D(TS ts, PetscInt timestep, PetscReal time,
  */
 PetscErrorCode startStop1D(TS ts, PetscInt timestep, PetscReal time,
 		Vec solution, void *) {
+	static const int startStopRegion = xolotlPerf::RegionTracer::getRegionId(
+			"monitor:startStop");
+	xolotlPerf::ScopedRegion region(startStopRegion);
 
 	startStopTimer->start();
 	// Initial declaration
@@ -415,9 +421,10 @@ PetscErrorCode startStop1D(TS ts, PetscInt timestep, PetscReal time,
 	}
 
 	// Write our concentration data to the current timestep group
-	// in the HDF5 file.
+	// in the HDF5 file, in full or as changes from the previous one.
 	// We only write the data for the grid points we own.
-	tsGroup->writeConcentrations(checkpointFile, xs, concs);
+	writeCheckpointConcentrations(checkpointFile, *tsGroup, timestep, xs,
+			concs);
 
 	// Restore the solutionArray
 	ierr = DMDAVecRestoreArrayDOFRead(da, solution, &solutionArray);
@@ -633,14 +640,10 @@ PetscErrorCode computeHeliumRetention1D(TS ts, PetscInt, PetscReal time,
 		std::cout << "Tritium content = " << totalTConcentration << std::endl;
 		std::cout << "Fluence = " << fluence << "\n" << std::endl;
 
-		// Uncomment to write the retention and the fluence in a file
-		std::ofstream outputFile;
-		outputFile.open("retentionOut.txt", ios::app);
-		outputFile << fluence << " " << totalHeConcentration << " "
-				<< totalDConcentration << " " << totalTConcentration << " "
-				<< nHelium1D << " " << nDeuterium1D << " " << nTritium1D
-				<< std::endl;
-		outputFile.close();
+		// Write the retention and the fluence
+		retentionSeries1D->addRow( { fluence, totalHeConcentration,
+				totalDConcentration, totalTConcentration, nHelium1D,
+				nDeuterium1D, nTritium1D });
 	}
 
 	// Restore the solutionArray
@@ -771,14 +774,11 @@ PetscErrorCode computeXenonRetention1D(TS ts, PetscInt, PetscReal time,
 		std::cout << "Xenon concentration = " << totalXeConcentration
 				<< std::endl << std::endl;
 
-		// Uncomment to write the retention and the fluence in a file
-		std::ofstream outputFile;
-		outputFile.open("retentionOut.txt", ios::app);
-		outputFile << time << " " << 100.0 * (totalXeConcentration / fluence)
-				<< " " << totalXeConcentration << " "
-				<< fluence - totalXeConcentration << " "
-				<< totalRadii / totalBubbleConcentration << std::endl;
-		outputFile.close();
+		// Write the retention and the fluence
+		retentionSeries1D->addRow( { time, 100.0
+				* (totalXeConcentration / fluence), totalXeConcentration,
+				fluence - totalXeConcentration, totalRadii
+						/ totalBubbleConcentration });
 	}
 
 	// Restore the solutionArray
@@ -1909,11 +1909,7 @@ PetscErrorCode eventFunction1D(TS ts, PetscReal time, Vec solution,
 	if (solverHandler.moveSurface()) {
 		// Write the initial surface position
 		if (procId == 0 && xolotlCore::equal(time, 0.0)) {
-			std::ofstream outputFile;
-			outputFile.open("surface.txt", ios::app);
-			outputFile << time << " " << grid[surfacePos + 1] - grid[1]
-					<< std::endl;
-			outputFile.close();
+			surfaceSeries1D->addRow( { time, grid[surfacePos + 1] - grid[1] });
 		}
 
 		// Value to know on which processor is the location of the surface,
@@ -2373,11 +2369,7 @@ PetscErrorCode postEventFunction1D(TS ts, PetscInt nevents,
 
 	// Write the updated surface position
 	if (procId == 0) {
-		std::ofstream outputFile;
-		outputFile.open("surface.txt", ios::app);
-		outputFile << time << " " << grid[surfacePos + 1] - grid[1]
-				<< std::endl;
-		outputFile.close();
+		surfaceSeries1D->addRow( { time, grid[surfacePos + 1] - grid[1] });
 	}
 
 	// Restore the solutionArray
@@ -2484,6 +2476,18 @@ PetscErrorCode setupPetsc1DMonitor(TS ts,
 	checkPetscError(ierr,
 			"setupPetsc1DMonitor: PetscOptionsHasName (-tridyn) failed.");
 
+	// Check the option -analysis_precision, the analysis outputs can be
+	// written as float or log16 instead of double
+	char precisionName[PETSC_MAX_PATH_LEN];
+	PetscBool flagPrecision;
+	ierr = PetscOptionsGetString(NULL, NULL, "-analysis_precision",
+			precisionName, sizeof(precisionName), &flagPrecision);
+	checkPetscError(ierr, "setupPetsc1DMonitor: "
+			"PetscOptionsGetString (-analysis_precision) failed.");
+	if (flagPrecision)
+		analysisPrecision1D = xolotlCore::AnalysisOutput::toPrecision(
+				precisionName);
+
 	// Initialize the timers
 	startStopTimer = handlerRegistry->getTimer("monitor1D:startStop");
 	eventTimer = handlerRegistry->getTimer("monitor1D:event");
@@ -2627,6 +2631,9 @@ PetscErrorCode setupPetsc1DMonitor(TS ts,
 					hdf5OutputName1D, network);
 		}
 
+		// Full or incremental checkpoints
+		setupIncrementalCheckpoints();
+
 		// startStop1D will be called at each timestep
 		ierr = TSMonitorSet(ts, startStop1D, NULL, NULL);
 		checkPetscError(ierr,
@@ -2655,10 +2662,9 @@ PetscErrorCode setupPetsc1DMonitor(TS ts,
 			// Get the sputtering yield
 			sputteringYield1D = solverHandler.getSputteringYield();
 
-			// Clear the file where the surface will be written
-			std::ofstream outputFile;
-			outputFile.open("surface.txt");
-			outputFile.close();
+			// Create the file where the surface will be written
+			surfaceSeries1D = createTimeSeries("surface", { "time",
+					"position" });
 		}
 
 		// Bursting
@@ -2890,10 +2896,10 @@ PetscErrorCode setupPetsc1DMonitor(TS ts,
 		checkPetscError(ierr,
 				"setupPetsc1DMonitor: TSMonitorSet (computeHeliumRetention1D) failed.");
 
-		// Uncomment to clear the file where the retention will be written
-		std::ofstream outputFile;
-		outputFile.open("retentionOut.txt");
-		outputFile.close();
+		// Create the file where the retention will be written
+		retentionSeries1D = createTimeSeries("retentionOut", { "fluence",
+				"heliumContent", "deuteriumContent", "tritiumContent",
+				"heliumBottom", "deuteriumBottom", "tritiumBottom" });
 	}
 
 // Set the monitor to compute the xenon fluence and the retention
@@ -2939,10 +2945,9 @@ PetscErrorCode setupPetsc1DMonitor(TS ts,
 		checkPetscError(ierr,
 				"setupPetsc1DMonitor: TSMonitorSet (computeXenonRetention1D) failed.");
 
-		// Uncomment to clear the file where the retention will be written
-		std::ofstream outputFile;
-		outputFile.open("retentionOut.txt");
-		outputFile.close();
+		// Create the file where the retention will be written
+		retentionSeries1D = createTimeSeries("retentionOut", { "time",
+				"retention", "xenonContent", "xenonLost", "meanRadius" });
 	}
 
 // Set the monitor to compute the cumulative helium concentration
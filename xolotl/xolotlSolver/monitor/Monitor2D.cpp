@@ -66,6 +66,10 @@ std::vector<double> nTritium2D;
 double sputteringYield2D = 0.0;
 // The vector of depths at which bursting happens
 std::vector<std::pair<int, int> > depthPositions2D;
+//! The retention written at each time step (master process only)
+std::unique_ptr<xolotlCore::TimeSeries> retentionSeries2D;
+//! The surface positions (master process only)
+std::unique_ptr<xolotlCore::TimeSeries> surfaceSeries2D;
 
 #undef __FUNCT__
 #define __FUNCT__ Actual__FUNCT__("xolotlSolver", "startStop2D")
@@ -74,6 +78,11 @@ std::vector<std::pair<int, int> > depthPositions2D;
  */
 PetscErrorCode startStop2D(TS ts, PetscInt timestep, PetscReal time,
 		Vec solution, void *) {
+	// Time the checkpoint
+	static auto startStopTimer = xolotlPerf::getHandlerRegistry()->getTimer(
+			"monitor2D:startStop");
+	xolotlPerf::ScopedTimer myTimer(startStopTimer);
+
 	// Initial declaration
 	PetscErrorCode ierr;
 	const double ***solutionArray, *gridPointSolution;
@@ -126,9 +135,6 @@ PetscErrorCode startStop2D(TS ts, PetscInt timestep, PetscReal time,
 	// Network size
 	const int dof = network.getDOF();
 
-	// Create an array for the concentration
-	double concArray[dof][2];
-
 	// Get the vector of positions of the surface
 	std::vector<int> surfaceIndices;
 	for (PetscInt i = 0; i < My; i++) {
@@ -160,59 +166,30 @@ PetscErrorCode startStop2D(TS ts, PetscInt timestep, PetscReal time,
 		tsGroup->writeBottom2D(nHelium2D, previousHeFlux2D, nDeuterium2D,
 				previousDFlux2D, nTritium2D, previousTFlux2D);
 
-	// Loop on the full grid
-	for (PetscInt j = 0; j < My; j++) {
-		for (PetscInt i = 0; i < Mx; i++) {
-			// Size of the concentration that will be stored
-			int concSize = -1;
-			// To save which proc has the information
-			int concId = 0;
-
-			// If it is the locally owned part of the grid
-			if (i >= xs && i < xs + xm && j >= ys && j < ys + ym) {
-				// Get the pointer to the beginning of the solution data for this grid point
-				gridPointSolution = solutionArray[j][i];
-
-				// Loop on the concentrations
-				for (int l = 0; l < dof; l++) {
-					if (gridPointSolution[l] > 1.0e-16
-							|| gridPointSolution[l] < -1.0e-16) {
-						// Increase concSize
-						concSize++;
-						// Fill the concArray
-						concArray[concSize][0] = (double) l;
-						concArray[concSize][1] = gridPointSolution[l];
-					}
+	// Determine the concentration values we will write.
+	// We only examine and collect the grid points we own, they are
+	// identified by their linear index i + Mx * j.
+	xolotlCore::XFile::TimestepGroup::Concs1DType concs(xm * ym);
+	std::vector<int> gridPoints(xm * ym);
+	for (PetscInt j = ys, n = 0; j < ys + ym; j++) {
+		for (PetscInt i = xs; i < xs + xm; i++, n++) {
+			// Access the solution data for the current grid point.
+			gridPointSolution = solutionArray[j][i];
+			gridPoints[n] = i + Mx * j;
+
+			for (int l = 0; l < dof; l++) {
+				if (std::fabs(gridPointSolution[l]) > 1.0e-16) {
+					concs[n].emplace_back(l, gridPointSolution[l]);
 				}
-
-				// Increase concSize one last time
-				concSize++;
-
-				// Save the procId
-				concId = procId;
 			}
-
-			// Get which processor will send the information
-			int concProc = 0;
-			MPI_Allreduce(&concId, &concProc, 1, MPI_INT, MPI_SUM,
-					PETSC_COMM_WORLD);
-
-			// Broadcast the size
-			MPI_Bcast(&concSize, 1, MPI_INT, concProc, PETSC_COMM_WORLD);
-
-			// Skip the grid point if the size is 0
-			if (concSize == 0)
-				continue;
-
-			// Transfer the data everywhere from the local grid
-			MPI_Bcast(&(concArray[0][0]), 2 * concSize, MPI_DOUBLE, concProc,
-					PETSC_COMM_WORLD);
-
-			// All processes create the dataset and fill it
-			tsGroup->writeConcentrationDataset(concSize, concArray, i, j);
 		}
 	}
 
+	// Write the concentrations of the whole grid in one dataset,
+	// in full or as changes from the previous checkpoint
+	writeCheckpointConcentrations(checkpointFile, *tsGroup, timestep, Mx * My,
+			gridPoints, concs);
+
 	// Restore the solutionArray
 	ierr = DMDAVecRestoreArrayDOFRead(da, solution, &solutionArray);
 	CHKERRQ(ierr);
@@ -458,14 +435,10 @@ PetscErrorCode computeHeliumRetention2D(TS ts, PetscInt, PetscReal time,
 		std::cout << "Tritium content = " << totalTConcentration << std::endl;
 		std::cout << "Fluence = " << fluence << "\n" << std::endl;
 
-		// Uncomment to write the retention and the fluence in a file
-		std::ofstream outputFile;
-		outputFile.open("retentionOut.txt", ios::app);
-		outputFile << fluence << " " << totalHeConcentration << " "
-				<< totalDConcentration << " " << totalTConcentration << " "
-				<< totalHeBulk << " " << totalDBulk << " " << totalTBulk
-				<< std::endl;
-		outputFile.close();
+		// Write the retention and the fluence
+		retentionSeries2D->addRow( { fluence, totalHeConcentration,
+				totalDConcentration, totalTConcentration, totalHeBulk,
+				totalDBulk, totalTBulk });
 	}
 
 	// Restore the solutionArray
@@ -829,18 +802,15 @@ PetscErrorCode eventFunction2D(TS ts, PetscReal time, Vec solution,
 	if (solverHandler.moveSurface()) {
 		// Write the initial surface positions
 		if (procId == 0 && xolotlCore::equal(time, 0.0)) {
-			std::ofstream outputFile;
-			outputFile.open("surface.txt", ios::app);
-			outputFile << time << " ";
+			std::vector<double> row = { time };
 
 			// Loop on the possible yj
 			for (yj = 0; yj < My; yj++) {
 				// Get the position of the surface at yj
 				int surfacePos = solverHandler.getSurfacePosition(yj);
-				outputFile << grid[surfacePos + 1] - grid[1] << " ";
+				row.push_back(grid[surfacePos + 1] - grid[1]);
 			}
-			outputFile << std::endl;
-			outputFile.close();
+			surfaceSeries2D->addRow(row);
 		}
 
 		// Get the initial vacancy concentration
@@ -1222,6 +1192,9 @@ PetscErrorCode postEventFunction2D(TS ts, PetscInt nevents,
 	// Get the initial vacancy concentration
 	double initialVConc = solverHandler.getInitialVConc();
 
+	// Keep the columns where the surface moved
+	std::vector<int> movedColumns;
+
 	// Loop on the possible yj
 	for (yj = 0; yj < My; yj++) {
 		// Get the position of the surface at yj
@@ -1263,6 +1236,7 @@ PetscErrorCode postEventFunction2D(TS ts, PetscInt nevents,
 
 			// Set it in the solver
 			solverHandler.setSurfacePosition(surfacePos, yj);
+			movedColumns.push_back(yj);
 
 			// Initialize the vacancy concentration and the temperature on the new grid points
 			// Get the single vacancy ID
@@ -1335,36 +1309,33 @@ PetscErrorCode postEventFunction2D(TS ts, PetscInt nevents,
 
 			// Set it in the solver
 			solverHandler.setSurfacePosition(surfacePos, yj);
+			movedColumns.push_back(yj);
 		}
 	}
 
-	// Get the modified trap-mutation handler to reinitialize it
+	// Get the modified trap-mutation handler to update it
 	auto mutationHandler = solverHandler.getMutationHandler();
 	auto advecHandlers = solverHandler.getAdvectionHandlers();
 
-	// Get the vector of positions of the surface
-	std::vector<int> surfaceIndices;
-	for (PetscInt i = 0; i < My; i++) {
-		surfaceIndices.push_back(solverHandler.getSurfacePosition(i));
+	// Only the moved columns on this process need to be updated
+	for (auto j : movedColumns) {
+		if (j < ys || j >= ys + ym)
+			continue;
+		mutationHandler->updateIndex2D(j, solverHandler.getSurfacePosition(j),
+				advecHandlers, grid, hy, xs, xm);
 	}
 
-	mutationHandler->initializeIndex2D(surfaceIndices, network, advecHandlers,
-			grid, My, hy);
-
 	// Write the surface positions
 	if (procId == 0) {
-		std::ofstream outputFile;
-		outputFile.open("surface.txt", ios::app);
-		outputFile << time << " ";
+		std::vector<double> row = { time };
 
 		// Loop on the possible yj
 		for (yj = 0; yj < My; yj++) {
 			// Get the position of the surface at yj
 			int surfacePos = solverHandler.getSurfacePosition(yj);
-			outputFile << grid[surfacePos + 1] - grid[1] << " ";
+			row.push_back(grid[surfacePos + 1] - grid[1]);
 		}
-		outputFile << std::endl;
-		outputFile.close();
+		surfaceSeries2D->addRow(row);
 	}
 
 	// Restore the solutionArray
@@ -1530,6 +1501,9 @@ PetscErrorCode setupPetsc2DMonitor(TS ts) {
 					hdf5OutputName2D, network);
 		}
 
+		// Full or incremental checkpoints
+		setupIncrementalCheckpoints();
+
 		// startStop2D will be called at each timestep
 		ierr = TSMonitorSet(ts, startStop2D, NULL, NULL);
 		checkPetscError(ierr,
@@ -1563,10 +1537,12 @@ PetscErrorCode setupPetsc2DMonitor(TS ts) {
 			// Get the sputtering yield
 			sputteringYield2D = solverHandler.getSputteringYield();
 
-			// Clear the file where the surface will be written
-			std::ofstream outputFile;
-			outputFile.open("surface.txt");
-			outputFile.close();
+			// Create the file where the surface will be written,
+			// with a position for each yj
+			std::vector<std::string> columns = { "time" };
+			for (PetscInt j = 0; j < My; j++)
+				columns.push_back("position_" + std::to_string(j));
+			surfaceSeries2D = createTimeSeries("surface", columns);
 		}
 
 		// Bursting
@@ -1672,10 +1648,10 @@ PetscErrorCode setupPetsc2DMonitor(TS ts) {
 		checkPetscError(ierr,
 				"setupPetsc2DMonitor: TSMonitorSet (computeHeliumRetention2D) failed.");
 
-		// Uncomment to clear the file where the retention will be written
-		std::ofstream outputFile;
-		outputFile.open("retentionOut.txt");
-		outputFile.close();
+		// Create the file where the retention will be written
+		retentionSeries2D = createTimeSeries("retentionOut", { "fluence",
+				"heliumContent", "deuteriumContent", "tritiumContent",
+				"heliumBottom", "deuteriumBottom", "tritiumBottom" });
 	}
 
 	// Set the monitor to save surface plots of clusters concentration
@@ -56,6 +56,10 @@ std::vector<std::vector<double> > nInterstitial3D;
 double sputteringYield3D = 0.0;
 // The vector of depths at which bursting happens
 std::vector<std::tuple<int, int, int> > depthPositions3D;
+//! The retention written at each time step (master process only)
+std::unique_ptr<xolotlCore::TimeSeries> retentionSeries3D;
+//! The surface positions (master process only)
+std::unique_ptr<xolotlCore::TimeSeries> surfaceSeries3D;
 
 #undef __FUNCT__
 #define __FUNCT__ Actual__FUNCT__("xolotlSolver", "startStop3D")
@@ -64,6 +68,11 @@ std::vector<std::tuple<int, int, int> > depthPositions3D;
  */
 PetscErrorCode startStop3D(TS ts, PetscInt timestep, PetscReal time,
 		Vec solution, void *) {
+	// Time the checkpoint
+	static auto startStopTimer = xolotlPerf::getHandlerRegistry()->getTimer(
+			"monitor3D:startStop");
+	xolotlPerf::ScopedTimer myTimer(startStopTimer);
+
 	// Initial declarations
 	PetscErrorCode ierr;
 	const double ****solutionArray, *gridPointSolution;
@@ -116,9 +125,6 @@ PetscErrorCode startStop3D(TS ts, PetscInt timestep, PetscReal time,
 	// Network size
 	const int dof = network.getDOF();
 
-	// Create an array for the concentration
-	double concArray[dof][2];
-
 	// Get the vector of positions of the surface
 	std::vector<std::vector<int> > surfaceIndices;
 	for (PetscInt i = 0; i < My; i++) {
@@ -150,63 +156,33 @@ PetscErrorCode startStop3D(TS ts, PetscInt timestep, PetscReal time,
 	// Write the surface positions in the concentration sub group
 	tsGroup->writeSurface3D(surfaceIndices, nInterstitial3D, previousIFlux3D);
 
-	// Loop on the full grid
-	for (PetscInt k = 0; k < Mz; k++) {
-		for (PetscInt j = 0; j < My; j++) {
-			for (PetscInt i = 0; i < Mx; i++) {
-				// Size of the concentration that will be stored
-				int concSize = -1;
-				// To save which proc has the information
-				int concId = 0;
-
-				// If it is the locally owned part of the grid
-				if (i >= xs && i < xs + xm && j >= ys && j < ys + ym && k >= zs
-						&& k < zs + zm) {
-					// Get the pointer to the beginning of the solution data for this grid point
-					gridPointSolution = solutionArray[k][j][i];
-
-					// Loop on the concentrations
-					for (int l = 0; l < dof; l++) {
-						if (gridPointSolution[l] > 1.0e-16
-								|| gridPointSolution[l] < -1.0e-16) {
-							// Increase concSize
-							concSize++;
-							// Fill the concArray
-							concArray[concSize][0] = (double) l;
-							concArray[concSize][1] = gridPointSolution[l];
-						}
+	// Determine the concentration values we will write.
+	// We only examine and collect the grid points we own, they are
+	// identified by their linear index i + Mx * (j + My * k).
+	xolotlCore::XFile::TimestepGroup::Concs1DType concs(xm * ym * zm);
+	std::vector<int> gridPoints(xm * ym * zm);
+	PetscInt n = 0;
+	for (PetscInt k = zs; k < zs + zm; k++) {
+		for (PetscInt j = ys; j < ys + ym; j++) {
+			for (PetscInt i = xs; i < xs + xm; i++, n++) {
+				// Access the solution data for the current grid point.
+				gridPointSolution = solutionArray[k][j][i];
+				gridPoints[n] = i + Mx * (j + My * k);
+
+				for (int l = 0; l < dof; l++) {
+					if (std::fabs(gridPointSolution[l]) > 1.0e-16) {
+						concs[n].emplace_back(l, gridPointSolution[l]);
 					}
-
-					// Increase concSize one last time
-					concSize++;
-
-					// Save the procId
-					concId = procId;
 				}
-
-				// Get which processor will send the information
-				int concProc = 0;
-				MPI_Allreduce(&concId, &concProc, 1, MPI_INT, MPI_SUM,
-						PETSC_COMM_WORLD);
-
-				// Broadcast the size
-				MPI_Bcast(&concSize, 1, MPI_INT, concProc, PETSC_COMM_WORLD);
-
-				// Skip the grid point if the size is 0
-				if (concSize == 0)
-					continue;
-
-				// Transfer the data everywhere from the local grid
-				MPI_Bcast(&(concArray[0][0]), 2 * concSize, MPI_DOUBLE,
-						concProc, PETSC_COMM_WORLD);
-
-				// All processes create the dataset and fill it
-				tsGroup->writeConcentrationDataset(concSize, concArray, i, j,
-						k);
 			}
 		}
 	}
 
+	// Write the concentrations of the whole grid in one dataset,
+	// in full or as changes from the previous checkpoint
+	writeCheckpointConcentrations(checkpointFile, *tsGroup, timestep,
+			Mx * My * Mz, gridPoints, concs);
+
 	// Restore the solutionArray
 	ierr = DMDAVecRestoreArrayDOFRead(da, solution, &solutionArray);
 	CHKERRQ(ierr);
@@ -339,13 +315,9 @@ PetscErrorCode computeHeliumRetention3D(TS ts, PetscInt, PetscReal time,
 		std::cout << "Tritium content = " << totalTConcentration << std::endl;
 		std::cout << "Fluence = " << fluence << "\n" << std::endl;
 
-		// Uncomment to write the retention and the fluence in a file
-		std::ofstream outputFile;
-		outputFile.open("retentionOut.txt", ios::app);
-		outputFile << fluence << " " << totalHeConcentration << " "
-				<< totalDConcentration << " " << totalTConcentration
-				<< std::endl;
-		outputFile.close();
+		// Write the retention and the fluence
+		retentionSeries3D->addRow( { fluence, totalHeConcentration,
+				totalDConcentration, totalTConcentration });
 	}
 
 	// Restore the solutionArray
@@ -705,21 +677,19 @@ PetscErrorCode eventFunction3D(TS ts, PetscReal time, Vec solution,
 	if (solverHandler.moveSurface()) {
 		// Write the initial surface positions
 		if (procId == 0 && xolotlCore::equal(time, 0.0)) {
-			std::ofstream outputFile;
-			outputFile.open("surface.txt", ios::app);
-			outputFile << time << " ";
+			std::vector<double> row = { time };
 
 			// Loop on the possible yj
 			for (yj = 0; yj < My; yj++) {
 				for (zk = 0; zk < Mz; zk++) {
 					// Get the position of the surface at yj, zk
 					int surfacePos = solverHandler.getSurfacePosition(yj, zk);
-					outputFile << (double) yj * hy << " " << (double) zk * hz
-							<< " " << grid[surfacePos + 1] - grid[1] << " ";
+					row.push_back((double) yj * hy);
+					row.push_back((double) zk * hz);
+					row.push_back(grid[surfacePos + 1] - grid[1]);
 				}
 			}
-			outputFile << std::endl;
-			outputFile.close();
+			surfaceSeries3D->addRow(row);
 		}
 
 		// Get the initial vacancy concentration
@@ -1059,6 +1029,9 @@ PetscErrorCode postEventFunction3D(TS ts, PetscInt nevents,
 	// Get the initial vacancy concentration
 	double initialVConc = solverHandler.getInitialVConc();
 
+	// Keep the columns (yj, zk) where the surface moved
+	std::vector<std::pair<int, int> > movedColumns;
+
 	// Loop on the possible zk and yj
 	for (zk = 0; zk < Mz; zk++) {
 		for (yj = 0; yj < My; yj++) {
@@ -1102,6 +1075,7 @@ PetscErrorCode postEventFunction3D(TS ts, PetscInt nevents,
 
 				// Set it in the solver
 				solverHandler.setSurfacePosition(surfacePos, yj, zk);
+				movedColumns.emplace_back(yj, zk);
 
 				// Initialize the vacancy concentration and the temperature on the new grid points
 				// Get the single vacancy ID
@@ -1178,45 +1152,39 @@ PetscErrorCode postEventFunction3D(TS ts, PetscInt nevents,
 
 				// Set it in the solver
 				solverHandler.setSurfacePosition(surfacePos, yj, zk);
+				movedColumns.emplace_back(yj, zk);
 			}
 		}
 	}
-	// Get the modified trap-mutation handler to reinitialize it
+	// Get the modified trap-mutation handler to update it
 	auto mutationHandler = solverHandler.getMutationHandler();
 	auto advecHandlers = solverHandler.getAdvectionHandlers();
 
-	// Get the vector of positions of the surface
-	std::vector<std::vector<int> > surfaceIndices;
-	for (PetscInt i = 0; i < My; i++) {
-		// Create a temporary vector
-		std::vector<int> temp;
-		for (PetscInt j = 0; j < Mz; j++) {
-			temp.push_back(solverHandler.getSurfacePosition(i, j));
-		}
-		// Add the temporary vector to the vector of surface indices
-		surfaceIndices.push_back(temp);
+	// Only the moved columns on this process need to be updated
+	for (auto const& column : movedColumns) {
+		int j = column.first, k = column.second;
+		if (j < ys || j >= ys + ym || k < zs || k >= zs + zm)
+			continue;
+		mutationHandler->updateIndex3D(j, k,
+				solverHandler.getSurfacePosition(j, k), advecHandlers, grid, hy,
+				xs, xm);
 	}
 
-	mutationHandler->initializeIndex3D(surfaceIndices, network, advecHandlers,
-			grid, My, hy, Mz, hz);
-
 	// Write the surface positions
 	if (procId == 0) {
-		std::ofstream outputFile;
-		outputFile.open("surface.txt", ios::app);
-		outputFile << time << " ";
+		std::vector<double> row = { time };
 
 		// Loop on the possible yj
 		for (yj = 0; yj < My; yj++) {
 			for (zk = 0; zk < Mz; zk++) {
 				// Get the position of the surface at yj, zk
 				int surfacePos = solverHandler.getSurfacePosition(yj, zk);
-				outputFile << (double) yj * hy << " " << (double) zk * hz << " "
-						<< grid[surfacePos + 1] - grid[1] << " ";
+				row.push_back((double) yj * hy);
+				row.push_back((double) zk * hz);
+				row.push_back(grid[surfacePos + 1] - grid[1]);
 			}
 		}
-		outputFile << std::endl;
-		outputFile.close();
+		surfaceSeries3D->addRow(row);
 	}
 
 	// Restore the solutionArray
@@ -1387,6 +1355,9 @@ PetscErrorCode setupPetsc3DMonitor(TS ts) {
 					hdf5OutputName3D, network);
 		}
 
+		// Full or incremental checkpoints
+		setupIncrementalCheckpoints();
+
 		// startStop3D will be called at each timestep
 		ierr = TSMonitorSet(ts, startStop3D, NULL, NULL);
 		checkPetscError(ierr,
@@ -1424,10 +1395,19 @@ PetscErrorCode setupPetsc3DMonitor(TS ts) {
 			// Get the sputtering yield
 			sputteringYield3D = solverHandler.getSputteringYield();
 
-			// Clear the file where the surface will be written
-			std::ofstream outputFile;
-			outputFile.open("surface.txt");
-			outputFile.close();
+			// Create the file where the surface will be written,
+			// with the coordinates and position for each yj, zk
+			std::vector<std::string> columns = { "time" };
+			for (PetscInt j = 0; j < My; j++) {
+				for (PetscInt k = 0; k < Mz; k++) {
+					std::string suffix = "_" + std::to_string(j) + "_"
+							+ std::to_string(k);
+					columns.push_back("y" + suffix);
+					columns.push_back("z" + suffix);
+					columns.push_back("position" + suffix);
+				}
+			}
+			surfaceSeries3D = createTimeSeries("surface", columns);
 		}
 
 		// Bursting
@@ -1507,10 +1487,9 @@ PetscErrorCode setupPetsc3DMonitor(TS ts) {
 		checkPetscError(ierr,
 				"setupPetsc3DMonitor: TSMonitorSet (computeHeliumRetention3D) failed.");
 
-		// Uncomment to clear the file where the retention will be written
-		std::ofstream outputFile;
-		outputFile.open("retentionOut.txt");
-		outputFile.close();
+		// Create the file where the retention will be written
+		retentionSeries3D = createTimeSeries("retentionOut", { "fluence",
+				"heliumContent", "deuteriumContent", "tritiumContent" });
 	}
 
 	// Set the monitor to save surface plots of clusters concentration
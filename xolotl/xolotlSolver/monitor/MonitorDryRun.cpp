@@ -0,0 +1,178 @@
+// Includes
+#include "PetscSolver.h"
+#include <ReactantType.h>
+#include <petscts.h>
+#include <petscsys.h>
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+
+namespace xolotlSolver {
+
+//! The name of the file where the dry run report is written.
+static const std::string dryRunFileName = "dryRun.json";
+
+//! The number of vectors of the size of the solution used to estimate the
+//! memory: the stages of the time stepper, the nonlinear solver, and the
+//! restarted GMRES basis (30 by default).
+static const int nWorkVectors = 40;
+
+//! The number of evaluations, the fastest one is reported.
+static const int nEvaluations = 3;
+
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "reportDryRun")
+/**
+ * This operation writes, instead of solving, what is needed to choose the
+ * number of nodes of a run: the size of the network and of the problem,
+ * the nonzeros of the Jacobian, the memory per grid point and per process,
+ * and the measured cost of the RHS function and Jacobian per grid point.
+ * The report is written in JSON by the master process.
+ *
+ * @param ts The time stepper, with the RHS function and Jacobian set
+ * @param C The initial solution
+ * @return A standard PETSc error code
+ */
+PetscErrorCode reportDryRun(TS ts, Vec C) {
+	PetscErrorCode ierr;
+
+	PetscFunctionBeginUser;
+
+	auto& solverHandler = PetscSolver::getSolverHandler();
+	auto& network = solverHandler.getNetwork();
+
+	int procId, nProcs;
+	MPI_Comm_rank(PETSC_COMM_WORLD, &procId);
+	MPI_Comm_size(PETSC_COMM_WORLD, &nProcs);
+
+	// The size of the problem
+	DM da;
+	ierr = TSGetDM(ts, &da);
+	CHKERRQ(ierr);
+	PetscInt Mx, My, Mz, dof;
+	ierr = DMDAGetInfo(da, PETSC_IGNORE, &Mx, &My, &Mz, PETSC_IGNORE,
+			PETSC_IGNORE, PETSC_IGNORE, &dof, PETSC_IGNORE, PETSC_IGNORE,
+			PETSC_IGNORE, PETSC_IGNORE, PETSC_IGNORE);
+	CHKERRQ(ierr);
+	PetscInt xm, ym, zm;
+	ierr = DMDAGetCorners(da, NULL, NULL, NULL, &xm, &ym, &zm);
+	CHKERRQ(ierr);
+	double nGridPoints = (double) Mx * (double) My * (double) Mz;
+	double nLocalPoints = (double) xm * (double) ym * (double) zm;
+
+	// The reactants and their coefficients by type
+	std::map<std::string, std::pair<int, std::size_t> > reactantsByType;
+	for (IReactant const& currReactant : network.getAll()) {
+		auto& typeInfo = reactantsByType[toString(currReactant.getType())];
+		typeInfo.first++;
+		typeInfo.second += currReactant.getNumCoefficients() * sizeof(double);
+	}
+
+	// The nonzeros of the reactions at a grid point
+	std::vector<int> partialsSizes(network.getDOF());
+	std::vector<size_t> partialsStartingIdx(network.getDOF());
+	std::size_t nPartials = network.initPartialsSizes(partialsSizes,
+			partialsStartingIdx);
+
+	// The whole Jacobian, with the diffusion and advection
+	Mat J;
+	ierr = DMCreateMatrix(da, &J);
+	CHKERRQ(ierr);
+	MatInfo matInfo;
+	ierr = MatGetInfo(J, MAT_GLOBAL_SUM, &matInfo);
+	CHKERRQ(ierr);
+	double nonzerosPerPoint = matInfo.nz_allocated / nGridPoints;
+
+	// Measure the RHS function and Jacobian, the slowest process sets
+	// the pace. PETSc does not compute the Jacobian again for the same
+	// time and state of the solution, so the state is increased before
+	// each evaluation.
+	Vec F;
+	ierr = VecDuplicate(C, &F);
+	CHKERRQ(ierr);
+	PetscReal time;
+	ierr = TSGetTime(ts, &time);
+	CHKERRQ(ierr);
+	std::array<double, 2> costs = { 1.0e30, 1.0e30 };
+	for (int n = 0; n < nEvaluations; n++) {
+		ierr = PetscObjectStateIncrease((PetscObject) C);
+		CHKERRQ(ierr);
+
+		double start = MPI_Wtime();
+		ierr = TSComputeRHSFunction(ts, time, C, F);
+		CHKERRQ(ierr);
+		costs[0] = std::min(costs[0], MPI_Wtime() - start);
+
+		start = MPI_Wtime();
+		ierr = TSComputeRHSJacobian(ts, time, C, J, J);
+		CHKERRQ(ierr);
+		costs[1] = std::min(costs[1], MPI_Wtime() - start);
+	}
+	for (auto& cost : costs)
+		cost /= std::max(nLocalPoints, 1.0);
+	MPI_Allreduce(MPI_IN_PLACE, costs.data(), 2, MPI_DOUBLE, MPI_MAX,
+			PETSC_COMM_WORLD);
+
+	// The memory of each process, the network being on all of them
+	PetscLogDouble memory = 0.0;
+	ierr = PetscMemoryGetCurrentUsage(&memory);
+	CHKERRQ(ierr);
+	std::array<double, 2> memoryRange = { memory, -memory };
+	MPI_Allreduce(MPI_IN_PLACE, memoryRange.data(), 2, MPI_DOUBLE, MPI_MIN,
+			PETSC_COMM_WORLD);
+
+	// The memory per grid point
+	double jacobianBytes = nonzerosPerPoint
+			* (double) (sizeof(PetscScalar) + sizeof(PetscInt));
+	double vectorBytes = (double) dof * sizeof(PetscScalar) * nWorkVectors;
+
+	if (procId == 0) {
+		std::ofstream outputFile(dryRunFileName);
+		outputFile.precision(8);
+		outputFile << "{\n  \"processes\": " << nProcs
+				<< ",\n  \"dimension\": " << solverHandler.getDimension()
+				<< ",\n  \"gridPoints\": [" << Mx << ", " << My << ", " << Mz
+				<< "],\n  \"dof\": " << dof << ",\n  \"clusters\": "
+				<< network.size() << ",\n  \"superClusters\": "
+				<< network.getSuperSize() << ",\n  \"reactants\": {";
+		bool first = true;
+		for (auto const& typeInfo : reactantsByType) {
+			outputFile << (first ? "\n" : ",\n") << "    \"" << typeInfo.first
+					<< "\": {\"count\": " << typeInfo.second.first
+					<< ", \"coefficientBytes\": " << typeInfo.second.second
+					<< "}";
+			first = false;
+		}
+		outputFile << "\n  },\n  \"productionReactions\": "
+				<< network.getNumProductionReactions()
+				<< ",\n  \"dissociationReactions\": "
+				<< network.getNumDissociationReactions()
+				<< ",\n  \"partialsPerGridPoint\": "
+				<< nPartials << ",\n  \"jacobianNonzerosPerGridPoint\": "
+				<< nonzerosPerPoint << ",\n  \"bytesPerGridPoint\": {"
+				<< "\"jacobian\": " << jacobianBytes << ", \"vectors\": "
+				<< vectorBytes << ", \"workVectors\": " << nWorkVectors
+				<< ", \"total\": " << jacobianBytes + vectorBytes
+				<< "},\n  \"processBytes\": {\"min\": " << memoryRange[0]
+				<< ", \"max\": " << -memoryRange[1]
+				<< "},\n  \"secondsPerGridPoint\": {\"rhs\": " << costs[0]
+				<< ", \"jacobian\": " << costs[1] << "}\n}" << std::endl;
+
+		std::cout << "Dry run: " << network.size() << " clusters, " << dof
+				<< " DOF per grid point, "
+				<< jacobianBytes + vectorBytes << " bytes per grid point, "
+				"see " << dryRunFileName << "." << std::endl;
+	}
+
+	ierr = VecDestroy(&F);
+	CHKERRQ(ierr);
+	ierr = MatDestroy(&J);
+	CHKERRQ(ierr);
+
+	PetscFunctionReturn(0);
+}
+
+} /* end namespace xolotlSolver */
@@ -0,0 +1,381 @@
+// Includes
+#include "PetscSolver.h"
+#include <petscts.h>
+#include <petscsys.h>
+#include <petscdmda.h>
+#include <vector>
+
+namespace xolotlSolver {
+
+// Declaration of the post step in Monitor.cpp
+extern PetscErrorCode checkTimeStep(TS ts);
+
+//! The DMDA of the heat equation, same grid and decomposition as the
+//! clusters but only the temperature at each grid point.
+static DM heatDA = NULL;
+
+//! The time stepper of the heat equation.
+static TS heatTS = NULL;
+
+//! The temperature field advanced by heatTS.
+static Vec heatSolution = NULL;
+
+//! The time heatSolution corresponds to, negative before the first time step.
+static PetscReal heatTime = -1.0;
+
+//! The grid in the depth direction.
+static std::vector<double> heatGrid;
+
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "heatRHSFunction")
+/**
+ * This is the RHS function of the heat equation, with the same stencil and
+ * boundary conditions as when it is solved with the clusters.
+ */
+PetscErrorCode heatRHSFunction(TS, PetscReal, Vec T, Vec F, void *) {
+	// To check PETSc errors
+	PetscErrorCode ierr;
+
+	PetscFunctionBeginUser;
+
+	auto& solverHandler = PetscSolver::getSolverHandler();
+	auto temperatureHandler = solverHandler.getTemperatureHandler();
+	const int leftOffset = solverHandler.getLeftOffset();
+	const int rightOffset = solverHandler.getRightOffset();
+
+	// Get the ghosted temperatures
+	Vec localT;
+	ierr = DMGetLocalVector(heatDA, &localT);
+	CHKERRQ(ierr);
+	ierr = DMGlobalToLocalBegin(heatDA, T, INSERT_VALUES, localT);
+	CHKERRQ(ierr);
+	ierr = DMGlobalToLocalEnd(heatDA, T, INSERT_VALUES, localT);
+	CHKERRQ(ierr);
+	ierr = VecSet(F, 0.0);
+	CHKERRQ(ierr);
+
+	const PetscScalar *temps;
+	PetscScalar *updatedTemps;
+	ierr = VecGetArrayRead(localT, &temps);
+	CHKERRQ(ierr);
+	ierr = VecGetArray(F, &updatedTemps);
+	CHKERRQ(ierr);
+
+	// Get the corners of the grid
+	PetscInt M, xs, ys, zs, xm, ym, zm, gxs, gys, gzs, gxm, gym, gzm;
+	ierr = DMDAGetInfo(heatDA, NULL, &M, NULL, NULL, NULL, NULL, NULL, NULL,
+	NULL, NULL, NULL, NULL, NULL);
+	CHKERRQ(ierr);
+	ierr = DMDAGetCorners(heatDA, &xs, &ys, &zs, &xm, &ym, &zm);
+	CHKERRQ(ierr);
+	ierr = DMDAGetGhostCorners(heatDA, &gxs, &gys, &gzs, &gxm, &gym, &gzm);
+	CHKERRQ(ierr);
+
+	double *tempVector[3];
+	for (PetscInt zk = zs; zk < zs + zm; zk++) {
+		for (PetscInt yj = ys; yj < ys + ym; yj++) {
+			int surfacePos = solverHandler.getSurfacePosition(yj, zk);
+			temperatureHandler->updateSurfacePosition(surfacePos);
+
+			for (PetscInt xi = xs; xi < xs + xm; xi++) {
+				// The temperature is the only degree of freedom
+				int ghostIdx = ((zk - gzs) * gym + (yj - gys)) * gxm + xi - gxs;
+				tempVector[0] = const_cast<PetscScalar *>(temps + ghostIdx); // middle
+				tempVector[1] = tempVector[0] - 1; // left
+				tempVector[2] = tempVector[0] + 1; // right
+				double *updatedTemp = updatedTemps
+						+ ((zk - zs) * ym + (yj - ys)) * xm + xi - xs;
+				double hxLeft = heatGrid[xi + 1] - heatGrid[xi];
+				double hxRight = heatGrid[xi + 2] - heatGrid[xi + 1];
+
+				// Heat condition
+				if (xi == surfacePos) {
+					temperatureHandler->computeSplitTemperature(tempVector,
+							updatedTemp, hxLeft, hxRight, xi);
+				}
+
+				// Boundary conditions
+				if (xi < surfacePos + leftOffset || xi > M - 1 - rightOffset)
+					continue;
+
+				temperatureHandler->computeSplitTemperature(tempVector,
+						updatedTemp, hxLeft, hxRight, xi);
+			}
+		}
+	}
+
+	ierr = VecRestoreArrayRead(localT, &temps);
+	CHKERRQ(ierr);
+	ierr = VecRestoreArray(F, &updatedTemps);
+	CHKERRQ(ierr);
+	ierr = DMRestoreLocalVector(heatDA, &localT);
+	CHKERRQ(ierr);
+
+	PetscFunctionReturn(0);
+}
+
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "heatRHSJacobian")
+/**
+ * This is the Jacobian of the RHS function of the heat equation.
+ */
+PetscErrorCode heatRHSJacobian(TS, PetscReal, Vec, Mat A, Mat J, void *) {
+	// To check PETSc errors
+	PetscErrorCode ierr;
+
+	PetscFunctionBeginUser;
+
+	auto& solverHandler = PetscSolver::getSolverHandler();
+	auto temperatureHandler = solverHandler.getTemperatureHandler();
+	const int leftOffset = solverHandler.getLeftOffset();
+	const int rightOffset = solverHandler.getRightOffset();
+
+	ierr = MatZeroEntries(J);
+	CHKERRQ(ierr);
+
+	// Get the corners of the grid
+	PetscInt M, xs, ys, zs, xm, ym, zm;
+	ierr = DMDAGetInfo(heatDA, NULL, &M, NULL, NULL, NULL, NULL, NULL, NULL,
+	NULL, NULL, NULL, NULL, NULL);
+	CHKERRQ(ierr);
+	ierr = DMDAGetCorners(heatDA, &xs, &ys, &zs, &xm, &ym, &zm);
+	CHKERRQ(ierr);
+
+	MatStencil row, cols[3];
+	PetscScalar vals[3];
+	for (PetscInt zk = zs; zk < zs + zm; zk++) {
+		for (PetscInt yj = ys; yj < ys + ym; yj++) {
+			int surfacePos = solverHandler.getSurfacePosition(yj, zk);
+			temperatureHandler->updateSurfacePosition(surfacePos);
+
+			for (PetscInt xi = xs; xi < xs + xm; xi++) {
+				double hxLeft = heatGrid[xi + 1] - heatGrid[xi];
+				double hxRight = heatGrid[xi + 2] - heatGrid[xi + 1];
+
+				// Set grid coordinates for the row and the columns
+				// corresponding to the middle, left, and right grid points
+				row.i = xi;
+				row.j = yj;
+				row.k = zk;
+				row.c = 0;
+				for (int l = 0; l < 3; l++) {
+					cols[l] = row;
+				}
+				cols[1].i = xi - 1; // left
+				cols[2].i = xi + 1; // right
+
+				// Heat condition
+				if (xi == surfacePos) {
+					temperatureHandler->computeSplitPartialsForTemperature(vals,
+							hxLeft, hxRight, xi);
+					ierr = MatSetValuesStencil(J, 1, &row, 3, cols, vals,
+							ADD_VALUES);
+					CHKERRQ(ierr);
+				}
+
+				// Boundary conditions
+				if (xi < surfacePos + leftOffset || xi > M - 1 - rightOffset)
+					continue;
+
+				temperatureHandler->computeSplitPartialsForTemperature(vals,
+						hxLeft, hxRight, xi);
+				ierr = MatSetValuesStencil(J, 1, &row, 3, cols, vals,
+						ADD_VALUES);
+				CHKERRQ(ierr);
+			}
+		}
+	}
+
+	ierr = MatAssemblyBegin(J, MAT_FINAL_ASSEMBLY);
+	CHKERRQ(ierr);
+	ierr = MatAssemblyEnd(J, MAT_FINAL_ASSEMBLY);
+	CHKERRQ(ierr);
+	if (A != J) {
+		ierr = MatAssemblyBegin(A, MAT_FINAL_ASSEMBLY);
+		CHKERRQ(ierr);
+		ierr = MatAssemblyEnd(A, MAT_FINAL_ASSEMBLY);
+		CHKERRQ(ierr);
+	}
+
+	PetscFunctionReturn(0);
+}
+
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "advanceHeatSplit")
+/**
+ * This is a post step method that advances the heat equation over the time
+ * step the clusters just took, and copies the new temperature in the
+ * solution. The temperature is thus frozen during each time step of the
+ * clusters and the rates are only recomputed between them. At the first
+ * call the temperature is taken from the solution instead, it did not
+ * change during the time step. It is called by checkTimeStep().
+ */
+PetscErrorCode advanceHeatSplit(TS ts) {
+	// To check PETSc errors
+	PetscErrorCode ierr;
+
+	PetscFunctionBeginUser;
+
+	// Get the time step the clusters just took
+	PetscReal time, prevTime;
+	ierr = TSGetTime(ts, &time);
+	CHKERRQ(ierr);
+	ierr = TSGetPrevTime(ts, &prevTime);
+	CHKERRQ(ierr);
+	Vec solution;
+	ierr = TSGetSolution(ts, &solution);
+	CHKERRQ(ierr);
+
+	// Get the number of degrees of freedom of the clusters
+	DM da;
+	ierr = TSGetDM(ts, &da);
+	CHKERRQ(ierr);
+	PetscInt dof;
+	ierr = DMDAGetInfo(da, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &dof,
+	NULL, NULL, NULL, NULL, NULL);
+	CHKERRQ(ierr);
+
+	// Both vectors have the same local grid points, the temperature
+	// is the last degree of freedom of the solution
+	PetscScalar *concs, *temps;
+	PetscInt nPoints;
+	ierr = VecGetLocalSize(heatSolution, &nPoints);
+	CHKERRQ(ierr);
+	if (heatTime < 0.0) {
+		ierr = VecGetArray(solution, &concs);
+		CHKERRQ(ierr);
+		ierr = VecGetArray(heatSolution, &temps);
+		CHKERRQ(ierr);
+		for (PetscInt p = 0; p < nPoints; p++) {
+			temps[p] = concs[p * dof + dof - 1];
+		}
+		ierr = VecRestoreArray(heatSolution, &temps);
+		CHKERRQ(ierr);
+		ierr = VecRestoreArray(solution, &concs);
+		CHKERRQ(ierr);
+		heatTime = prevTime;
+	}
+
+	if (time <= heatTime)
+		PetscFunctionReturn(0);
+
+	// Advance the heat equation
+	ierr = TSSetTime(heatTS, heatTime);
+	CHKERRQ(ierr);
+	ierr = TSSetTimeStep(heatTS, time - heatTime);
+	CHKERRQ(ierr);
+	ierr = TSSetMaxTime(heatTS, time);
+	CHKERRQ(ierr);
+	ierr = TSSetStepNumber(heatTS, 0);
+	CHKERRQ(ierr);
+	ierr = TSSolve(heatTS, heatSolution);
+	CHKERRQ(ierr);
+
+	// Copy the new temperature in the solution
+	ierr = VecGetArray(solution, &concs);
+	CHKERRQ(ierr);
+	ierr = VecGetArray(heatSolution, &temps);
+	CHKERRQ(ierr);
+	for (PetscInt p = 0; p < nPoints; p++) {
+		concs[p * dof + dof - 1] = temps[p];
+	}
+	ierr = VecRestoreArray(heatSolution, &temps);
+	CHKERRQ(ierr);
+	ierr = VecRestoreArray(solution, &concs);
+	CHKERRQ(ierr);
+
+	heatTime = time;
+
+	// The solution changed, the time stepper must not reuse what it
+	// computed with the previous one (the RHS of FSAL methods)
+	ierr = TSRestartStep(ts);
+	CHKERRQ(ierr);
+
+	PetscFunctionReturn(0);
+}
+
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "setupHeatSplit")
+/**
+ * This operation creates the solve of the heat equation on its own and the
+ * post step advancing it after each time step of the clusters. Its time
+ * stepper takes the options with the prefix -heat_ (backward Euler by
+ * default).
+ *
+ * @param ts The time stepper of the clusters
+ * @return A standard PETSc error code
+ */
+PetscErrorCode setupHeatSplit(TS ts) {
+	PetscErrorCode ierr;
+
+	PetscFunctionBeginUser;
+
+	auto& solverHandler = PetscSolver::getSolverHandler();
+	if (solverHandler.getDimension() == 0) {
+		throw std::string(
+				"\nxolotlSolver::setupHeatSplit: the heat equation needs "
+						"at least one dimension.");
+	}
+	heatGrid = solverHandler.getXGrid();
+
+	// The same grid with only the temperature
+	DM da;
+	ierr = TSGetDM(ts, &da);
+	checkPetscError(ierr, "setupHeatSplit: TSGetDM failed.");
+	ierr = DMDACreateCompatibleDMDA(da, 1, &heatDA);
+	checkPetscError(ierr, "setupHeatSplit: DMDACreateCompatibleDMDA failed.");
+	ierr = DMCreateGlobalVector(heatDA, &heatSolution);
+	checkPetscError(ierr, "setupHeatSplit: DMCreateGlobalVector failed.");
+
+	// Create its time stepper
+	ierr = TSCreate(PETSC_COMM_WORLD, &heatTS);
+	checkPetscError(ierr, "setupHeatSplit: TSCreate failed.");
+	ierr = TSSetOptionsPrefix(heatTS, "heat_");
+	checkPetscError(ierr, "setupHeatSplit: TSSetOptionsPrefix failed.");
+	ierr = TSSetType(heatTS, TSBEULER);
+	checkPetscError(ierr, "setupHeatSplit: TSSetType failed.");
+	ierr = TSSetDM(heatTS, heatDA);
+	checkPetscError(ierr, "setupHeatSplit: TSSetDM failed.");
+	ierr = TSSetProblemType(heatTS, TS_NONLINEAR);
+	checkPetscError(ierr, "setupHeatSplit: TSSetProblemType failed.");
+	ierr = TSSetRHSFunction(heatTS, NULL, heatRHSFunction, NULL);
+	checkPetscError(ierr, "setupHeatSplit: TSSetRHSFunction failed.");
+	ierr = TSSetRHSJacobian(heatTS, NULL, NULL, heatRHSJacobian, NULL);
+	checkPetscError(ierr, "setupHeatSplit: TSSetRHSJacobian failed.");
+	ierr = TSSetExactFinalTime(heatTS, TS_EXACTFINALTIME_MATCHSTEP);
+	checkPetscError(ierr, "setupHeatSplit: TSSetExactFinalTime failed.");
+	ierr = TSSetFromOptions(heatTS);
+	checkPetscError(ierr, "setupHeatSplit: TSSetFromOptions failed.");
+
+	// checkTimeStep() is the only post step, it advances the heat equation
+	ierr = TSSetPostStep(ts, checkTimeStep);
+	checkPetscError(ierr, "setupHeatSplit: TSSetPostStep (checkTimeStep) failed.");
+
+	PetscFunctionReturn(0);
+}
+
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "destroyHeatSplit")
+/**
+ * This operation frees the objects created by setupHeatSplit().
+ *
+ * @return A standard PETSc error code
+ */
+PetscErrorCode destroyHeatSplit() {
+	PetscErrorCode ierr;
+
+	PetscFunctionBeginUser;
+
+	ierr = TSDestroy(&heatTS);
+	CHKERRQ(ierr);
+	ierr = VecDestroy(&heatSolution);
+	CHKERRQ(ierr);
+	ierr = DMDestroy(&heatDA);
+	CHKERRQ(ierr);
+	heatTime = -1.0;
+	heatGrid.clear();
+
+	PetscFunctionReturn(0);
+}
+
+} /* end namespace xolotlSolver */
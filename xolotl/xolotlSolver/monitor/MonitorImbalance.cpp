@@ -0,0 +1,304 @@
+// Includes
+#include "PetscSolver.h"
+#include <xolotlPerf.h>
+#include <petscts.h>
+#include <petscsys.h>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <memory>
+
+namespace xolotlSolver {
+
+//! The name of the file where the imbalance reports are written.
+static const std::string imbalanceFileName = "imbalance.json";
+
+//! The names of the phases in the report and the timers measuring them.
+static std::vector<std::pair<std::string, std::shared_ptr<xolotlPerf::ITimer> > > phaseTimers;
+
+//! The values of the phase timers at the last report.
+static std::vector<double> lastPhaseValues;
+
+//! The timer of the monitors that run between startMonitors and monitorImbalance.
+static std::shared_ptr<xolotlPerf::ITimer> monitorsTimer;
+
+//! The timer of the linear solves.
+static std::shared_ptr<xolotlPerf::ITimer> kspTimer;
+
+//! The number of time steps between two reports.
+static PetscInt imbalanceStride = 10;
+
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "startMonitors")
+/**
+ * This is a monitoring method that starts the timer of the monitors, it is
+ * set before all the other ones.
+ */
+PetscErrorCode startMonitors(TS, PetscInt, PetscReal, Vec, void *) {
+	PetscFunctionBeginUser;
+
+	monitorsTimer->start();
+
+	PetscFunctionReturn(0);
+}
+
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "startKSPTimer")
+/**
+ * This is called by PETSc before each linear solve.
+ */
+PetscErrorCode startKSPTimer(KSP, Vec, Vec, void *) {
+	PetscFunctionBeginUser;
+
+	kspTimer->start();
+
+	PetscFunctionReturn(0);
+}
+
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "stopKSPTimer")
+/**
+ * This is called by PETSc after each linear solve.
+ */
+PetscErrorCode stopKSPTimer(KSP, Vec, Vec, void *) {
+	PetscFunctionBeginUser;
+
+	kspTimer->stop();
+
+	PetscFunctionReturn(0);
+}
+
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "monitorImbalance")
+/**
+ * This is a monitoring method that gathers, every imbalanceStride time steps,
+ * the time spent by each process in each phase since the last report and the
+ * part of the grid it owns. Process 0 appends the report to imbalance.json as
+ * one JSON object per line. It is set after all the other monitors.
+ *
+ * The time a process waits for the slowest one after the RHS function is
+ * not measured, it would need a barrier in each call. It is estimated as the
+ * difference between the largest RHS compute time and its own.
+ */
+PetscErrorCode monitorImbalance(TS ts, PetscInt timestep, PetscReal time, Vec,
+		void *) {
+	// To check PETSc errors
+	PetscErrorCode ierr;
+
+	PetscFunctionBeginUser;
+
+	// The other monitors are done for this time step
+	monitorsTimer->stop();
+
+	// Don't do anything if it is not on the stride
+	if (timestep % imbalanceStride != 0)
+		PetscFunctionReturn(0);
+
+	// Get the number of processes
+	int cwSize;
+	int cwRank;
+	MPI_Comm_size(PETSC_COMM_WORLD, &cwSize);
+	MPI_Comm_rank(PETSC_COMM_WORLD, &cwRank);
+
+	// The time spent in each phase since the last report
+	const int nPhases = phaseTimers.size();
+	std::vector<double> localValues;
+	for (int i = 0; i < nPhases; i++) {
+		double value = phaseTimers[i].second->getValue();
+		localValues.push_back(value - lastPhaseValues[i]);
+		lastPhaseValues[i] = value;
+	}
+
+	// The part of the grid owned by this process
+	DM da;
+	ierr = TSGetDM(ts, &da);
+	CHKERRQ(ierr);
+	PetscInt xs, ys, zs, xm, ym, zm, gxm, gym, gzm;
+	ierr = DMDAGetCorners(da, &xs, &ys, &zs, &xm, &ym, &zm);
+	CHKERRQ(ierr);
+	ierr = DMDAGetGhostCorners(da, NULL, NULL, NULL, &gxm, &gym, &gzm);
+	CHKERRQ(ierr);
+	localValues.push_back(xs);
+	localValues.push_back(ys);
+	localValues.push_back(zs);
+	localValues.push_back(xm);
+	localValues.push_back(ym);
+	localValues.push_back(zm);
+	localValues.push_back(gxm * gym * gzm);
+
+	// Collect everything on process 0
+	const int nValues = localValues.size();
+	std::vector<double> allValues(
+			(cwRank == 0) ? nValues * cwSize : 0);
+	MPI_Gather(localValues.data(), nValues, MPI_DOUBLE, allValues.data(),
+			nValues, MPI_DOUBLE, 0, PETSC_COMM_WORLD);
+
+	if (cwRank == 0) {
+		std::ofstream outputFile;
+		outputFile.open(imbalanceFileName, std::ios::app);
+		outputFile << "{\"step\":" << timestep << ",\"time\":" << time
+				<< ",\"ranks\":" << cwSize << ",\"phases\":{";
+
+		// The values of each phase per process, with the estimated wait
+		std::vector<std::pair<std::string, std::vector<double> > > phases;
+		for (int i = 0; i < nPhases; i++) {
+			std::vector<double> perRank;
+			for (int r = 0; r < cwSize; r++)
+				perRank.push_back(allValues[r * nValues + i]);
+			phases.emplace_back(phaseTimers[i].first, perRank);
+		}
+		// rhsCompute is the first phase
+		auto const& rhsCompute = phases[0].second;
+		double maxCompute = *std::max_element(rhsCompute.begin(),
+				rhsCompute.end());
+		std::vector<double> waits;
+		for (int r = 0; r < cwSize; r++)
+			waits.push_back(maxCompute - rhsCompute[r]);
+		phases.emplace_back("collectiveWait", waits);
+
+		// Statistics of each phase
+		std::string worstPhase;
+		double worstImbalance = 0.0;
+		for (std::size_t i = 0; i < phases.size(); i++) {
+			auto const& perRank = phases[i].second;
+			double minValue = perRank[0], maxValue = perRank[0], sum = 0.0;
+			for (auto value : perRank) {
+				minValue = std::min(minValue, value);
+				maxValue = std::max(maxValue, value);
+				sum += value;
+			}
+			double avgValue = sum / (double) cwSize;
+			// The ratio of the slowest process to the average one
+			double imbalance = (avgValue > 0.0) ? maxValue / avgValue : 1.0;
+			if (imbalance > worstImbalance) {
+				worstImbalance = imbalance;
+				worstPhase = phases[i].first;
+			}
+
+			outputFile << ((i > 0) ? "," : "") << "\"" << phases[i].first
+					<< "\":{\"min\":" << minValue << ",\"max\":" << maxValue
+					<< ",\"avg\":" << avgValue << ",\"imbalance\":"
+					<< imbalance << ",\"perRank\":[";
+			for (int r = 0; r < cwSize; r++) {
+				outputFile << ((r > 0) ? "," : "") << perRank[r];
+			}
+			outputFile << "]}";
+		}
+
+		// Grid ownership of each process
+		outputFile << "},\"ownership\":[";
+		for (int r = 0; r < cwSize; r++) {
+			auto rankValues = allValues.data() + r * nValues + nPhases;
+			int points = (int) (rankValues[3] * rankValues[4] * rankValues[5]);
+			outputFile << ((r > 0) ? "," : "") << "{\"rank\":" << r
+					<< ",\"start\":[" << (int) rankValues[0] << ","
+					<< (int) rankValues[1] << "," << (int) rankValues[2]
+					<< "],\"size\":[" << (int) rankValues[3] << ","
+					<< (int) rankValues[4] << "," << (int) rankValues[5]
+					<< "],\"points\":" << points << ",\"ghostedPoints\":"
+					<< (int) rankValues[6] << "}";
+		}
+		outputFile << "]}" << std::endl;
+		outputFile.close();
+
+		std::cout << "Imbalance at step " << timestep << ": " << worstPhase
+				<< " (max/avg = " << worstImbalance << ")" << std::endl;
+	}
+
+	PetscFunctionReturn(0);
+}
+
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "setupImbalanceStart")
+/**
+ * This operation sets the monitor starting the timer of the monitors, it must
+ * be called before the other monitors are set.
+ *
+ * @param ts The time stepper
+ * @return A standard PETSc error code
+ */
+PetscErrorCode setupImbalanceStart(TS ts) {
+	PetscErrorCode ierr;
+
+	PetscFunctionBeginUser;
+
+	ierr = TSMonitorSet(ts, startMonitors, NULL, NULL);
+	checkPetscError(ierr,
+			"setupImbalanceStart: TSMonitorSet (startMonitors) failed.");
+
+	PetscFunctionReturn(0);
+}
+
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "setupImbalanceReport")
+/**
+ * This operation sets the monitor writing the imbalance report, it must be
+ * called after the other monitors are set. The report is written every
+ * -imbalance_report time steps (10 by default).
+ *
+ * @param ts The time stepper
+ * @param dim The number of dimensions of the problem
+ * @param registry The performance handler registry
+ * @return A standard PETSc error code
+ */
+PetscErrorCode setupImbalanceReport(TS ts, int dim,
+		std::shared_ptr<xolotlPerf::IHandlerRegistry> registry) {
+	PetscErrorCode ierr;
+
+	PetscFunctionBeginUser;
+
+	// Get the stride
+	ierr = PetscOptionsGetInt(NULL, NULL, "-imbalance_report",
+			&imbalanceStride, NULL);
+	checkPetscError(ierr,
+			"setupImbalanceReport: PetscOptionsGetInt (-imbalance_report) failed.");
+	if (imbalanceStride < 1)
+		imbalanceStride = 10;
+
+	// Time the linear solves
+	SNES snes;
+	ierr = TSGetSNES(ts, &snes);
+	checkPetscError(ierr, "setupImbalanceReport: TSGetSNES failed.");
+	KSP ksp;
+	ierr = SNESGetKSP(snes, &ksp);
+	checkPetscError(ierr, "setupImbalanceReport: SNESGetKSP failed.");
+	kspTimer = registry->getTimer("KSPSolve");
+	ierr = KSPSetPreSolve(ksp, startKSPTimer, NULL);
+	checkPetscError(ierr, "setupImbalanceReport: KSPSetPreSolve failed.");
+	ierr = KSPSetPostSolve(ksp, stopKSPTimer, NULL);
+	checkPetscError(ierr, "setupImbalanceReport: KSPSetPostSolve failed.");
+
+	// The phases of the report
+	monitorsTimer = registry->getTimer("monitors");
+	phaseTimers.clear();
+	phaseTimers.emplace_back("rhsCompute", registry->getTimer("RHSCompute"));
+	phaseTimers.emplace_back("ghostExchange",
+			registry->getTimer("ghostExchange"));
+	phaseTimers.emplace_back("jacobianAssembly",
+			registry->getTimer("JacobianAssembly"));
+	phaseTimers.emplace_back("ksp", kspTimer);
+	phaseTimers.emplace_back("monitors", monitorsTimer);
+	phaseTimers.emplace_back("checkpoint",
+			registry->getTimer(
+					"monitor" + std::to_string(dim) + "D:startStop"));
+	lastPhaseValues.assign(phaseTimers.size(), 0.0);
+
+	// Clear the report file
+	int procId;
+	MPI_Comm_rank(PETSC_COMM_WORLD, &procId);
+	if (procId == 0) {
+		std::ofstream outputFile;
+		outputFile.open(imbalanceFileName);
+		outputFile.close();
+	}
+
+	ierr = TSMonitorSet(ts, monitorImbalance, NULL, NULL);
+	checkPetscError(ierr,
+			"setupImbalanceReport: TSMonitorSet (monitorImbalance) failed.");
+
+	PetscFunctionReturn(0);
+}
+
+} /* end namespace xolotlSolver */
@@ -0,0 +1,93 @@
+// Includes
+#include "PetscSolver.h"
+#include <petscts.h>
+#include <petscsys.h>
+#include <array>
+#include <iostream>
+
+namespace xolotlSolver {
+
+//! The range of the active dissociation fractions at the last report.
+static std::array<double, 2> lastActiveRange = { -1.0, -1.0 };
+
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "monitorPruning")
+/**
+ * This is a monitoring method that prints the fraction of the dissociations
+ * that are active, whenever it changed since the last time step. Each process
+ * prunes the reactions from the temperatures of its own grid points, so the
+ * smallest and largest fractions over all the processes are printed.
+ */
+PetscErrorCode monitorPruning(TS, PetscInt timestep, PetscReal time, Vec,
+		void *) {
+	PetscFunctionBeginUser;
+
+	// Get the fraction on this process
+	auto& network = PetscSolver::getSolverHandler().getNetwork();
+	double fraction = network.getActiveDissociationFraction();
+
+	// The range over all the processes
+	// (the largest one is negated to reduce both with MPI_MIN)
+	std::array<double, 2> localRange = { fraction, -fraction };
+	std::array<double, 2> range;
+	MPI_Allreduce(localRange.data(), range.data(), 2, MPI_DOUBLE, MPI_MIN,
+			PETSC_COMM_WORLD);
+	range[1] = -range[1];
+
+	// Don't do anything if it did not change
+	if (range == lastActiveRange)
+		PetscFunctionReturn(0);
+	lastActiveRange = range;
+
+	int procId;
+	MPI_Comm_rank(PETSC_COMM_WORLD, &procId);
+	if (procId == 0) {
+		std::cout << "Active dissociations at step " << timestep << " (time "
+				<< time << " s): " << range[0] * 100.0;
+		if (range[1] > range[0])
+			std::cout << " to " << range[1] * 100.0;
+		std::cout << " %" << std::endl;
+	}
+
+	PetscFunctionReturn(0);
+}
+
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "setupPruning")
+/**
+ * This operation sets the threshold of the dissociation pruning from the
+ * option -prune_threshold and the monitor reporting the fraction of the
+ * dissociations that are active. It must be called before the initial
+ * conditions are set, the first rates being computed there.
+ *
+ * @param ts The time stepper
+ * @return A standard PETSc error code
+ */
+PetscErrorCode setupPruning(TS ts) {
+	PetscErrorCode ierr;
+
+	PetscFunctionBeginUser;
+
+	// Get the threshold
+	PetscReal threshold = 0.0;
+	ierr = PetscOptionsGetReal(NULL, NULL, "-prune_threshold", &threshold,
+			NULL);
+	checkPetscError(ierr,
+			"setupPruning: PetscOptionsGetReal (-prune_threshold) failed.");
+	if (threshold < 0.0)
+		threshold = 0.0;
+
+	auto& network = PetscSolver::getSolverHandler().getNetwork();
+	network.setPruningThreshold(threshold);
+
+	// Nothing to report without pruning
+	if (threshold == 0.0)
+		PetscFunctionReturn(0);
+
+	ierr = TSMonitorSet(ts, monitorPruning, NULL, NULL);
+	checkPetscError(ierr, "setupPruning: TSMonitorSet (monitorPruning) failed.");
+
+	PetscFunctionReturn(0);
+}
+
+} /* end namespace xolotlSolver */
@@ -0,0 +1,357 @@
+// Includes
+#include "BlockJacobiPreconditioner.h"
+#include "PetscSolver.h"
+#include <algorithm>
+#include <cmath>
+
+namespace xolotlSolver {
+
+BlockJacobiPreconditioner::BlockJacobiPreconditioner(int _dof,
+		std::shared_ptr<xolotlPerf::IHandlerRegistry> registry) :
+		dof(_dof), nSweeps(0), reuseTolerance(1.0e-2), hasSymbolic(false), nPoints(
+				0), work(NULL), op(NULL), fallback(NULL), useFallback(false) {
+	setUpTimer = registry->getTimer("blockPC:setUp");
+	applyTimer = registry->getTimer("blockPC:apply");
+	factorCounter = registry->getEventCounter("blockPC:factor");
+	fallbackCounter = registry->getEventCounter("blockPC:fallback");
+}
+
+BlockJacobiPreconditioner::~BlockJacobiPreconditioner() {
+	if (work)
+		VecDestroy(&work);
+	if (fallback)
+		PCDestroy(&fallback);
+}
+
+PetscErrorCode BlockJacobiPreconditioner::computeSymbolic(Mat P,
+		PetscInt rstart) {
+	PetscErrorCode ierr;
+	PetscInt ncols;
+	const PetscInt *cols;
+	const PetscScalar *vals;
+
+	// Gather the pattern of all the local blocks
+	std::vector<std::vector<int> > pattern(dof);
+	for (int p = 0; p < nPoints; p++) {
+		PetscInt blockStart = rstart + p * dof;
+		for (int c = 0; c < dof; c++) {
+			ierr = MatGetRow(P, blockStart + c, &ncols, &cols, &vals);
+			CHKERRQ(ierr);
+			for (int l = 0; l < ncols; l++) {
+				if (cols[l] >= blockStart && cols[l] < blockStart + dof)
+					pattern[c].push_back(cols[l] - blockStart);
+			}
+			ierr = MatRestoreRow(P, blockStart + c, &ncols, &cols, &vals);
+			CHKERRQ(ierr);
+		}
+	}
+
+	// Remove the duplicates
+	for (auto& row : pattern) {
+		std::sort(row.begin(), row.end());
+		row.erase(std::unique(row.begin(), row.end()), row.end());
+	}
+
+	// Compute the symbolic factorization
+	lu.symbolic(dof, pattern);
+	hasSymbolic = true;
+
+	// All the factors have to be recomputed
+	factors.assign(nPoints * lu.getNumberOfNonZeros(), 0.0);
+	factoredVals.assign(nPoints * lu.getNumberOfNonZeros(), 0.0);
+	isFactored.assign(nPoints, false);
+
+	return 0;
+}
+
+PetscErrorCode BlockJacobiPreconditioner::setUp(Mat A, Mat P) {
+	PetscErrorCode ierr;
+
+	// Start the timer
+	xolotlPerf::ScopedTimer myTimer(setUpTimer);
+
+	// Keep the operator for the sweeps
+	op = A;
+
+	// Get the local rows
+	PetscInt rstart, rend;
+	ierr = MatGetOwnershipRange(P, &rstart, &rend);
+	CHKERRQ(ierr);
+	int localPoints = (rend - rstart) / dof;
+
+	// Compute the symbolic factorization the first time or if the number of
+	// local grid points changed
+	if (!hasSymbolic || localPoints != nPoints) {
+		nPoints = localPoints;
+		ierr = computeSymbolic(P, rstart);
+		CHKERRQ(ierr);
+	}
+
+	// Loop on the local grid points
+	int nnz = lu.getNumberOfNonZeros();
+	std::vector<double> blockVals(nnz, 0.0);
+	PetscInt ncols;
+	const PetscInt *cols;
+	const PetscScalar *vals;
+	bool factorFailed = false;
+	for (int p = 0; p < nPoints; p++) {
+		PetscInt blockStart = rstart + p * dof;
+		std::fill(blockVals.begin(), blockVals.end(), 0.0);
+		bool newEntry = false;
+
+		// Copy the block
+		for (int c = 0; c < dof; c++) {
+			ierr = MatGetRow(P, blockStart + c, &ncols, &cols, &vals);
+			CHKERRQ(ierr);
+			for (int l = 0; l < ncols; l++) {
+				if (cols[l] < blockStart || cols[l] >= blockStart + dof)
+					continue;
+				int col = cols[l] - blockStart;
+				int pos = lu.find(c, col);
+				if (pos < 0) {
+					newEntry = true;
+					break;
+				}
+				blockVals[pos] = vals[l];
+			}
+			ierr = MatRestoreRow(P, blockStart + c, &ncols, &cols, &vals);
+			CHKERRQ(ierr);
+			if (newEntry)
+				break;
+		}
+
+		// The pattern changed, start again with a new symbolic factorization
+		if (newEntry) {
+			ierr = computeSymbolic(P, rstart);
+			CHKERRQ(ierr);
+			nnz = lu.getNumberOfNonZeros();
+			blockVals.assign(nnz, 0.0);
+			p = -1;
+			continue;
+		}
+
+		// Check if the factors can be reused
+		double *oldVals = &factoredVals[p * nnz];
+		bool refactor = !isFactored[p];
+		for (int l = 0; l < nnz && !refactor; l++) {
+			if (std::fabs(blockVals[l] - oldVals[l])
+					> reuseTolerance * std::fabs(oldVals[l]))
+				refactor = true;
+		}
+		if (!refactor)
+			continue;
+
+		// Factorize
+		double *blockFactors = &factors[p * nnz];
+		std::copy(blockVals.begin(), blockVals.end(), blockFactors);
+		factorCounter->increment();
+		if (!lu.factor(blockFactors)) {
+			isFactored[p] = false;
+			factorFailed = true;
+			break;
+		}
+		std::copy(blockVals.begin(), blockVals.end(), oldVals);
+		isFactored[p] = true;
+	}
+
+	// Every process has to use the fallback if one block could not be
+	// factorized, its setup is collective
+	MPI_Comm comm;
+	ierr = PetscObjectGetComm((PetscObject) P, &comm);
+	CHKERRQ(ierr);
+	int anyFailed = factorFailed ? 1 : 0;
+	MPI_Allreduce(MPI_IN_PLACE, &anyFailed, 1, MPI_INT, MPI_MAX, comm);
+	useFallback = (anyFailed > 0);
+	if (useFallback) {
+		if (!fallback) {
+			ierr = PCCreate(comm, &fallback);
+			CHKERRQ(ierr);
+			ierr = PCSetType(fallback, PCBJACOBI);
+			CHKERRQ(ierr);
+		}
+		ierr = PCSetOperators(fallback, A, P);
+		CHKERRQ(ierr);
+		ierr = PCSetUp(fallback);
+		CHKERRQ(ierr);
+		fallbackCounter->increment();
+	}
+
+	return 0;
+}
+
+void BlockJacobiPreconditioner::blockSolve(PetscScalar *y) const {
+	int nnz = lu.getNumberOfNonZeros();
+	for (int p = 0; p < nPoints; p++) {
+		lu.solve(&factors[p * nnz], y + p * dof);
+	}
+
+	return;
+}
+
+PetscErrorCode BlockJacobiPreconditioner::apply(Vec x, Vec y) {
+	PetscErrorCode ierr;
+	PetscScalar *array;
+
+	// Start the timer
+	xolotlPerf::ScopedTimer myTimer(applyTimer);
+
+	// Some blocks could not be factorized
+	if (useFallback) {
+		ierr = PCApply(fallback, x, y);
+		CHKERRQ(ierr);
+		return 0;
+	}
+
+	// y = D^-1 x
+	ierr = VecCopy(x, y);
+	CHKERRQ(ierr);
+	ierr = VecGetArray(y, &array);
+	CHKERRQ(ierr);
+	blockSolve(array);
+	ierr = VecRestoreArray(y, &array);
+	CHKERRQ(ierr);
+
+	// Extra sweeps to account for the coupling between grid points
+	if (nSweeps > 0 && !work) {
+		ierr = VecDuplicate(x, &work);
+		CHKERRQ(ierr);
+	}
+	for (int i = 0; i < nSweeps; i++) {
+		// work = x - A y
+		ierr = MatMult(op, y, work);
+		CHKERRQ(ierr);
+		ierr = VecAYPX(work, -1.0, x);
+		CHKERRQ(ierr);
+		// y = y + D^-1 work
+		ierr = VecGetArray(work, &array);
+		CHKERRQ(ierr);
+		blockSolve(array);
+		ierr = VecRestoreArray(work, &array);
+		CHKERRQ(ierr);
+		ierr = VecAXPY(y, 1.0, work);
+		CHKERRQ(ierr);
+	}
+
+	return 0;
+}
+
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "blockPCSetUp")
+/**
+ * The setup callback of the shell preconditioner.
+ */
+static PetscErrorCode blockPCSetUp(PC pc) {
+	PetscErrorCode ierr;
+	PetscFunctionBeginUser;
+
+	void *ctx;
+	ierr = PCShellGetContext(pc, &ctx);
+	CHKERRQ(ierr);
+	Mat A, P;
+	ierr = PCGetOperators(pc, &A, &P);
+	CHKERRQ(ierr);
+	ierr = static_cast<BlockJacobiPreconditioner *>(ctx)->setUp(A, P);
+	CHKERRQ(ierr);
+
+	PetscFunctionReturn(0);
+}
+
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "blockPCApply")
+/**
+ * The apply callback of the shell preconditioner.
+ */
+static PetscErrorCode blockPCApply(PC pc, Vec x, Vec y) {
+	PetscErrorCode ierr;
+	PetscFunctionBeginUser;
+
+	void *ctx;
+	ierr = PCShellGetContext(pc, &ctx);
+	CHKERRQ(ierr);
+	ierr = static_cast<BlockJacobiPreconditioner *>(ctx)->apply(x, y);
+	CHKERRQ(ierr);
+
+	PetscFunctionReturn(0);
+}
+
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "blockPCDestroy")
+/**
+ * The destroy callback of the shell preconditioner.
+ */
+static PetscErrorCode blockPCDestroy(PC pc) {
+	PetscErrorCode ierr;
+	PetscFunctionBeginUser;
+
+	void *ctx;
+	ierr = PCShellGetContext(pc, &ctx);
+	CHKERRQ(ierr);
+	delete static_cast<BlockJacobiPreconditioner *>(ctx);
+
+	PetscFunctionReturn(0);
+}
+
+#undef __FUNCT__
+#define __FUNCT__ Actual__FUNCT__("xolotlSolver", "setupBlockPreconditioner")
+PetscErrorCode setupBlockPreconditioner(TS ts, int dof,
+		std::shared_ptr<xolotlPerf::IHandlerRegistry> registry) {
+	PetscErrorCode ierr;
+	PetscFunctionBeginUser;
+
+	// Check the option -block_pc
+	PetscBool flag;
+	ierr = PetscOptionsHasName(NULL, NULL, "-block_pc", &flag);
+	checkPetscError(ierr,
+			"setupBlockPreconditioner: PetscOptionsHasName (-block_pc) failed.");
+	if (!flag)
+		PetscFunctionReturn(0);
+
+	// Create the context
+	auto context = new BlockJacobiPreconditioner(dof, registry);
+
+	// Read the number of sweeps
+	PetscInt nSweeps = 0;
+	ierr = PetscOptionsGetInt(NULL, NULL, "-block_pc_sweeps", &nSweeps, &flag);
+	checkPetscError(ierr,
+			"setupBlockPreconditioner: PetscOptionsGetInt (-block_pc_sweeps) failed.");
+	if (flag)
+		context->setNumberOfSweeps(nSweeps);
+
+	// Read the reuse tolerance
+	PetscReal tol = 0.0;
+	ierr = PetscOptionsGetReal(NULL, NULL, "-block_pc_reuse_tol", &tol, &flag);
+	checkPetscError(ierr,
+			"setupBlockPreconditioner: PetscOptionsGetReal (-block_pc_reuse_tol) failed.");
+	if (flag)
+		context->setReuseTolerance(tol);
+
+	// Get the preconditioner
+	SNES snes;
+	ierr = TSGetSNES(ts, &snes);
+	checkPetscError(ierr, "setupBlockPreconditioner: TSGetSNES failed.");
+	KSP ksp;
+	ierr = SNESGetKSP(snes, &ksp);
+	checkPetscError(ierr, "setupBlockPreconditioner: SNESGetKSP failed.");
+	PC pc;
+	ierr = KSPGetPC(ksp, &pc);
+	checkPetscError(ierr, "setupBlockPreconditioner: KSPGetPC failed.");
+
+	// Replace it by the shell preconditioner
+	ierr = PCSetType(pc, PCSHELL);
+	checkPetscError(ierr, "setupBlockPreconditioner: PCSetType failed.");
+	ierr = PCShellSetContext(pc, context);
+	checkPetscError(ierr, "setupBlockPreconditioner: PCShellSetContext failed.");
+	ierr = PCShellSetSetUp(pc, blockPCSetUp);
+	checkPetscError(ierr, "setupBlockPreconditioner: PCShellSetSetUp failed.");
+	ierr = PCShellSetApply(pc, blockPCApply);
+	checkPetscError(ierr, "setupBlockPreconditioner: PCShellSetApply failed.");
+	ierr = PCShellSetDestroy(pc, blockPCDestroy);
+	checkPetscError(ierr,
+			"setupBlockPreconditioner: PCShellSetDestroy failed.");
+	ierr = PCShellSetName(pc, "xolotl reaction block-Jacobi");
+	checkPetscError(ierr, "setupBlockPreconditioner: PCShellSetName failed.");
+
+	PetscFunctionReturn(0);
+}
+
+} /* end namespace xolotlSolver */
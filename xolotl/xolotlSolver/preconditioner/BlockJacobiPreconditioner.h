@@ -0,0 +1,175 @@
+#ifndef XSOLVER_BLOCKJACOBIPRECONDITIONER_H
+#define XSOLVER_BLOCKJACOBIPRECONDITIONER_H
+
+// Includes
+#include <petscts.h>
+#include <petscksp.h>
+#include <vector>
+#include <memory>
+#include <SparseLU.h>
+#include <xolotlPerf.h>
+
+namespace xolotlSolver {
+
+/**
+ * This class is a PETSc shell preconditioner that uses the reaction block
+ * of each grid point, which is the dof x dof diagonal block of the Jacobian,
+ * as a block-Jacobi preconditioner.
+ *
+ * The blocks are factorized with a sparse LU whose symbolic part is shared
+ * by all the grid points. The numeric factorization of a grid point is only
+ * recomputed when an entry of its block changed by more than a relative
+ * tolerance since the last factorization, otherwise the old factors are
+ * reused. The LU has no pivoting: if a block has a zero or tiny pivot, the
+ * default block-Jacobi preconditioner of PETSc is used instead until the
+ * next setup.
+ *
+ * Optionally, a few Jacobi sweeps with the full operator are applied after
+ * the block solve to account for the coupling between grid points
+ * (diffusion and advection).
+ *
+ * It is enabled with the PETSc option -block_pc, -block_pc_sweeps <n>
+ * sets the number of extra sweeps (0 by default) and -block_pc_reuse_tol <r>
+ * sets the relative tolerance for reusing the factors (1.0e-2 by default).
+ */
+class BlockJacobiPreconditioner {
+private:
+
+	//! The number of degrees of freedom at each grid point.
+	int dof;
+
+	//! The number of extra sweeps using the full operator.
+	int nSweeps;
+
+	//! The relative tolerance on the change of the values to reuse the factors.
+	double reuseTolerance;
+
+	//! The symbolic factorization shared by all the grid points.
+	SparseLU lu;
+
+	//! Whether the symbolic factorization was computed.
+	bool hasSymbolic;
+
+	//! The number of local grid points.
+	int nPoints;
+
+	//! The factors of each local grid point, stored one after the other.
+	std::vector<double> factors;
+
+	//! The values of each block at the time it was last factorized.
+	std::vector<double> factoredVals;
+
+	//! Whether each local grid point has valid factors.
+	std::vector<bool> isFactored;
+
+	//! The work vector used by the sweeps.
+	Vec work;
+
+	//! The operator used by the sweeps.
+	Mat op;
+
+	//! The preconditioner used when a block cannot be factorized.
+	PC fallback;
+
+	//! Whether the fallback preconditioner is used since the last setup.
+	bool useFallback;
+
+	//! The timer for the setup.
+	std::shared_ptr<xolotlPerf::ITimer> setUpTimer;
+
+	//! The timer for the application.
+	std::shared_ptr<xolotlPerf::ITimer> applyTimer;
+
+	//! The counter for the number of block factorizations.
+	std::shared_ptr<xolotlPerf::IEventCounter> factorCounter;
+
+	//! The counter for the number of setups using the fallback.
+	std::shared_ptr<xolotlPerf::IEventCounter> fallbackCounter;
+
+	/**
+	 * Compute the symbolic factorization from the union of the block
+	 * patterns of all the local grid points.
+	 *
+	 * @param P The matrix used to build the preconditioner
+	 * @param rstart The first local row
+	 * @return The PETSc error code
+	 */
+	PetscErrorCode computeSymbolic(Mat P, PetscInt rstart);
+
+	/**
+	 * Apply the block solve y = D^-1 x in place on the local array.
+	 *
+	 * @param y The array to solve in place
+	 */
+	void blockSolve(PetscScalar *y) const;
+
+public:
+
+	/**
+	 * The constructor.
+	 *
+	 * @param _dof The number of degrees of freedom at each grid point
+	 * @param registry The performance handler registry
+	 */
+	BlockJacobiPreconditioner(int _dof,
+			std::shared_ptr<xolotlPerf::IHandlerRegistry> registry);
+
+	/**
+	 * The destructor.
+	 */
+	~BlockJacobiPreconditioner();
+
+	/**
+	 * Set the number of extra sweeps using the full operator.
+	 *
+	 * @param n The number of sweeps
+	 */
+	void setNumberOfSweeps(int n) {
+		nSweeps = n;
+	}
+
+	/**
+	 * Set the relative tolerance on the change of the values to reuse the
+	 * factors.
+	 *
+	 * @param tol The tolerance
+	 */
+	void setReuseTolerance(double tol) {
+		reuseTolerance = tol;
+	}
+
+	/**
+	 * Update the factors from the new preconditioning matrix.
+	 *
+	 * @param A The operator
+	 * @param P The matrix used to build the preconditioner
+	 * @return The PETSc error code
+	 */
+	PetscErrorCode setUp(Mat A, Mat P);
+
+	/**
+	 * Apply the preconditioner.
+	 *
+	 * @param x The input vector
+	 * @param y The output vector
+	 * @return The PETSc error code
+	 */
+	PetscErrorCode apply(Vec x, Vec y);
+};
+//end class BlockJacobiPreconditioner
+
+/**
+ * Replace the preconditioner of the linear solver used by the given time
+ * stepper by the block-Jacobi shell preconditioner if the -block_pc option
+ * is given, this has to be called after TSSetFromOptions.
+ *
+ * @param ts The time stepper
+ * @param dof The number of degrees of freedom at each grid point
+ * @param registry The performance handler registry
+ * @return The PETSc error code
+ */
+PetscErrorCode setupBlockPreconditioner(TS ts, int dof,
+		std::shared_ptr<xolotlPerf::IHandlerRegistry> registry);
+
+} /* end namespace xolotlSolver */
+#endif
@@ -0,0 +1,124 @@
+// Includes
+#include "SparseLU.h"
+#include <set>
+#include <algorithm>
+#include <cmath>
+
+namespace xolotlSolver {
+
+//! The size relative to the largest entry of its row under which a pivot
+//! is considered zero.
+static const double pivotTolerance = 1.0e-12;
+
+void SparseLU::symbolic(int size,
+		const std::vector<std::vector<int> >& pattern) {
+	// Reset everything
+	n = size;
+	rowStart.assign(n + 1, 0);
+	colIndices.clear();
+	diagIdx.assign(n, 0);
+	work.assign(n, 0.0);
+
+	// The rows of U that are already known, needed to compute the fill-in
+	std::vector<std::vector<int> > upperRows(n);
+
+	// Loop on the rows
+	const int nPatternRows = pattern.size();
+	for (int i = 0; i < n; i++) {
+		// Start with the pattern of the matrix and the diagonal
+		std::set<int> rowSet;
+		if (i < nPatternRows)
+			rowSet.insert(pattern[i].begin(), pattern[i].end());
+		rowSet.insert(i);
+
+		// Eliminate with the previous rows in increasing order, the columns
+		// that are added are always greater than the current one so the
+		// iterator stays valid and picks them up
+		for (auto it = rowSet.begin(); it != rowSet.end() && *it < i; ++it) {
+			auto const& upper = upperRows[*it];
+			rowSet.insert(upper.begin(), upper.end());
+		}
+
+		// Save the row
+		rowStart[i] = colIndices.size();
+		for (auto col : rowSet) {
+			if (col == i)
+				diagIdx[i] = colIndices.size();
+			if (col > i)
+				upperRows[i].push_back(col);
+			colIndices.push_back(col);
+		}
+	}
+	rowStart[n] = colIndices.size();
+
+	return;
+}
+
+int SparseLU::find(int row, int col) const {
+	auto begin = colIndices.begin() + rowStart[row];
+	auto end = colIndices.begin() + rowStart[row + 1];
+	auto iter = std::lower_bound(begin, end, col);
+	if (iter == end || *iter != col)
+		return -1;
+
+	return iter - colIndices.begin();
+}
+
+bool SparseLU::factor(double * vals) const {
+	// Loop on the rows
+	for (int i = 0; i < n; i++) {
+		// Scatter the row in the dense work array
+		double rowMax = 0.0;
+		for (int l = rowStart[i]; l < rowStart[i + 1]; l++) {
+			work[colIndices[l]] = vals[l];
+			rowMax = std::max(rowMax, std::fabs(vals[l]));
+		}
+
+		// Eliminate with the previous rows
+		for (int l = rowStart[i]; l < diagIdx[i]; l++) {
+			int k = colIndices[l];
+			// The multiplier
+			double factor = work[k] / vals[diagIdx[k]];
+			work[k] = factor;
+			// Update the rest of the row with the upper part of row k
+			for (int m = diagIdx[k] + 1; m < rowStart[k + 1]; m++) {
+				work[colIndices[m]] -= factor * vals[m];
+			}
+		}
+
+		// A zero or tiny pivot would need pivoting
+		if (std::fabs(work[i]) <= pivotTolerance * rowMax)
+			return false;
+
+		// Gather the row back
+		for (int l = rowStart[i]; l < rowStart[i + 1]; l++) {
+			vals[l] = work[colIndices[l]];
+		}
+	}
+
+	return true;
+}
+
+void SparseLU::solve(const double * vals, double * x) const {
+	// Forward substitution with L (unit diagonal)
+	for (int i = 0; i < n; i++) {
+		double sum = x[i];
+		for (int l = rowStart[i]; l < diagIdx[i]; l++) {
+			sum -= vals[l] * x[colIndices[l]];
+		}
+		x[i] = sum;
+	}
+
+	// Backward substitution with U
+	for (int i = n - 1; i >= 0; i--) {
+		double sum = x[i];
+		for (int l = diagIdx[i] + 1; l < rowStart[i + 1]; l++) {
+			sum -= vals[l] * x[colIndices[l]];
+		}
+		x[i] = sum / vals[diagIdx[i]];
+	}
+
+	return;
+}
+
+} /* end namespace xolotlSolver */
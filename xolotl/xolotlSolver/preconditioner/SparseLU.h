@@ -0,0 +1,119 @@
+#ifndef XSOLVER_SPARSELU_H
+#define XSOLVER_SPARSELU_H
+
+// Includes
+#include <vector>
+
+namespace xolotlSolver {
+
+/**
+ * This class computes and applies the LU factorization of a small sparse
+ * square matrix without pivoting. It is used for the reaction block at one
+ * grid point, whose sparsity is the same at every grid point and does not
+ * change during the simulation.
+ *
+ * The symbolic factorization (the pattern of L and U, including the fill-in)
+ * is computed once from the pattern of the matrix. Then the numeric
+ * factorization can be computed many times on matrices with the same pattern,
+ * and the factors of different grid points are simply stored in separate
+ * value arrays that all share the same symbolic data.
+ */
+class SparseLU {
+private:
+
+	//! The number of rows (and columns) of the matrix.
+	int n;
+
+	//! The starting index of each row in the factor arrays (size n + 1).
+	std::vector<int> rowStart;
+
+	//! The column indices of the factors, sorted in each row.
+	std::vector<int> colIndices;
+
+	//! The location of the diagonal of each row in the factor arrays.
+	std::vector<int> diagIdx;
+
+	/**
+	 * A dense row used while doing the numeric factorization. Only the
+	 * entries in the pattern of the current row are meaningful.
+	 */
+	mutable std::vector<double> work;
+
+public:
+
+	/**
+	 * The default constructor, creates an empty factorization.
+	 */
+	SparseLU() :
+			n(0) {
+	}
+
+	/**
+	 * The destructor.
+	 */
+	~SparseLU() {
+	}
+
+	/**
+	 * Compute the symbolic factorization from the pattern of the matrix.
+	 * The diagonal is always added to the pattern.
+	 *
+	 * @param size The number of rows of the matrix
+	 * @param pattern The column indices of the non-zero entries of each row
+	 */
+	void symbolic(int size, const std::vector<std::vector<int> >& pattern);
+
+	/**
+	 * Get the number of rows of the factorized matrix.
+	 *
+	 * @return The size
+	 */
+	int size() const {
+		return n;
+	}
+
+	/**
+	 * Get the number of entries in L + U, which is also the size of the value
+	 * arrays needed by factor() and solve().
+	 *
+	 * @return The number of non-zeros
+	 */
+	int getNumberOfNonZeros() const {
+		return colIndices.size();
+	}
+
+	/**
+	 * Get the position of an entry in the value array.
+	 *
+	 * @param row The row of the entry
+	 * @param col The column of the entry
+	 * @return The position, or -1 if the entry is not in the pattern
+	 */
+	int find(int row, int col) const;
+
+	/**
+	 * Compute the numeric factorization in place. The value array has to be
+	 * filled with the entries of the matrix at the positions given by find(),
+	 * and with 0.0 everywhere else, before calling this method.
+	 *
+	 * There is no pivoting: the factorization stops on a zero pivot or on
+	 * one that is tiny compared to the largest entry of its row in the
+	 * matrix, and the value array is then not usable.
+	 *
+	 * @param vals The values of the matrix, replaced by the values of L and U
+	 * @return False if the factorization stopped on a zero or tiny pivot
+	 */
+	bool factor(double * vals) const;
+
+	/**
+	 * Solve LU x = b in place.
+	 *
+	 * @param vals The values of L and U computed by factor()
+	 * @param x The right hand side, replaced by the solution
+	 */
+	void solve(const double * vals, double * x) const;
+};
+//end class SparseLU
+
+} /* end namespace xolotlSolver */
+#endif
@@ -2,6 +2,9 @@
 #include <PetscSolver0DHandler.h>
 #include <MathUtils.h>
 #include <Constants.h>
+#include "xolotlCore/io/MPIUtils.h"
+#include <fstream>
+#include <sstream>
 
 namespace xolotlSolver {
 
@@ -13,12 +16,40 @@ void PetscSolver0DHandler::createSolverContext(DM &da) {
 	// Degrees of freedom is the total number of clusters in the network
 	const int dof = network.getDOF();
 
+	// Check if several systems should be solved together
+	char ensembleName[PETSC_MAX_PATH_LEN];
+	PetscBool flag;
+	ierr = PetscOptionsGetString(NULL, NULL, "-ensemble", ensembleName,
+			sizeof(ensembleName), &flag);
+	checkPetscError(ierr, "PetscSolver0DHandler::createSolverContext: "
+			"PetscOptionsGetString (-ensemble) failed.");
+	if (flag) {
+		// Only the first process reads the file
+		auto ensembleFile = xolotlCore::MPIUtils::broadcastFile(ensembleName);
+		if (!ensembleFile) {
+			throw std::string(
+					"\nPetscSolver0DHandler::createSolverContext: could not "
+							"open the ensemble file " + std::string(ensembleName));
+		}
+		samples = ReadEnsembleSamples(*ensembleFile);
+		if (samples.empty()) {
+			throw std::string(
+					"\nPetscSolver0DHandler::createSolverContext: the ensemble "
+							"file " + std::string(ensembleName) + " is empty.");
+		}
+	} else {
+		// A single system with the default parameters
+		samples.assign(1, EnsembleSample { 0.0, 1.0, 0.0 });
+	}
+	incidentFlux.assign(dof, 0.0);
+
 	/* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-	 Create distributed array (DMDA) to manage parallel grid and vectors
+	 Create distributed array (DMDA) to manage parallel grid and vectors,
+	 each system is a grid point without any coupling to the others
 	 - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
 
-	ierr = DMDACreate1d(PETSC_COMM_WORLD, DM_BOUNDARY_NONE, 1, dof, 0,
-	NULL, &da);
+	ierr = DMDACreate1d(PETSC_COMM_WORLD, DM_BOUNDARY_NONE, samples.size(),
+			dof, 0, NULL, &da);
 	checkPetscError(ierr, "PetscSolver0DHandler::createSolverContext: "
 			"DMDACreate1d failed.");
 	ierr = DMSetFromOptions(da);
@@ -73,9 +104,23 @@ void PetscSolver0DHandler::createSolverContext(DM &da) {
 void PetscSolver0DHandler::initializeConcentration(DM &da, Vec &C) {
 	PetscErrorCode ierr;
 
+	// Get the local boundaries
+	PetscInt xs, xm;
+	ierr = DMDAGetCorners(da, &xs, NULL, NULL, &xm, NULL, NULL);
+	checkPetscError(ierr, "PetscSolver0DHandler::initializeConcentration: "
+			"DMDAGetCorners failed.");
+
 	// Initialize the last temperature and rates
-	lastTemperature.push_back(0.0);
-	network.addGridPoints(1);
+	for (int i = 0; i < xm; i++) {
+		lastTemperature.push_back(0.0);
+	}
+	network.addGridPoints(xm);
+
+	// Shift the binding energies of each system
+	for (PetscInt i = xs; i < xs + xm; i++) {
+		if (samples[i].energyShift != 0.0)
+			network.setBindingEnergyShift(samples[i].energyShift, i - xs);
+	}
 
 	// Pointer for the concentration vector
 	PetscScalar **concentrations = nullptr;
@@ -99,18 +144,6 @@ void PetscSolver0DHandler::initializeConcentration(DM &da, Vec &C) {
 	if (singleVacancyCluster)
 		vacancyIndex = singleVacancyCluster->getId() - 1;
 
-	// Get the concentration of the only grid point
-	concOffset = concentrations[0];
-
-	// Loop on all the clusters to initialize at 0.0
-	for (int n = 0; n < dof - 1; n++) {
-		concOffset[n] = 0.0;
-	}
-
-	// Temperature
-	xolotlCore::Point<3> gridPosition { 0.0, 0.0, 0.0 };
-	concOffset[dof - 1] = temperatureHandler->getTemperature(gridPosition, 0.0);
-
 	// Get the last time step written in the HDF5 file
 	bool hasConcentrations = false;
 	std::unique_ptr<xolotlCore::XFile> xfile;
@@ -122,19 +155,37 @@ void PetscSolver0DHandler::initializeConcentration(DM &da, Vec &C) {
 		hasConcentrations = (concGroup and concGroup->hasTimesteps());
 	}
 
-	// Initialize the vacancy concentration
-	if (singleVacancyCluster and not hasConcentrations) {
-		concOffset[vacancyIndex] = initialVConc;
-	}
-
-	// If the concentration must be set from the HDF5 file
+	// Read the concentrations from the HDF5 file, they are the same for
+	// all the systems
+	xolotlCore::XFile::TimestepGroup::Data3DType concVector;
 	if (hasConcentrations) {
-		// Read the concentrations from the HDF5 file
 		auto tsGroup = concGroup->getLastTimestepGroup();
-		auto concVector = tsGroup->readGridPoint(0);
+		concVector = tsGroup->readGridPoint(0);
+	}
+
+	// Loop on the systems
+	for (PetscInt i = xs; i < xs + xm; i++) {
+		// Get the concentration of this system
+		concOffset = concentrations[i];
+
+		// Loop on all the clusters to initialize at 0.0
+		for (int n = 0; n < dof - 1; n++) {
+			concOffset[n] = 0.0;
+		}
+
+		// Temperature
+		xolotlCore::Point<3> gridPosition { 0.0, 0.0, 0.0 };
+		concOffset[dof - 1] =
+				(samples[i].temperature > 0.0) ?
+						samples[i].temperature :
+						temperatureHandler->getTemperature(gridPosition, 0.0);
 
-		concOffset = concentrations[0];
-		// Loop on the concVector size
+		// Initialize the vacancy concentration
+		if (singleVacancyCluster and not hasConcentrations) {
+			concOffset[vacancyIndex] = initialVConc;
+		}
+
+		// Set the concentrations read from the HDF5 file
 		for (unsigned int l = 0; l < concVector.size(); l++) {
 			concOffset[(int) concVector.at(l).at(0)] = concVector.at(l).at(1);
 		}
@@ -179,36 +230,54 @@ void PetscSolver0DHandler::updateConcentration(TS &ts, Vec &localC, Vec &F,
 	// Degrees of freedom is the total number of clusters in the network
 	const int dof = network.getDOF();
 
+	// Get local grid boundaries
+	PetscInt xs, xm;
+	ierr = DMDAGetCorners(da, &xs, NULL, NULL, &xm, NULL, NULL);
+	checkPetscError(ierr, "PetscSolver0DHandler::updateConcentration: "
+			"DMDAGetCorners failed.");
+
 	// Set the grid position
 	xolotlCore::Point<3> gridPosition { 0.0, 0.0, 0.0 };
 
-	// Get the old and new array offsets
-	concOffset = concs[0];
-	updatedConcOffset = updatedConcs[0];
-
-	// Get the temperature from the temperature handler
-	temperatureHandler->setTemperature(concOffset);
-	double temperature = temperatureHandler->getTemperature(gridPosition,
-			ftime);
-
-	// Update the network if the temperature changed
-	if (std::fabs(lastTemperature[0] - temperature) > 1.0) {
-		network.setTemperature(temperature);
-		lastTemperature[0] = temperature;
-	}
+	// The incident flux is the same for all the systems up to a factor
+	std::fill(incidentFlux.begin(), incidentFlux.end(), 0.0);
+	fluxHandler->computeIncidentFlux(ftime, incidentFlux.data(), 0, 0);
+
+	// Loop on the systems
+	for (PetscInt xi = xs; xi < xs + xm; xi++) {
+		// Get the old and new array offsets
+		concOffset = concs[xi];
+		updatedConcOffset = updatedConcs[xi];
+
+		// Get the temperature from the temperature handler
+		temperatureHandler->setTemperature(concOffset);
+		double temperature =
+				(samples[xi].temperature > 0.0) ?
+						samples[xi].temperature :
+						temperatureHandler->getTemperature(gridPosition,
+								ftime);
+
+		// Update the network if the temperature changed
+		if (std::fabs(lastTemperature[xi - xs] - temperature) > 1.0) {
+			network.setTemperature(temperature, xi - xs);
+			lastTemperature[xi - xs] = temperature;
+		}
 
-	// Copy data into the ReactionNetwork so that it can
-	// compute the fluxes properly. The network is only used to compute the
-	// fluxes and hold the state data from the last time step. I'm reusing
-	// it because it cuts down on memory significantly (about 400MB per
-	// grid point) at the expense of being a little tricky to comprehend.
-	network.updateConcentrationsFromArray(concOffset);
+		// Copy data into the ReactionNetwork so that it can
+		// compute the fluxes properly. The network is only used to compute the
+		// fluxes and hold the state data from the last time step. I'm reusing
+		// it because it cuts down on memory significantly (about 400MB per
+		// grid point) at the expense of being a little tricky to comprehend.
+		network.updateConcentrationsFromArray(concOffset);
 
-	// ----- Account for flux of incoming particles -----
-	fluxHandler->computeIncidentFlux(ftime, updatedConcOffset, 0, 0);
+		// ----- Account for flux of incoming particles -----
+		for (int i = 0; i < dof - 1; i++) {
+			updatedConcOffset[i] += samples[xi].fluxFactor * incidentFlux[i];
+		}
 
-	// ----- Compute the reaction fluxes over the locally owned part of the grid -----
-	network.computeAllFluxes(updatedConcOffset);
+		// ----- Compute the reaction fluxes over the locally owned part of the grid -----
+		network.computeAllFluxes(updatedConcOffset, xi - xs);
+	}
 
 	/*
 	 Restore vectors
@@ -260,54 +329,67 @@ void PetscSolver0DHandler::computeDiagonalJacobian(TS &ts, Vec &localC, Mat &J,
 	MatStencil colIds[dof];
 	int pdColIdsVectorSize = 0;
 
+	// Get local grid boundaries
+	PetscInt xs, xm;
+	ierr = DMDAGetCorners(da, &xs, NULL, NULL, &xm, NULL, NULL);
+	checkPetscError(ierr, "PetscSolver0DHandler::computeDiagonalJacobian: "
+			"DMDAGetCorners failed.");
+
 	// Set the grid position
 	xolotlCore::Point<3> gridPosition { 0.0, 0.0, 0.0 };
 
-	// Get the temperature from the temperature handler
-	concOffset = concs[0];
-	temperatureHandler->setTemperature(concOffset);
-	double temperature = temperatureHandler->getTemperature(gridPosition,
-			ftime);
-
-	// Update the network if the temperature changed
-	if (std::fabs(lastTemperature[0] - temperature) > 1.0) {
-		network.setTemperature(temperature);
-		lastTemperature[0] = temperature;
-	}
+	// Loop on the systems
+	for (PetscInt xi = xs; xi < xs + xm; xi++) {
+		// Get the temperature from the temperature handler
+		concOffset = concs[xi];
+		temperatureHandler->setTemperature(concOffset);
+		double temperature =
+				(samples[xi].temperature > 0.0) ?
+						samples[xi].temperature :
+						temperatureHandler->getTemperature(gridPosition,
+								ftime);
+
+		// Update the network if the temperature changed
+		if (std::fabs(lastTemperature[xi - xs] - temperature) > 1.0) {
+			network.setTemperature(temperature, xi - xs);
+			lastTemperature[xi - xs] = temperature;
+		}
 
-	// Copy data into the ReactionNetwork so that it can
-	// compute the new concentrations.
-	network.updateConcentrationsFromArray(concOffset);
-
-	// ----- Take care of the reactions for all the reactants -----
-
-	// Compute all the partial derivatives for the reactions
-	network.computeAllPartials(reactionStartingIdx, reactionIndices,
-			reactionVals);
-
-	// Update the column in the Jacobian that represents each DOF
-	for (int i = 0; i < dof - 1; i++) {
-		// Set grid coordinate and component number for the row
-		rowId.i = 0;
-		rowId.c = i;
-
-		// Number of partial derivatives
-		pdColIdsVectorSize = reactionSize[i];
-		auto startingIdx = reactionStartingIdx[i];
-
-		// Loop over the list of column ids
-		for (int j = 0; j < pdColIdsVectorSize; j++) {
-			// Set grid coordinate and component number for a column in the list
-			colIds[j].i = 0;
-			colIds[j].c = reactionIndices[startingIdx + j];
-			// Get the partial derivative from the array of all of the partials
-			reactingPartialsForCluster[j] = reactionVals[startingIdx + j];
+		// Copy data into the ReactionNetwork so that it can
+		// compute the new concentrations.
+		network.updateConcentrationsFromArray(concOffset);
+
+		// ----- Take care of the reactions for all the reactants -----
+
+		// Compute all the partial derivatives for the reactions
+		network.computeAllPartials(reactionStartingIdx, reactionIndices,
+				reactionVals, xi - xs);
+
+		// Update the column in the Jacobian that represents each DOF
+		for (int i = 0; i < dof - 1; i++) {
+			// Set grid coordinate and component number for the row
+			rowId.i = xi;
+			rowId.c = i;
+
+			// Number of partial derivatives
+			pdColIdsVectorSize = reactionSize[i];
+			auto startingIdx = reactionStartingIdx[i];
+
+			// Loop over the list of column ids
+			for (int j = 0; j < pdColIdsVectorSize; j++) {
+				// Set grid coordinate and component number for a column in the list
+				colIds[j].i = xi;
+				colIds[j].c = reactionIndices[startingIdx + j];
+				// Get the partial derivative from the array of all of the partials
+				reactingPartialsForCluster[j] = reactionVals[startingIdx + j];
+			}
+			// Update the matrix
+			ierr = MatSetValuesStencil(J, 1, &rowId, pdColIdsVectorSize,
+					colIds, reactingPartialsForCluster.data(), ADD_VALUES);
+			checkPetscError(ierr,
+					"PetscSolver0DHandler::computeDiagonalJacobian: "
+							"MatSetValuesStencil (reactions) failed.");
 		}
-		// Update the matrix
-		ierr = MatSetValuesStencil(J, 1, &rowId, pdColIdsVectorSize, colIds,
-				reactingPartialsForCluster.data(), ADD_VALUES);
-		checkPetscError(ierr, "PetscSolver0DHandler::computeDiagonalJacobian: "
-				"MatSetValuesStencil (reactions) failed.");
 	}
 
 	/*
@@ -323,4 +405,31 @@ void PetscSolver0DHandler::computeDiagonalJacobian(TS &ts, Vec &localC, Mat &J,
 	return;
 }
 
+std::vector<PetscSolver0DHandler::EnsembleSample> PetscSolver0DHandler::ReadEnsembleSamples(
+		std::istream& input) {
+	std::vector<EnsembleSample> ensemble;
+	std::string line;
+	while (std::getline(input, line)) {
+		// Skip the empty lines and the comments
+		auto first = line.find_first_not_of(" \t\r");
+		if (first == std::string::npos || line[first] == '#')
+			continue;
+
+		// The flux factor and energy shift are optional
+		std::istringstream lineStream(line);
+		EnsembleSample sample { 0.0, 1.0, 0.0 };
+		if (!(lineStream >> sample.temperature)) {
+			throw std::string(
+					"\nPetscSolver0DHandler::ReadEnsembleSamples: could not "
+							"read the temperature from: " + line);
+		}
+		if (lineStream >> sample.fluxFactor)
+			lineStream >> sample.energyShift;
+
+		ensemble.push_back(sample);
+	}
+
+	return ensemble;
+}
+
 } /* end namespace xolotlSolver */
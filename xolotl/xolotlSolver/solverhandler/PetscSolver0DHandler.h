@@ -3,6 +3,7 @@
 
 // Includes
 #include "PetscSolverHandler.h"
+#include <istream>
 
 namespace xolotlSolver {
 
@@ -11,6 +12,36 @@ namespace xolotlSolver {
  * to solve the ADR equations in 0D using PETSc from Argonne National Laboratory.
  */
 class PetscSolver0DHandler: public PetscSolverHandler {
+public:
+
+	/**
+	 * The parameters of one of the independent systems of an ensemble run.
+	 */
+	struct EnsembleSample {
+		//! The temperature, the temperature handler is used if it is not positive
+		double temperature;
+
+		//! The factor multiplying the incident flux
+		double fluxFactor;
+
+		//! The shift of the binding energies of the dissociations (eV)
+		double energyShift;
+	};
+
+private:
+
+	/**
+	 * The systems solved together, one per grid point. There is only one
+	 * with the default parameters unless the PETSc option -ensemble gives
+	 * the file describing them.
+	 */
+	std::vector<EnsembleSample> samples;
+
+	/**
+	 * The incident flux for a flux factor of one, shared by all the
+	 * systems.
+	 */
+	std::vector<double> incidentFlux;
 
 public:
 
@@ -66,6 +97,17 @@ public:
 	 */
 	void computeDiagonalJacobian(TS &ts, Vec &localC, Mat &J, PetscReal ftime);
 
+	/**
+	 * Read the parameters of the systems of an ensemble run. Each line gives
+	 * the temperature, the flux factor, and the binding energy shift of one
+	 * system, the last two being optional. Empty lines and lines starting
+	 * with # are skipped.
+	 *
+	 * @param input The stream to read from
+	 * @return The parameters of each system
+	 */
+	static std::vector<EnsembleSample> ReadEnsembleSamples(std::istream& input);
+
 	/**
 	 * Get the position of the surface.
 	 * \see ISolverHandler.h
@@ -2,6 +2,7 @@
 #include <PetscSolver1DHandler.h>
 #include <MathUtils.h>
 #include <Constants.h>
+#include <xolotlPerf.h>
 
 namespace xcore = xolotlCore;
 
@@ -16,6 +17,26 @@ void PetscSolver1DHandler::createSolverContext(DM &da) {
 	// Degrees of freedom is the total number of clusters in the network
 	const int dof = network.getDOF();
 
+	// Set the position of the surface
+	surfacePosition = 0;
+	if (movingSurface)
+		surfacePosition = (int) (nX * portion / 100.0);
+
+	// Generate the grid in the x direction
+	generateGrid(nX, hX, surfacePosition);
+
+	// Now that the grid was generated, we can update the surface position
+	// if we are using a restart file
+	if (not networkName.empty()) {
+		auto surfaceIndices = readRestartSurface();
+		if (not surfaceIndices.empty())
+			surfacePosition = surfaceIndices[0];
+	}
+
+	// Use the grid from the restart file, adapting it if asked,
+	// this can change the number of grid points
+	readAndAdaptGrid();
+
 	/* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 	 Create distributed array (DMDA) to manage parallel grid and vectors
 	 - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
@@ -31,26 +52,11 @@ void PetscSolver1DHandler::createSolverContext(DM &da) {
 	checkPetscError(ierr,
 			"PetscSolver1DHandler::createSolverContext: DMSetUp failed.");
 
-	// Set the position of the surface
-	surfacePosition = 0;
-	if (movingSurface)
-		surfacePosition = (int) (nX * portion / 100.0);
-
-	// Generate the grid in the x direction
-	generateGrid(nX, hX, surfacePosition);
-
-	// Now that the grid was generated, we can update the surface position
-	// if we are using a restart file
-	if (not networkName.empty()) {
-
-		xolotlCore::XFile xfile(networkName);
-		auto concGroup =
-				xfile.getGroup<xolotlCore::XFile::ConcentrationGroup>();
-		if (concGroup and concGroup->hasTimesteps()) {
-			auto tsGroup = concGroup->getLastTimestepGroup();
-			assert(tsGroup);
-			surfacePosition = tsGroup->readSurface1D();
-		}
+	// Balance the decomposition of the grid now that the surface is known
+	if (useLoadBalancing()) {
+		std::vector<double> costs;
+		addDepthCosts(surfacePosition, costs);
+		balanceDepthOwnership(da, costs);
 	}
 
 	// Initialize the surface of the first advection handler corresponding to the
@@ -70,6 +76,16 @@ void PetscSolver1DHandler::createSolverContext(DM &da) {
 	// Set the size of the partial derivatives vector
 	reactingPartialsForCluster.resize(dof, 0.0);
 
+	// Check if the grid points where nothing happens should be skipped
+	PetscBool flag;
+	ierr = PetscOptionsGetReal(NULL, NULL, "-activity_threshold",
+			&activityThreshold, &flag);
+	checkPetscError(ierr, "PetscSolver1DHandler::createSolverContext: "
+			"PetscOptionsGetReal (-activity_threshold) failed.");
+	if (!flag)
+		activityThreshold = 0.0;
+	quietFlux.assign(dof, 0.0);
+
 	/*  The only spatial coupling in the Jacobian is due to diffusion.
 	 *  The ofill (thought of as a dof by dof 2d (row-oriented) array represents
 	 *  the nonzero coupling between degrees of freedom at one point with degrees
@@ -200,8 +216,9 @@ void PetscSolver1DHandler::initializeConcentration(DM &da, Vec &C) {
 		}
 	}
 
-	// If the concentration must be set from the HDF5 file
-	if (hasConcentrations) {
+	// If the concentration must be set from the HDF5 file on the grid it
+	// was saved with
+	if (hasConcentrations && remapWeights.empty()) {
 
 		// Read the concentrations from the HDF5 file for
 		// each of our grid points.
@@ -219,6 +236,39 @@ void PetscSolver1DHandler::initializeConcentration(DM &da, Vec &C) {
 			}
 		}
 	}
+	// Or if they must be remapped from the grid it was saved with
+	else if (hasConcentrations) {
+
+		// Read the concentrations of the points of the previous grid
+		// overlapping ours
+		assert(concGroup);
+		auto tsGroup = concGroup->getLastTimestepGroup();
+		assert(tsGroup);
+		int oldStart = remapWeights[xs].front().first;
+		int oldEnd = remapWeights[xs + xm - 1].back().first;
+		auto oldConcs = tsGroup->readConcentrations(*xfile, oldStart,
+				oldEnd - oldStart + 1);
+
+		// Average them over the cell of each of our grid points, this
+		// conserves the total quantity of each cluster
+		for (auto i = 0; i < xm; ++i) {
+			concOffset = concentrations[xs + i];
+
+			bool tempRead = false;
+			for (auto const& weight : remapWeights[xs + i]) {
+				for (auto const& currConcData : oldConcs[weight.first
+						- oldStart]) {
+					// The temperature was already set by the handler
+					if (currConcData.first == dof - 1 && !tempRead) {
+						concOffset[dof - 1] = 0.0;
+						tempRead = true;
+					}
+					concOffset[currConcData.first] += weight.second
+							* currConcData.second;
+				}
+			}
+		}
+	}
 
 	/*
 	 Restore vectors
@@ -230,10 +280,259 @@ void PetscSolver1DHandler::initializeConcentration(DM &da, Vec &C) {
 	return;
 }
 
+void PetscSolver1DHandler::readAndAdaptGrid() {
+	PetscErrorCode ierr;
+	remapWeights.clear();
+
+	// Nothing to do without restart file
+	if (networkName.empty())
+		return;
+
+	xolotlCore::XFile xfile(networkName);
+	auto headerGroup = xfile.getGroup<xolotlCore::XFile::HeaderGroup>();
+	if (!headerGroup)
+		return;
+	// Older files do not have the grid
+	auto positions = headerGroup->readGrid();
+	if (positions.empty())
+		return;
+	if ((int) positions.size() != nX) {
+		throw std::string(
+				"\nPetscSolver1DHandler::readAndAdaptGrid: the grid saved in "
+						+ networkName
+						+ " does not match its number of grid points.");
+	}
+
+	// The step between the left ghost point and the first point, the
+	// saved positions are relative to the first point
+	int nx = 0, ny = 0, nz = 0;
+	double hx = 0.0, hy = 0.0, hz = 0.0;
+	headerGroup->read(nx, hx, ny, hy, nz, hz);
+
+	// Method rebuilding the grid, with its ghost points, from the positions
+	auto setGrid = [this, hx](const std::vector<double>& newPositions) {
+		int n = newPositions.size();
+		grid.clear();
+		grid.push_back(0.0);
+		for (int i = 0; i < n; i++) {
+			grid.push_back(newPositions[i] + hx);
+		}
+		grid.push_back(2.0 * grid[n] - grid[n - 1]);
+	};
+
+	// The saved concentrations are on the saved grid, which is different
+	// from the generated one if it was adapted by a previous run
+	for (int i = 0; i < nX; i++) {
+		if (std::fabs(positions[i] - (grid[i + 1] - grid[1]))
+				> 1.0e-10 * (1.0 + positions[i])) {
+			setGrid(positions);
+			break;
+		}
+	}
+
+	// It is only adapted again with -adapt_grid
+	PetscBool flag;
+	ierr = PetscOptionsHasName(NULL, NULL, "-adapt_grid", &flag);
+	checkPetscError(ierr, "PetscSolver1DHandler::readAndAdaptGrid: "
+			"PetscOptionsHasName (-adapt_grid) failed.");
+	if (!flag || nX < 2)
+		return;
+
+	// Adapt it following the last concentrations
+	auto concGroup = xfile.getGroup<xolotlCore::XFile::ConcentrationGroup>();
+	if (!concGroup or !concGroup->hasTimesteps())
+		return;
+	auto tsGroup = concGroup->getLastTimestepGroup();
+	assert(tsGroup);
+
+	// Get the tolerances
+	PetscReal refineTol = 0.5, coarsenTol = 0.05, minStep = 0.1;
+	ierr = PetscOptionsGetReal(NULL, NULL, "-adapt_refine_tol", &refineTol,
+	NULL);
+	checkPetscError(ierr, "PetscSolver1DHandler::readAndAdaptGrid: "
+			"PetscOptionsGetReal (-adapt_refine_tol) failed.");
+	ierr = PetscOptionsGetReal(NULL, NULL, "-adapt_coarsen_tol", &coarsenTol,
+	NULL);
+	checkPetscError(ierr, "PetscSolver1DHandler::readAndAdaptGrid: "
+			"PetscOptionsGetReal (-adapt_coarsen_tol) failed.");
+	ierr = PetscOptionsGetReal(NULL, NULL, "-adapt_min_step", &minStep,
+	NULL);
+	checkPetscError(ierr, "PetscSolver1DHandler::readAndAdaptGrid: "
+			"PetscOptionsGetReal (-adapt_min_step) failed.");
+
+	// The indicator is the total concentration of clusters at each point,
+	// each process reads a slice of the points and they are summed
+	int procId, nProcs;
+	MPI_Comm_rank(PETSC_COMM_WORLD, &procId);
+	MPI_Comm_size(PETSC_COMM_WORLD, &nProcs);
+	int baseX = (int) (((long long) nX * procId) / nProcs);
+	int numX = (int) (((long long) nX * (procId + 1)) / nProcs) - baseX;
+	const int dof = network.getDOF();
+	std::vector<double> indicator(nX, 0.0);
+	{
+		auto myConcs = tsGroup->readConcentrations(xfile, baseX, numX);
+		for (int i = 0; i < numX; i++) {
+			for (auto const& currConcData : myConcs[i]) {
+				// The last degree of freedom is the temperature
+				if (currConcData.first < dof - 1)
+					indicator[baseX + i] += currConcData.second;
+			}
+		}
+	}
+	MPI_Allreduce(MPI_IN_PLACE, indicator.data(), nX, MPI_DOUBLE, MPI_SUM,
+			PETSC_COMM_WORLD);
+
+	// Adapt the grid, the points up to the surface are kept so its position
+	// does not change
+	auto newPositions = ComputeAdaptedGrid(positions, indicator,
+			surfacePosition, refineTol, coarsenTol, minStep);
+	remapWeights = ComputeRemapWeights(positions, newPositions);
+	setGrid(newPositions);
+
+	if (procId == 0) {
+		std::cout << "Adapted the grid from " << nX << " to "
+				<< newPositions.size() << " points." << std::endl;
+	}
+	nX = newPositions.size();
+
+	return;
+}
+
+std::vector<double> PetscSolver1DHandler::ComputeAdaptedGrid(
+		const std::vector<double>& positions,
+		const std::vector<double>& indicator, int surfacePos, double refineTol,
+		double coarsenTol, double minStep) {
+	int n = positions.size();
+	if ((int) indicator.size() != n || surfacePos < 0 || surfacePos >= n) {
+		throw std::string(
+				"\nPetscSolver1DHandler::ComputeAdaptedGrid: the indicator "
+						"and the surface position do not match the grid.");
+	}
+	if (coarsenTol >= refineTol) {
+		throw std::string(
+				"\nPetscSolver1DHandler::ComputeAdaptedGrid: the coarsening "
+						"tolerance has to be smaller than the refinement one.");
+	}
+
+	// The jumps are relative to the local values, but the values that are
+	// very small compared to the largest one should not drive the refinement
+	double floor = 0.0;
+	for (auto value : indicator) {
+		floor = std::max(floor, std::fabs(value));
+	}
+	floor = (floor > 0.0) ? 1.0e-3 * floor : 1.0;
+	std::vector<double> jumps(n - 1, 0.0);
+	for (int j = 0; j < n - 1; j++) {
+		double scale = std::max(
+				std::max(std::fabs(indicator[j]), std::fabs(indicator[j + 1])),
+				floor);
+		jumps[j] = std::fabs(indicator[j + 1] - indicator[j]) / scale;
+	}
+
+	// Keep everything up to the surface
+	std::vector<double> newPositions(positions.begin(),
+			positions.begin() + surfacePos + 1);
+	bool previousRemoved = false;
+	for (int j = surfacePos; j < n - 1; j++) {
+		// Split the interval if the solution changes too much across it
+		if (jumps[j] > refineTol
+				&& positions[j + 1] - positions[j] >= 2.0 * minStep) {
+			newPositions.push_back(0.5 * (positions[j] + positions[j + 1]));
+		}
+
+		// Remove the next point if the solution is flat on both of its
+		// sides, never two in a row
+		if (j + 1 > surfacePos + 1 && j + 1 < n - 1 && !previousRemoved
+				&& jumps[j] < coarsenTol && jumps[j + 1] < coarsenTol) {
+			previousRemoved = true;
+			continue;
+		}
+		previousRemoved = false;
+		newPositions.push_back(positions[j + 1]);
+	}
+
+	return newPositions;
+}
+
+std::vector<std::vector<std::pair<int, double> > > PetscSolver1DHandler::ComputeRemapWeights(
+		const std::vector<double>& oldPositions,
+		const std::vector<double>& newPositions) {
+	int nOld = oldPositions.size(), nNew = newPositions.size();
+	if (nOld < 2 || nNew < 2
+			|| std::fabs(oldPositions.front() - newPositions.front()) > 1.0e-10
+			|| std::fabs(oldPositions.back() - newPositions.back())
+					> 1.0e-10 * (1.0 + std::fabs(oldPositions.back()))) {
+		throw std::string(
+				"\nPetscSolver1DHandler::ComputeRemapWeights: the grids "
+						"have to span the same interval.");
+	}
+
+	// Method computing the bounds of the cell of a point
+	auto lowerBound = [](const std::vector<double>& pos, int i) {
+		return (i == 0) ? pos[0] : 0.5 * (pos[i - 1] + pos[i]);
+	};
+	auto upperBound = [](const std::vector<double>& pos, int i) {
+		return (i + 1 == (int) pos.size()) ?
+				pos[i] : 0.5 * (pos[i] + pos[i + 1]);
+	};
+
+	std::vector<std::vector<std::pair<int, double> > > weights(nNew);
+	int first = 0;
+	for (int i = 0; i < nNew; i++) {
+		double lower = lowerBound(newPositions, i);
+		double upper = upperBound(newPositions, i);
+		double width = upper - lower;
+
+		// Skip the old cells that are entirely on the left
+		while (first < nOld - 1 && upperBound(oldPositions, first) <= lower)
+			first++;
+
+		// Add the overlapping old cells
+		for (int j = first; j < nOld; j++) {
+			double oldLower = lowerBound(oldPositions, j);
+			if (oldLower >= upper)
+				break;
+			double overlap = std::min(upper, upperBound(oldPositions, j))
+					- std::max(lower, oldLower);
+			if (overlap > 0.0)
+				weights[i].emplace_back(j, overlap / width);
+		}
+	}
+
+	return weights;
+}
+
+bool PetscSolver1DHandler::IsQuiet(double **concVector, int dof,
+		double threshold) {
+	// The last degree of freedom is the temperature
+	for (int l = 0; l < 3; l++) {
+		for (int i = 0; i < dof - 1; i++) {
+			if (std::fabs(concVector[l][i]) > threshold)
+				return false;
+		}
+	}
+
+	return true;
+}
+
 void PetscSolver1DHandler::updateConcentration(TS &ts, Vec &localC, Vec &F,
 		PetscReal ftime) {
 	PetscErrorCode ierr;
 
+	// The profiling regions of the RHS
+	static const int fluxRegion = xolotlPerf::RegionTracer::getRegionId(
+			"RHS:flux");
+	static const int diffusionRegion = xolotlPerf::RegionTracer::getRegionId(
+			"RHS:diffusion");
+	static const int advectionRegion = xolotlPerf::RegionTracer::getRegionId(
+			"RHS:advection");
+	static const int trapMutationRegion =
+			xolotlPerf::RegionTracer::getRegionId("RHS:trapMutation");
+	static const int reactionsRegion = xolotlPerf::RegionTracer::getRegionId(
+			"RHS:reactions");
+	// Null if the tracing is not enabled
+	auto tracer = xolotlPerf::getRegionTracer();
+
 	// Get the local data vector from PETSc
 	DM da;
 	ierr = TSGetDM(ts, &da);
@@ -301,6 +600,9 @@ void PetscSolver1DHandler::updateConcentration(TS &ts, Vec &localC, Vec &F,
 	double **concVector = new double*[3];
 	xolotlCore::Point<3> gridPosition { 0.0, 0.0, 0.0 };
 
+	// Every grid point is active until it is checked
+	activeMask.assign(xm, true);
+
 	// Loop over grid points computing ODE terms for each grid point
 	for (PetscInt xi = xs; xi < xs + xm; xi++) {
 		// Compute the old and new array offsets
@@ -350,31 +652,65 @@ void PetscSolver1DHandler::updateConcentration(TS &ts, Vec &localC, Vec &F,
 		network.updateConcentrationsFromArray(concOffset);
 
 		// ----- Account for flux of incoming particles -----
-		fluxHandler->computeIncidentFlux(ftime, updatedConcOffset, xi,
-				surfacePosition);
+		{
+			xolotlPerf::ScopedRegion region(tracer, fluxRegion);
+			if (activityThreshold > 0.0
+					&& IsQuiet(concVector, dof, activityThreshold)) {
+				// The grid point stays inactive only if nothing is coming in
+				fluxHandler->computeIncidentFlux(ftime, quietFlux.data(), xi,
+						surfacePosition);
+				activeMask[xi - xs] = false;
+				for (int i = 0; i < dof; i++) {
+					if (quietFlux[i] != 0.0) {
+						updatedConcOffset[i] += quietFlux[i];
+						quietFlux[i] = 0.0;
+						activeMask[xi - xs] = true;
+					}
+				}
+			} else {
+				fluxHandler->computeIncidentFlux(ftime, updatedConcOffset, xi,
+						surfacePosition);
+			}
+		}
 
 		// ---- Compute the temperature over the locally owned part of the grid -----
 		temperatureHandler->computeTemperature(concVector, updatedConcOffset,
 				grid[xi + 1] - grid[xi], grid[xi + 2] - grid[xi + 1], xi);
 
 		// ---- Compute diffusion over the locally owned part of the grid -----
-		diffusionHandler->computeDiffusion(network, concVector,
-				updatedConcOffset, grid[xi + 1] - grid[xi],
-				grid[xi + 2] - grid[xi + 1], xi, xs);
+		{
+			xolotlPerf::ScopedRegion region(tracer, diffusionRegion);
+			diffusionHandler->computeDiffusion(network, concVector,
+					updatedConcOffset, grid[xi + 1] - grid[xi],
+					grid[xi + 2] - grid[xi + 1], xi, xs);
+		}
 
 		// ---- Compute advection over the locally owned part of the grid -----
-		for (int i = 0; i < advectionHandlers.size(); i++) {
-			advectionHandlers[i]->computeAdvection(network, gridPosition,
-					concVector, updatedConcOffset, grid[xi + 1] - grid[xi],
-					grid[xi + 2] - grid[xi + 1], xi, xs);
+		{
+			xolotlPerf::ScopedRegion region(tracer, advectionRegion);
+			for (std::size_t i = 0; i < advectionHandlers.size(); i++) {
+				advectionHandlers[i]->computeAdvection(network, gridPosition,
+						concVector, updatedConcOffset, grid[xi + 1] - grid[xi],
+						grid[xi + 2] - grid[xi + 1], xi, xs);
+			}
 		}
 
+		// Nothing else can happen at an inactive grid point
+		if (!activeMask[xi - xs])
+			continue;
+
 		// ----- Compute the modified trap-mutation over the locally owned part of the grid -----
-		mutationHandler->computeTrapMutation(network, concOffset,
-				updatedConcOffset, xi, xs);
+		{
+			xolotlPerf::ScopedRegion region(tracer, trapMutationRegion);
+			mutationHandler->computeTrapMutation(network, concOffset,
+					updatedConcOffset, xi, xs);
+		}
 
 		// ----- Compute the reaction fluxes over the locally owned part of the grid -----
-		network.computeAllFluxes(updatedConcOffset, xi - xs);
+		{
+			xolotlPerf::ScopedRegion region(tracer, reactionsRegion);
+			network.computeAllFluxes(updatedConcOffset, xi - xs);
+		}
 	}
 
 	/*
@@ -602,6 +938,14 @@ void PetscSolver1DHandler::computeDiagonalJacobian(TS &ts, Vec &localC, Mat &J,
 		PetscReal ftime) {
 	PetscErrorCode ierr;
 
+	// The profiling regions of the Jacobian
+	static const int partialsRegion = xolotlPerf::RegionTracer::getRegionId(
+			"Jacobian:partials");
+	static const int setValuesRegion = xolotlPerf::RegionTracer::getRegionId(
+			"Jacobian:MatSetValues");
+	// Null if the tracing is not enabled
+	auto tracer = xolotlPerf::getRegionTracer();
+
 	// Get the distributed array
 	DM da;
 	ierr = TSGetDM(ts, &da);
@@ -691,6 +1035,10 @@ void PetscSolver1DHandler::computeDiagonalJacobian(TS &ts, Vec &localC, Mat &J,
 			lastTemperature[xi - xs] = temperature;
 		}
 
+		// Skip the grid points that were inactive in the last RHS evaluation
+		if ((int) activeMask.size() == xm && !activeMask[xi - xs])
+			continue;
+
 		// Copy data into the ReactionNetwork so that it can
 		// compute the new concentrations.
 		network.updateConcentrationsFromArray(concOffset);
@@ -698,10 +1046,14 @@ void PetscSolver1DHandler::computeDiagonalJacobian(TS &ts, Vec &localC, Mat &J,
 		// ----- Take care of the reactions for all the reactants -----
 
 		// Compute all the partial derivatives for the reactions
-		network.computeAllPartials(reactionStartingIdx, reactionIndices,
-				reactionVals, xi - xs);
+		{
+			xolotlPerf::ScopedRegion region(tracer, partialsRegion);
+			network.computeAllPartials(reactionStartingIdx, reactionIndices,
+					reactionVals, xi - xs);
+		}
 
 		// Update the column in the Jacobian that represents each DOF
+		xolotlPerf::ScopedRegion setValues(tracer, setValuesRegion);
 		for (int i = 0; i < dof - 1; i++) {
 			// Set grid coordinate and component number for the row
 			rowId.i = xi;
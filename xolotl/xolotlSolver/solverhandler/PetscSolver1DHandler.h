@@ -15,6 +15,42 @@ private:
 	//! The position of the surface
 	int surfacePosition;
 
+	/**
+	 * The concentration under which a grid point is considered empty, set
+	 * with the PETSc option -activity_threshold. The activity masks are not
+	 * used if it is not positive.
+	 */
+	double activityThreshold;
+
+	/**
+	 * Whether each local grid point was active during the last RHS
+	 * evaluation. The reactions and the modified trap-mutation are skipped at
+	 * the inactive grid points, in the RHS and in the Jacobian.
+	 */
+	std::vector<bool> activeMask;
+
+	/**
+	 * A vector of size dof, always reset to zero, used to check if there is
+	 * incoming flux at a grid point.
+	 */
+	std::vector<double> quietFlux;
+
+	/**
+	 * For each grid point, the points of the restart grid it overlaps and
+	 * the fraction of its cell covered by each of them. Only filled when the
+	 * grid was adapted at restart.
+	 */
+	std::vector<std::vector<std::pair<int, double> > > remapWeights;
+
+	/**
+	 * Replace the generated grid by the one saved in the restart file, if
+	 * any, since the saved concentrations are on it. If the PETSc option
+	 * -adapt_grid is used, also refine and coarsen it following the last
+	 * concentrations saved in the file, which updates nX and remapWeights.
+	 * Throws if the saved grid does not have nX points.
+	 */
+	void readAndAdaptGrid();
+
 public:
 
 	/**
@@ -28,7 +64,8 @@ public:
 	 * @param _network The reaction network to use.
 	 */
 	PetscSolver1DHandler(xolotlCore::IReactionNetwork& _network) :
-			PetscSolverHandler(_network), surfacePosition(0) {
+			PetscSolverHandler(_network), surfacePosition(0), activityThreshold(
+					0.0) {
 	}
 
 	//! The Destructor
@@ -67,6 +104,52 @@ public:
 	 */
 	void computeDiagonalJacobian(TS &ts, Vec &localC, Mat &J, PetscReal ftime);
 
+	/**
+	 * Check if all the concentrations at a grid point and at its neighbors are
+	 * below the activity threshold, in absolute value. The temperature is not
+	 * checked.
+	 *
+	 * @param concVector The pointers to the middle, left, and right concentrations
+	 * @param dof The number of degrees of freedom
+	 * @param threshold The activity threshold
+	 * @return True if nothing is there
+	 */
+	static bool IsQuiet(double **concVector, int dof, double threshold);
+
+	/**
+	 * Refine and coarsen a 1D grid behind the surface. An interval is split
+	 * in two when the relative jump of the indicator across it is above the
+	 * refinement tolerance, and a point is removed when the jumps on both
+	 * of its sides are below the coarsening tolerance. The points up to the
+	 * surface, the one after it, and the last one are always kept.
+	 *
+	 * @param positions The positions of the grid points
+	 * @param indicator The indicator value at each grid point
+	 * @param surfacePos The index of the surface
+	 * @param refineTol The refinement tolerance
+	 * @param coarsenTol The coarsening tolerance
+	 * @param minStep The smallest step size that can be created
+	 * @return The positions of the new grid points
+	 */
+	static std::vector<double> ComputeAdaptedGrid(
+			const std::vector<double>& positions,
+			const std::vector<double>& indicator, int surfacePos,
+			double refineTol, double coarsenTol, double minStep);
+
+	/**
+	 * Compute the weights of the conservative remapping between two grids
+	 * spanning the same interval. The cell of a point goes from the middle
+	 * of its left interval to the middle of its right one, the value at a new
+	 * point is the average of the old values over its cell.
+	 *
+	 * @param oldPositions The positions of the old grid points
+	 * @param newPositions The positions of the new grid points
+	 * @return For each new point, the old points and their weights
+	 */
+	static std::vector<std::vector<std::pair<int, double> > > ComputeRemapWeights(
+			const std::vector<double>& oldPositions,
+			const std::vector<double>& newPositions);
+
 	/**
 	 * Get the position of the surface.
 	 * \see ISolverHandler.h
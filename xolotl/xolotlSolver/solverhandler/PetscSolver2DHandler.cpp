@@ -42,21 +42,21 @@ void PetscSolver2DHandler::createSolverContext(DM &da) {
 	// Now that the grid was generated, we can update the surface position
 	// if we are using a restart file
 	if (not networkName.empty()) {
+		auto surfaceIndices = readRestartSurface();
 
-		xolotlCore::XFile xfile(networkName);
-		auto concGroup =
-				xfile.getGroup<xolotlCore::XFile::ConcentrationGroup>();
-		if (concGroup and concGroup->hasTimesteps()) {
-
-			auto tsGroup = concGroup->getLastTimestepGroup();
-			assert(tsGroup);
-			auto surfaceIndices = tsGroup->readSurface2D();
+		// Set the actual surface positions
+		for (std::size_t i = 0; i < surfaceIndices.size(); i++) {
+			surfacePosition[i] = surfaceIndices[i];
+		}
+	}
 
-			// Set the actual surface positions
-			for (int i = 0; i < surfaceIndices.size(); i++) {
-				surfacePosition[i] = surfaceIndices[i];
-			}
+	// Balance the decomposition of the grid now that the surface is known
+	if (useLoadBalancing()) {
+		std::vector<double> costs;
+		for (int j = 0; j < nY; j++) {
+			addDepthCosts(surfacePosition[j], costs);
 		}
+		balanceDepthOwnership(da, costs);
 	}
 
 	// Prints the grid on one process
@@ -215,19 +215,45 @@ void PetscSolver2DHandler::initializeConcentration(DM &da, Vec &C) {
 		auto tsGroup = concGroup->getLastTimestepGroup();
 		assert(tsGroup);
 
-		// Loop on the full grid
-		for (PetscInt j = 0; j < nY; j++) {
-			for (PetscInt i = 0; i < nX; i++) {
-				// Read the concentrations from the HDF5 file
-				auto concVector = tsGroup->readGridPoint(i, j);
+		// Read the concentrations of our grid points, whatever the
+		// decomposition they were written with
+		if (tsGroup->hasConcentrations()) {
+			std::vector<int> gridPoints;
+			for (PetscInt j = ys; j < ys + ym; j++) {
+				for (PetscInt i = xs; i < xs + xm; i++) {
+					gridPoints.push_back(i + nX * j);
+				}
+			}
+			auto myConcs = tsGroup->readConcentrations(*xfile, nX * nY,
+					gridPoints);
 
-				// Change the concentration only if we are on the locally owned part of the grid
-				if (i >= xs && i < xs + xm && j >= ys && j < ys + ym) {
+			// Apply the concentrations we just read.
+			int n = 0;
+			for (PetscInt j = ys; j < ys + ym; j++) {
+				for (PetscInt i = xs; i < xs + xm; i++, n++) {
 					concOffset = concentrations[j][i];
-					// Loop on the concVector size
-					for (unsigned int l = 0; l < concVector.size(); l++) {
-						concOffset[(int) concVector.at(l).at(0)] =
-								concVector.at(l).at(1);
+					for (auto const& currConcData : myConcs[n]) {
+						concOffset[currConcData.first] = currConcData.second;
+					}
+				}
+			}
+		}
+		// Or from the older files with one dataset per grid point
+		else {
+			// Loop on the full grid
+			for (PetscInt j = 0; j < nY; j++) {
+				for (PetscInt i = 0; i < nX; i++) {
+					// Read the concentrations from the HDF5 file
+					auto concVector = tsGroup->readGridPoint(i, j);
+
+					// Change the concentration only if we are on the locally owned part of the grid
+					if (i >= xs && i < xs + xm && j >= ys && j < ys + ym) {
+						concOffset = concentrations[j][i];
+						// Loop on the concVector size
+						for (unsigned int l = 0; l < concVector.size(); l++) {
+							concOffset[(int) concVector.at(l).at(0)] =
+									concVector.at(l).at(1);
+						}
 					}
 				}
 			}
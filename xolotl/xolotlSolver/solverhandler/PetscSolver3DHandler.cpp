@@ -54,24 +54,28 @@ void PetscSolver3DHandler::createSolverContext(DM &da) {
 	// Now that the grid was generated, we can update the surface position
 	// if we are using a restart file
 	if (not networkName.empty()) {
-		xolotlCore::XFile xfile(networkName);
-		auto concGroup =
-				xfile.getGroup<xolotlCore::XFile::ConcentrationGroup>();
-		if (concGroup and concGroup->hasTimesteps()) {
-
-			auto tsGroup = concGroup->getLastTimestepGroup();
-			assert(tsGroup);
-
-			auto surfaceIndices = tsGroup->readSurface3D();
-
-			// Set the actual surface positions
-			for (int i = 0; i < surfaceIndices.size(); i++) {
-				for (int j = 0; j < surfaceIndices[0].size(); j++) {
-					surfacePosition[i][j] = surfaceIndices[i][j];
+		auto surfaceIndices = readRestartSurface();
+
+		// Set the actual surface positions, they are sent row by row
+		if (not surfaceIndices.empty()) {
+			for (std::size_t i = 0; i < surfacePosition.size(); i++) {
+				for (std::size_t j = 0; j < surfacePosition[i].size(); j++) {
+					surfacePosition[i][j] = surfaceIndices[i
+							* surfacePosition[i].size() + j];
 				}
 			}
+		}
+	}
 
+	// Balance the decomposition of the grid now that the surface is known
+	if (useLoadBalancing()) {
+		std::vector<double> costs;
+		for (int j = 0; j < nY; j++) {
+			for (int k = 0; k < nZ; k++) {
+				addDepthCosts(surfacePosition[j][k], costs);
+			}
 		}
+		balanceDepthOwnership(da, costs);
 	}
 
 	// Initialize the surface of the first advection handler corresponding to the
@@ -235,22 +239,54 @@ void PetscSolver3DHandler::initializeConcentration(DM &da, Vec &C) {
 		auto tsGroup = concGroup->getLastTimestepGroup();
 		assert(tsGroup);
 
-		// Loop on the full grid
-		for (PetscInt k = 0; k < nZ; k++) {
-			for (PetscInt j = 0; j < nY; j++) {
-				for (PetscInt i = 0; i < nX; i++) {
-					// Read the concentrations from the HDF5 file
-					auto concVector = tsGroup->readGridPoint(i, j, k);
-
-					// Change the concentration only if we are on the locally
-					// owned part of the grid
-					if (i >= xs && i < xs + xm && j >= ys && j < ys + ym
-							&& k >= zs && k < zs + zm) {
+		// Read the concentrations of our grid points, whatever the
+		// decomposition they were written with
+		if (tsGroup->hasConcentrations()) {
+			std::vector<int> gridPoints;
+			for (PetscInt k = zs; k < zs + zm; k++) {
+				for (PetscInt j = ys; j < ys + ym; j++) {
+					for (PetscInt i = xs; i < xs + xm; i++) {
+						gridPoints.push_back(i + nX * (j + nY * k));
+					}
+				}
+			}
+			auto myConcs = tsGroup->readConcentrations(*xfile, nX * nY * nZ,
+					gridPoints);
+
+			// Apply the concentrations we just read.
+			int n = 0;
+			for (PetscInt k = zs; k < zs + zm; k++) {
+				for (PetscInt j = ys; j < ys + ym; j++) {
+					for (PetscInt i = xs; i < xs + xm; i++, n++) {
 						concOffset = concentrations[k][j][i];
-						// Loop on the concVector size
-						for (unsigned int l = 0; l < concVector.size(); l++) {
-							concOffset[(int) concVector.at(l).at(0)] =
-									concVector.at(l).at(1);
+						for (auto const& currConcData : myConcs[n]) {
+							concOffset[currConcData.first] =
+									currConcData.second;
+						}
+					}
+				}
+			}
+		}
+		// Or from the older files with one dataset per grid point
+		else {
+			// Loop on the full grid
+			for (PetscInt k = 0; k < nZ; k++) {
+				for (PetscInt j = 0; j < nY; j++) {
+					for (PetscInt i = 0; i < nX; i++) {
+						// Read the concentrations from the HDF5 file
+						auto concVector = tsGroup->readGridPoint(i, j, k);
+
+						// Change the concentration only if we are on the locally
+						// owned part of the grid
+						if (i >= xs && i < xs + xm && j >= ys && j < ys + ym
+								&& k >= zs && k < zs + zm) {
+							concOffset = concentrations[k][j][i];
+							// Loop on the concVector size
+							for (unsigned int l = 0; l < concVector.size();
+									l++) {
+								concOffset[(int) concVector.at(l).at(0)] =
+										concVector.at(l).at(1);
+							}
 						}
 					}
 				}
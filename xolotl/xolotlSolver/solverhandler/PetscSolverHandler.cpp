@@ -1,4 +1,5 @@
 #include "xolotlSolver/solverhandler/PetscSolverHandler.h"
+#include <numeric>
 
 namespace xolotlSolver {
 
@@ -39,4 +40,151 @@ std::vector<PetscInt> PetscSolverHandler::ConvertToPetscSparseFillMap(
 	return ret;
 }
 
+bool PetscSolverHandler::useLoadBalancing() {
+	PetscBool flag;
+	PetscErrorCode ierr = PetscOptionsHasName(NULL, NULL, "-load_balance",
+			&flag);
+	checkPetscError(ierr, "PetscSolverHandler::useLoadBalancing: "
+			"PetscOptionsHasName (-load_balance) failed.");
+
+	return flag;
+}
+
+void PetscSolverHandler::addDepthCosts(int surfacePos,
+		std::vector<double>& costs) const {
+	// The relative costs, the points that do all the reactions cost 1.0
+	const double inactiveCost = 0.1, nearSurfaceCost = 0.5;
+
+	costs.resize(nX, 0.0);
+	for (int xi = 0; xi < nX; xi++) {
+		// Only diffusion and advection on the left of the surface
+		if (xi < surfacePos + leftOffset || xi > nX - 1 - rightOffset) {
+			costs[xi] += inactiveCost;
+			continue;
+		}
+
+		// All the reactions
+		costs[xi] += 1.0;
+
+		// The flux and the modified trap-mutation close to the surface,
+		// grid is shifted by one
+		if (grid[xi + 1] - grid[surfacePos + 1] <= 2.0)
+			costs[xi] += nearSurfaceCost;
+	}
+
+	return;
+}
+
+std::vector<PetscInt> PetscSolverHandler::ComputeBalancedRanges(
+		const std::vector<double>& costs, int nParts) {
+	int n = costs.size();
+	if (nParts < 1 || n < nParts) {
+		throw std::string(
+				"\nPetscSolverHandler::ComputeBalancedRanges: cannot split "
+						+ std::to_string(n) + " grid points in "
+						+ std::to_string(nParts) + " ranges.");
+	}
+
+	std::vector<PetscInt> ranges(nParts, 0);
+	double remaining = std::accumulate(costs.begin(), costs.end(), 0.0);
+	int start = 0;
+	for (int k = 0; k < nParts - 1; k++) {
+		// What each of the remaining ranges should get
+		double target = remaining / (double) (nParts - k);
+		// Leave at least one point for each of the remaining ranges
+		int maxEnd = n - (nParts - k - 1);
+
+		// Take points while it gets closer to the target
+		double sum = 0.0;
+		int end = start;
+		while (end < maxEnd) {
+			if (end > start && sum + costs[end] - target >= target - sum)
+				break;
+			sum += costs[end];
+			end++;
+		}
+
+		ranges[k] = end - start;
+		remaining -= sum;
+		start = end;
+	}
+	ranges[nParts - 1] = n - start;
+
+	return ranges;
+}
+
+void PetscSolverHandler::balanceDepthOwnership(DM &da,
+		const std::vector<double>& costs) const {
+	PetscErrorCode ierr;
+
+	// Get all the information about the current DMDA
+	PetscInt dim, M, N, P, m, n, p, dof, s;
+	DMBoundaryType bx, by, bz;
+	DMDAStencilType st;
+	ierr = DMDAGetInfo(da, &dim, &M, &N, &P, &m, &n, &p, &dof, &s, &bx, &by,
+			&bz, &st);
+	checkPetscError(ierr, "PetscSolverHandler::balanceDepthOwnership: "
+			"DMDAGetInfo failed.");
+
+	// Nothing to balance
+	if (m == 1)
+		return;
+
+	// Keep the decomposition in the other directions
+	const PetscInt *lxOld, *lyOld, *lzOld;
+	ierr = DMDAGetOwnershipRanges(da, &lxOld, &lyOld, &lzOld);
+	checkPetscError(ierr, "PetscSolverHandler::balanceDepthOwnership: "
+			"DMDAGetOwnershipRanges failed.");
+	std::vector<PetscInt> ly, lz;
+	if (dim > 1)
+		ly.assign(lyOld, lyOld + n);
+	if (dim > 2)
+		lz.assign(lzOld, lzOld + p);
+
+	// Compute the new ranges in the depth direction
+	auto lx = ComputeBalancedRanges(costs, m);
+
+	// Re-create the DMDA
+	ierr = DMDestroy(&da);
+	checkPetscError(ierr, "PetscSolverHandler::balanceDepthOwnership: "
+			"DMDestroy failed.");
+	switch (dim) {
+	case 1:
+		ierr = DMDACreate1d(PETSC_COMM_WORLD, bx, M, dof, s, lx.data(), &da);
+		break;
+	case 2:
+		ierr = DMDACreate2d(PETSC_COMM_WORLD, bx, by, st, M, N, m, n, dof, s,
+				lx.data(), ly.data(), &da);
+		break;
+	case 3:
+		ierr = DMDACreate3d(PETSC_COMM_WORLD, bx, by, bz, st, M, N, P, m, n, p,
+				dof, s, lx.data(), ly.data(), lz.data(), &da);
+		break;
+	default:
+		throw std::string(
+				"\nPetscSolverHandler::balanceDepthOwnership: wrong dimension.");
+	}
+	checkPetscError(ierr, "PetscSolverHandler::balanceDepthOwnership: "
+			"DMDACreate failed.");
+	ierr = DMSetFromOptions(da);
+	checkPetscError(ierr, "PetscSolverHandler::balanceDepthOwnership: "
+			"DMSetFromOptions failed.");
+	ierr = DMSetUp(da);
+	checkPetscError(ierr, "PetscSolverHandler::balanceDepthOwnership: "
+			"DMSetUp failed.");
+
+	// Print the new decomposition on one process
+	int procId;
+	MPI_Comm_rank(PETSC_COMM_WORLD, &procId);
+	if (procId == 0) {
+		std::cout << "Load-balanced depth ownership ranges:";
+		for (auto size : lx) {
+			std::cout << " " << size;
+		}
+		std::cout << std::endl;
+	}
+
+	return;
+}
+
 } // nmaespace xolotlSolver
@@ -97,8 +97,55 @@ protected:
 	static std::vector<PetscInt> ConvertToPetscSparseFillMap(size_t dof,
 			const xolotlCore::IReactionNetwork::SparseFillMap& fillMap);
 
+	/**
+	 * Check if the user asked for the load-aware decomposition of the grid
+	 * with the PETSc option -load_balance.
+	 *
+	 * @return True if the decomposition should be balanced
+	 */
+	static bool useLoadBalancing();
+
+	/**
+	 * Estimate the relative cost of each grid point in the depth direction
+	 * for a given surface position. The points on the left of the surface
+	 * (and in the boundary offsets) only see diffusion and advection, the
+	 * other ones compute all the reactions, and the ones close to the surface
+	 * also compute the flux and the modified trap-mutation.
+	 *
+	 * The grid has to be generated before calling this method.
+	 *
+	 * @param surfacePos The index of the position of the surface
+	 * @param costs The vector of size nX where the costs are added
+	 */
+	void addDepthCosts(int surfacePos, std::vector<double>& costs) const;
+
+	/**
+	 * Re-create the DMDA with ownership ranges in the depth direction that
+	 * balance the given costs. The decomposition in the other directions,
+	 * the number of processes in each direction, and all the other
+	 * parameters of the DMDA are kept.
+	 *
+	 * This has to be called before anything is attached to the DMDA.
+	 *
+	 * @param da The DMDA, replaced by the new one
+	 * @param costs The estimated cost of each grid point in the depth direction
+	 */
+	void balanceDepthOwnership(DM &da, const std::vector<double>& costs) const;
+
 public:
 
+	/**
+	 * Split a line of points in contiguous ranges of similar total cost,
+	 * each range containing at least one point.
+	 *
+	 * @param costs The cost of each point
+	 * @param nParts The number of ranges
+	 * @return The number of points in each range, in the format of the
+	 * lx, ly, lz arguments of DMDACreate
+	 */
+	static std::vector<PetscInt> ComputeBalancedRanges(
+			const std::vector<double>& costs, int nParts);
+
 	/**
 	 * Default constructor, deleted because we need to construct with objects.
 	 */
@@ -209,6 +209,47 @@ protected:
 		return;
 	}
 
+	/**
+	 * Read the surface positions of the last time step of the restart file.
+	 * Only the root process opens the file, the others receive them.
+	 *
+	 * This method blocks until it is called by all processes.
+	 *
+	 * @return The surface positions, row by row in 3D, empty if the file
+	 * has no time step
+	 */
+	std::vector<int> readRestartSurface() const {
+		std::vector<int> surface;
+
+		int procId;
+		MPI_Comm_rank(MPI_COMM_WORLD, &procId);
+		if (procId == 0) {
+			xolotlCore::XFile xfile(networkName, MPI_COMM_SELF);
+			auto concGroup =
+					xfile.getGroup<xolotlCore::XFile::ConcentrationGroup>();
+			if (concGroup and concGroup->hasTimesteps()) {
+				auto tsGroup = concGroup->getLastTimestepGroup();
+				assert(tsGroup);
+				if (dimension == 1) {
+					surface.push_back(tsGroup->readSurface1D());
+				} else if (dimension == 2) {
+					surface = tsGroup->readSurface2D();
+				} else if (dimension == 3) {
+					for (auto const& row : tsGroup->readSurface3D())
+						surface.insert(surface.end(), row.begin(), row.end());
+				}
+			}
+		}
+
+		// Send them to everyone
+		int size = surface.size();
+		MPI_Bcast(&size, 1, MPI_INT, 0, MPI_COMM_WORLD);
+		surface.resize(size);
+		MPI_Bcast(surface.data(), size, MPI_INT, 0, MPI_COMM_WORLD);
+
+		return surface;
+	}
+
 	/**
 	 * Constructor.
 	 *
@@ -276,8 +317,8 @@ public:
 			int nx = 0, ny = 0, nz = 0;
 			double hx = 0.0, hy = 0.0, hz = 0.0;
 
-			xolotlCore::XFile xfile(networkName);
-			auto headerGroup = xfile.getGroup<xolotlCore::XFile::HeaderGroup>();
+			auto xfile = xolotlCore::XFile::stage(networkName);
+			auto headerGroup = xfile->getGroup<xolotlCore::XFile::HeaderGroup>();
 			if (headerGroup) {
 				headerGroup->read(nx, hx, ny, hy, nz, hz);
 
@@ -417,6 +458,14 @@ public:
 		return tauBursting;
 	}
 
+	/**
+	 * Get the grid left offset.
+	 * \see ISolverHandler.h
+	 */
+	int getLeftOffset() const override {
+		return leftOffset;
+	}
+
 	/**
 	 * Get the grid right offset.
 	 * \see ISolverHandler.h
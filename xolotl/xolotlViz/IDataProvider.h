@@ -80,6 +80,13 @@ public:
  	 */ 
 	virtual void setDataName(const std::string& name) = 0;
 
+	/**
+	 * This operation returns a copy of the data provider, with its own copy
+	 * of the data points, so that it can be used by another thread.
+	 * @return the copy
+	 */
+	virtual std::shared_ptr<IDataProvider> clone() const = 0;
+
 };
 
 //end class IDataProvider
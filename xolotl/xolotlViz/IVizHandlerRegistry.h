@@ -28,6 +28,12 @@ public:
 	 */
 	virtual std::shared_ptr<IPlot> getPlot(const std::string& name, PlotType type) = 0;
 
+	/**
+	 * This operation finishes the rendering of the plots, it must be called
+	 * before MPI is finalized.
+	 */
+	virtual void finalize() = 0;
+
 }; //end class IVizHandlerRegistry
 
 } //end namespace xolotlViz
@@ -0,0 +1,117 @@
+// Includes
+#include "AsyncPlot.h"
+
+using namespace xolotlViz;
+
+AsyncPlot::AsyncPlot(const std::string& name, PlotBuilder builder,
+		std::shared_ptr<AsyncRenderer> _renderer) :
+		xolotlCore::Identifiable(name), plotBuilder(builder), renderer(
+				_renderer), plotStyle(PlottingStyle::LINE), enableLegend(false), enableLogScale(
+				false) {
+}
+
+AsyncPlot::~AsyncPlot() {
+}
+
+void AsyncPlot::render(const std::string& fileName) {
+	// Take a snapshot of everything that is needed for this frame, the
+	// providers will be modified by the caller before the frame is rendered
+	std::shared_ptr<IDataProvider> dataProvider;
+	if (plotDataProvider)
+		dataProvider = plotDataProvider->clone();
+	std::vector<std::shared_ptr<IDataProvider> > dataProviders;
+	for (auto const& provider : plotDataProviders) {
+		dataProviders.push_back(provider->clone());
+	}
+	std::shared_ptr<LabelProvider> labelProvider;
+	if (plotLabelProvider)
+		labelProvider = std::make_shared<LabelProvider>(*plotLabelProvider);
+
+	// Copy the attributes for the lambda
+	auto builder = plotBuilder;
+	auto style = plotStyle;
+	auto legend = enableLegend;
+	auto logScale = enableLogScale;
+
+	// Queue the rendering
+	renderer->push(
+			[=]() {
+				// Build the plot on the rendering thread
+				auto plot = builder();
+				plot->setPlottingStyle(style);
+				plot->showLegend(legend);
+				plot->setLogScale(logScale);
+				if (labelProvider) plot->setLabelProvider(labelProvider);
+				if (dataProvider) plot->setDataProvider(dataProvider);
+				for (auto const& provider : dataProviders) {
+					plot->addDataProvider(provider);
+				}
+
+				// Render and save in file
+				plot->write(fileName);
+			});
+
+	return;
+}
+
+void AsyncPlot::write(const std::string& fileName) {
+	render(fileName);
+	return;
+}
+
+void AsyncPlot::setPlottingStyle(PlottingStyle style) {
+	plotStyle = style;
+	return;
+}
+
+PlottingStyle AsyncPlot::getPlottingStyle() {
+	return plotStyle;
+}
+
+void AsyncPlot::setDataProvider(std::shared_ptr<IDataProvider> dataProvider) {
+	plotDataProvider = dataProvider;
+	return;
+}
+
+void AsyncPlot::addDataProvider(std::shared_ptr<IDataProvider> dataProvider) {
+	plotDataProviders.push_back(dataProvider);
+	return;
+}
+
+std::shared_ptr<IDataProvider> AsyncPlot::getDataProvider() const {
+	return plotDataProvider;
+}
+
+std::shared_ptr<IDataProvider> AsyncPlot::getDataProvider(int i) const {
+	if (plotDataProviders.empty())
+		return plotDataProvider;
+
+	return plotDataProviders.at(i);
+}
+
+int AsyncPlot::getDataProviderNumber() const {
+	return plotDataProviders.size();
+}
+
+void AsyncPlot::setLabelProvider(std::shared_ptr<LabelProvider> labelProvider) {
+	plotLabelProvider = labelProvider;
+	return;
+}
+
+std::shared_ptr<LabelProvider> AsyncPlot::getLabelProvider() const {
+	return plotLabelProvider;
+}
+
+void AsyncPlot::showLegend(bool legendShow) {
+	enableLegend = legendShow;
+	return;
+}
+
+std::string AsyncPlot::getLegend() const {
+	return " ";
+}
+
+void AsyncPlot::setLogScale(bool logScale) {
+	enableLogScale = logScale;
+	return;
+}
@@ -0,0 +1,167 @@
+#ifndef ASYNCPLOT_H
+#define ASYNCPLOT_H
+
+// Includes
+#include <IPlot.h>
+#include <Identifiable.h>
+#include <functional>
+#include <vector>
+#include "AsyncRenderer.h"
+
+namespace xolotlViz {
+
+/**
+ * AsyncPlot realizes the IPlot interface on top of another plot that does
+ * the actual rendering. The data and label providers are set on the AsyncPlot
+ * as usual, and when the plot is written a snapshot of them is handed to the
+ * AsyncRenderer that will build the actual plot and render it on its
+ * background thread. The caller can then modify the providers right away for
+ * the next frame.
+ */
+class AsyncPlot: public IPlot, public xolotlCore::Identifiable {
+public:
+
+	/**
+	 * The type of the function creating the plot doing the rendering.
+	 */
+	typedef std::function<std::shared_ptr<IPlot>()> PlotBuilder;
+
+private:
+
+	/**
+	 * Declare the constructor as private to force the use of a name
+	 */
+	AsyncPlot() :
+			xolotlCore::Identifiable("unused") {
+	}
+
+	//! The function creating the plot doing the rendering.
+	PlotBuilder plotBuilder;
+
+	//! The renderer executing the rendering.
+	std::shared_ptr<AsyncRenderer> renderer;
+
+	//! Choice of PlottingStyle.
+	PlottingStyle plotStyle;
+
+	//! If it is equal to True, the legend will be displayed.
+	bool enableLegend;
+
+	//! If it is equal to True, a log scale will be used.
+	bool enableLogScale;
+
+	//! Data provider used for the plot.
+	std::shared_ptr<IDataProvider> plotDataProvider;
+
+	//! Container of data providers used for the series plots.
+	std::vector<std::shared_ptr<IDataProvider> > plotDataProviders;
+
+public:
+
+	/**
+	 * The default constructor
+	 *
+	 * @param name The name of the plot
+	 * @param builder The function creating the plot doing the rendering
+	 * @param _renderer The renderer executing the rendering
+	 */
+	AsyncPlot(const std::string& name, PlotBuilder builder,
+			std::shared_ptr<AsyncRenderer> _renderer);
+
+	/**
+	 * The destructor.
+	 */
+	~AsyncPlot();
+
+	/**
+	 * Method managing everything that is related to the rendering of a plot,
+	 * the rendering is queued and done later.
+	 * \see IPlot.h
+	 */
+	void render(const std::string& fileName = "fileName");
+
+	/**
+	 * Method that will save the plotted plot in a file, the rendering is
+	 * queued and done later.
+	 * \see IPlot.h
+	 */
+	void write(const std::string& fileName);
+
+	/**
+	 * Method allowing the user to set the PlottingStyle.
+	 * \see IPlot.h
+	 */
+	void setPlottingStyle(PlottingStyle style);
+
+	/**
+	 * Method getting the PlottingStyle.
+	 * \see IPlot.h
+	 */
+	PlottingStyle getPlottingStyle();
+
+	/**
+	 * Sets the data provider used for the plots.
+	 * \see IPlot.h
+	 */
+	void setDataProvider(std::shared_ptr<IDataProvider> dataProvider);
+
+	/**
+	 * Method adding one data provider to the vector plotDataProviders
+	 * \see IPlot.h
+	 */
+	void addDataProvider(std::shared_ptr<IDataProvider> dataProvider);
+
+	/**
+	 * Gets the data provider used.
+	 * \see IPlot.h
+	 */
+	std::shared_ptr<IDataProvider> getDataProvider() const;
+
+	/**
+	 * Method getting the i-th data provider for SeriesPlot
+	 * \see IPlot.h
+	 */
+	std::shared_ptr<IDataProvider> getDataProvider(int i) const;
+
+	/**
+	 * Method getting the total number of data providers
+	 * \see IPlot.h
+	 */
+	int getDataProviderNumber() const;
+
+	/**
+	 * Sets the label provider used for the plots.
+	 * \see IPlot.h
+	 */
+	void setLabelProvider(std::shared_ptr<LabelProvider> labelProvider);
+
+	/**
+	 * Gets the label provider used.
+	 * \see IPlot.h
+	 */
+	std::shared_ptr<LabelProvider> getLabelProvider() const;
+
+	/**
+	 * Method that enables the rendering of the legend.
+	 * \see IPlot.h
+	 */
+	void showLegend(bool legendShow = true);
+
+	/**
+	 * Method defining the legend with the help of the data provider and the label provider.
+	 * \see IPlot.h
+	 */
+	std::string getLegend() const;
+
+	/**
+	 * Method that enables the log scale.
+	 * \see IPlot.h
+	 */
+	void setLogScale(bool logScale = true);
+};
+
+//end class AsyncPlot
+
+} /* namespace xolotlViz */
+
+#endif
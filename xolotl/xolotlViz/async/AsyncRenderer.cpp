@@ -0,0 +1,116 @@
+// Includes
+#include "AsyncRenderer.h"
+#include <iostream>
+#include <string>
+#include <exception>
+
+using namespace xolotlViz;
+
+AsyncRenderer::AsyncRenderer(std::size_t _maxQueueSize) :
+		maxQueueSize(_maxQueueSize), busy(false), stopping(false), nRendered(
+				0), nDropped(0) {
+}
+
+AsyncRenderer::~AsyncRenderer() {
+	shutdown();
+}
+
+void AsyncRenderer::shutdown() {
+	{
+		std::lock_guard<std::mutex> lock(queueMutex);
+		if (stopping)
+			return;
+		stopping = true;
+	}
+	taskCond.notify_all();
+
+	// Wait for the remaining frames
+	if (worker.joinable())
+		worker.join();
+
+	if (nDropped > 0) {
+		std::cout << "AsyncRenderer: " << nDropped
+				<< " frame(s) were dropped because the rendering could "
+						"not keep up with the solver." << std::endl;
+	}
+
+	return;
+}
+
+void AsyncRenderer::run() {
+	while (true) {
+		std::function<void()> task;
+		{
+			std::unique_lock<std::mutex> lock(queueMutex);
+			taskCond.wait(lock, [this] {return stopping || !queue.empty();});
+
+			// Leave when there is nothing left to do
+			if (queue.empty()) {
+				idleCond.notify_all();
+				return;
+			}
+
+			task = std::move(queue.front());
+			queue.pop_front();
+			busy = true;
+		}
+
+		// Render without holding the lock, an error only loses this frame
+		try {
+			task();
+		} catch (const std::string& error) {
+			std::cerr << "AsyncRenderer: " << error << std::endl;
+		} catch (const std::exception& error) {
+			std::cerr << "AsyncRenderer: " << error.what() << std::endl;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(queueMutex);
+			busy = false;
+			nRendered++;
+			if (queue.empty())
+				idleCond.notify_all();
+		}
+	}
+
+	return;
+}
+
+bool AsyncRenderer::push(std::function<void()> task) {
+	{
+		std::lock_guard<std::mutex> lock(queueMutex);
+
+		// Drop the frame instead of stalling the solver, or if the
+		// renderer was shut down
+		if (stopping || queue.size() >= maxQueueSize) {
+			nDropped++;
+			return false;
+		}
+
+		queue.push_back(std::move(task));
+
+		// Start the thread the first time
+		if (!worker.joinable())
+			worker = std::thread(&AsyncRenderer::run, this);
+	}
+	taskCond.notify_one();
+
+	return true;
+}
+
+void AsyncRenderer::flush() {
+	std::unique_lock<std::mutex> lock(queueMutex);
+	idleCond.wait(lock, [this] {return queue.empty() && !busy;});
+
+	return;
+}
+
+unsigned long AsyncRenderer::getNumberOfRenderedFrames() {
+	std::lock_guard<std::mutex> lock(queueMutex);
+	return nRendered;
+}
+
+unsigned long AsyncRenderer::getNumberOfDroppedFrames() {
+	std::lock_guard<std::mutex> lock(queueMutex);
+	return nDropped;
+}
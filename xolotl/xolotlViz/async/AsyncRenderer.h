@@ -0,0 +1,112 @@
+#ifndef ASYNCRENDERER_H
+#define ASYNCRENDERER_H
+
+// Includes
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace xolotlViz {
+
+/**
+ * AsyncRenderer owns a single background thread that executes the rendering
+ * tasks one after the other, so that the time stepping never waits for the
+ * image generation. All the plots share the same thread because the
+ * rendering libraries are not thread safe.
+ *
+ * The queue of tasks is bounded: when it is full the new frame is dropped
+ * instead of blocking the caller.
+ */
+class AsyncRenderer {
+private:
+
+	//! The maximum number of tasks waiting in the queue.
+	std::size_t maxQueueSize;
+
+	//! The tasks waiting to be executed.
+	std::deque<std::function<void()> > queue;
+
+	//! The background thread, started with the first task.
+	std::thread worker;
+
+	//! The mutex protecting the queue and the flags.
+	std::mutex queueMutex;
+
+	//! Signals the worker that a task is available or that it should stop.
+	std::condition_variable taskCond;
+
+	//! Signals the waiting threads that the queue is empty.
+	std::condition_variable idleCond;
+
+	//! Whether the worker is currently executing a task.
+	bool busy;
+
+	//! Whether the worker should stop once the queue is empty.
+	bool stopping;
+
+	//! The number of frames that were rendered.
+	unsigned long nRendered;
+
+	//! The number of frames that were dropped because the queue was full.
+	unsigned long nDropped;
+
+	/**
+	 * The loop executed by the background thread.
+	 */
+	void run();
+
+public:
+
+	/**
+	 * The constructor.
+	 *
+	 * @param _maxQueueSize The maximum number of frames waiting to be rendered
+	 */
+	AsyncRenderer(std::size_t _maxQueueSize = 4);
+
+	/**
+	 * The destructor, renders the remaining frames before returning.
+	 */
+	~AsyncRenderer();
+
+	/**
+	 * Render the remaining frames and stop the background thread. The
+	 * plots share the renderer and can outlive MPI, so this must be called
+	 * explicitly before it is finalized. The tasks pushed afterwards are
+	 * dropped.
+	 */
+	void shutdown();
+
+	/**
+	 * Add a rendering task to the queue.
+	 *
+	 * @param task The task to execute on the background thread
+	 * @return false if the queue was full and the task was dropped
+	 */
+	bool push(std::function<void()> task);
+
+	/**
+	 * Wait until all the tasks in the queue were executed.
+	 */
+	void flush();
+
+	/**
+	 * Get the number of frames that were rendered.
+	 *
+	 * @return The number of rendered frames
+	 */
+	unsigned long getNumberOfRenderedFrames();
+
+	/**
+	 * Get the number of frames that were dropped.
+	 *
+	 * @return The number of dropped frames
+	 */
+	unsigned long getNumberOfDroppedFrames();
+};
+//end class AsyncRenderer
+
+} /* namespace xolotlViz */
+#endif
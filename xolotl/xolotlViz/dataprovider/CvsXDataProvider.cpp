@@ -9,6 +9,15 @@ CvsXDataProvider::CvsXDataProvider(const std::string& name) : DataProvider(name)
 CvsXDataProvider::~CvsXDataProvider() {
 }
 
+std::shared_ptr<IDataProvider> CvsXDataProvider::clone() const {
+	auto copy = std::make_shared<CvsXDataProvider>(*this);
+	if (dataPoints)
+		copy->setPoints(
+				std::make_shared<std::vector<Point> >(*dataPoints));
+
+	return copy;
+}
+
 std::vector<double> CvsXDataProvider::getAxis1Vector() const {
 	std::vector<double> xVector;
 
@@ -11,6 +11,15 @@ CvsXYDataProvider::CvsXYDataProvider(const std::string& name) : DataProvider(nam
 CvsXYDataProvider::~CvsXYDataProvider() {
 }
 
+std::shared_ptr<IDataProvider> CvsXYDataProvider::clone() const {
+	auto copy = std::make_shared<CvsXYDataProvider>(*this);
+	if (dataPoints)
+		copy->setPoints(
+				std::make_shared<std::vector<Point> >(*dataPoints));
+
+	return copy;
+}
+
 std::vector<double> CvsXYDataProvider::getAxis1Vector() const {
 	std::vector<double> xVector;
 
@@ -44,6 +44,12 @@ public:
 	 */
 	virtual std::vector<double> getAxis2Vector() const;
 
+	/**
+	 * Returns a copy of the data provider.
+	 * \see IDataProvider.h
+	 */
+	virtual std::shared_ptr<IDataProvider> clone() const;
+
 	/**
 	 * Method returning a vector containing the 'Value' field of the collection of Point of the DataProvider.
 	 * @return The vector of Point value.
@@ -18,6 +18,15 @@ void DataProvider::setPoints(std::shared_ptr< std::vector<Point> > points) {
 	return;
 }
 
+std::shared_ptr<IDataProvider> DataProvider::clone() const {
+	auto copy = std::make_shared<DataProvider>(*this);
+	if (dataPoints)
+		copy->setPoints(
+				std::make_shared<std::vector<Point> >(*dataPoints));
+
+	return copy;
+}
+
 double DataProvider::getDataMean() const {
 	// The size of the data vector
 	int size = dataPoints->size();
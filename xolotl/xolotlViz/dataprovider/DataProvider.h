@@ -54,6 +54,12 @@ public:
 	 */
 	void setPoints(std::shared_ptr< std::vector<Point> > points);
 
+	/**
+	 * Returns a copy of the data provider.
+	 * \see IDataProvider.h
+	 */
+	virtual std::shared_ptr<IDataProvider> clone() const;
+
 	/**
 	 * Returns the value of the mean of all the data points.
 	 * \see IDataProvider.h
@@ -13,5 +13,8 @@ std::shared_ptr<IPlot> DummyHandlerRegistry::getPlot(const std::string& name,
 	return std::make_shared<DummyPlot>(name);
 }
 
+void DummyHandlerRegistry::finalize() {
+}
+
 }    //end namespace xolotlViz
 
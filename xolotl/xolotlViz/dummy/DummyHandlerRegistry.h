@@ -34,6 +34,11 @@ public:
 	virtual std::shared_ptr<IPlot> getPlot(const std::string& name,
 			PlotType type);
 
+	/**
+	 * Nothing to finish.
+	 */
+	virtual void finalize();
+
 };
 //end class DummyHandlerRegistry
 
@@ -6,10 +6,13 @@
 #include <VideoPlot.h>
 #include <DataProvider.h>
 #include <LabelProvider.h>
+#include <AsyncPlot.h>
 
 namespace xolotlViz {
 
-StandardHandlerRegistry::StandardHandlerRegistry() {
+StandardHandlerRegistry::StandardHandlerRegistry(bool async) {
+	if (async)
+		renderer = std::make_shared<AsyncRenderer>();
 }
 
 StandardHandlerRegistry::~StandardHandlerRegistry() {
@@ -17,6 +20,22 @@ StandardHandlerRegistry::~StandardHandlerRegistry() {
 
 std::shared_ptr<IPlot> StandardHandlerRegistry::getPlot(const std::string& name,
 		PlotType type) {
+	// The rendering is done on the background thread
+	if (renderer) {
+		return std::make_shared<AsyncPlot>(name,
+				[name, type]() {return createPlot(name, type);}, renderer);
+	}
+
+	return createPlot(name, type);
+}
+
+void StandardHandlerRegistry::finalize() {
+	if (renderer)
+		renderer->shutdown();
+}
+
+std::shared_ptr<IPlot> StandardHandlerRegistry::createPlot(
+		const std::string& name, PlotType type) {
 	switch (type) {
 	case PlotType::SCATTER:
 		return std::make_shared<ScatterPlot>(name);
@@ -5,6 +5,7 @@
 #include <string>
 #include <map>
 #include "IVizHandlerRegistry.h"
+#include <AsyncRenderer.h>
 
 namespace xolotlViz {
 
@@ -14,12 +15,32 @@ namespace xolotlViz {
  * the standard registry.
  */
 class StandardHandlerRegistry: public IVizHandlerRegistry {
+private:
+
+	/**
+	 * The renderer shared by all the plots if they are rendered on a
+	 * background thread, null otherwise.
+	 */
+	std::shared_ptr<AsyncRenderer> renderer;
+
+	/**
+	 * Create the plot doing the actual rendering.
+	 *
+	 * @param name The name of the Plot.
+	 * @param type The type of plot to return.
+	 * @return A shared pointer to the newly-created Plot.
+	 */
+	static std::shared_ptr<IPlot> createPlot(const std::string& name,
+			PlotType type);
+
 public:
 
 	/**
 	 * Construct a StandardHandlerRegistry.
+	 *
+	 * @param async Whether the plots should be rendered on a background thread
 	 */
-	StandardHandlerRegistry();
+	StandardHandlerRegistry(bool async = false);
 
 	/**
 	 * Clean up a StandardHandlerRegistry.
@@ -36,6 +57,12 @@ public:
 	virtual std::shared_ptr<IPlot> getPlot(const std::string& name,
 			PlotType type);
 
+	/**
+	 * Render the frames still in the queue and stop the background thread.
+	 * The plots written afterwards are dropped.
+	 */
+	virtual void finalize();
+
 };
 //end class StandardHandlerRegistry
 